@@ -0,0 +1,79 @@
+/**
+ * Benchmarks of bytes order conversion: C getters, le/be types & bulk arrays
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <utility>
+#include "Libs/BytesOrder.h"
+
+static const unsigned int ItemsCount = 1024;
+
+//! Unaligned buffer: offset 1
+static uint8_t Buffer[ItemsCount * sizeof(uint64_t) + 1];
+
+static void BM_BytesOrderGet32C(benchmark::State &state)
+{
+	auto p = (uint32_le_t*)&Buffer[1];
+	for(auto _ : state)
+	{
+		uint32_t sum = 0;
+		for(unsigned int i = 0; i < ItemsCount; i++)
+			sum += uint32_le_get(&p[i]);
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * ItemsCount);
+}
+BENCHMARK(BM_BytesOrderGet32C);
+
+static void BM_BytesOrderGet32BeC(benchmark::State &state)
+{
+	auto p = (uint32_be_t*)&Buffer[1];
+	for(auto _ : state)
+	{
+		uint32_t sum = 0;
+		for(unsigned int i = 0; i < ItemsCount; i++)
+			sum += uint32_be_get(&p[i]);
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * ItemsCount);
+}
+BENCHMARK(BM_BytesOrderGet32BeC);
+
+template<typename T>
+static void BM_BytesOrderGet(benchmark::State &state)
+{
+	auto p = (const T*)&Buffer[1];
+	for(auto _ : state)
+	{
+		decltype(p->get()) sum = 0;
+		for(unsigned int i = 0; i < ItemsCount; i++)
+			sum += p[i].get();
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * ItemsCount);
+}
+BENCHMARK_TEMPLATE(BM_BytesOrderGet, BytesOrder::le<uint16_t>);
+BENCHMARK_TEMPLATE(BM_BytesOrderGet, BytesOrder::le<uint32_t>);
+BENCHMARK_TEMPLATE(BM_BytesOrderGet, BytesOrder::be<uint32_t>);
+BENCHMARK_TEMPLATE(BM_BytesOrderGet, BytesOrder::be<uint64_t>);
+
+template<typename T>
+static void BM_BytesOrderLoad(benchmark::State &state)
+{
+	typedef decltype(std::declval<const T&>().get()) ValueType;
+	static ValueType values[ItemsCount];
+	auto p = (const T*)&Buffer[1];
+	for(auto _ : state)
+	{
+		BytesOrder::Load(values, p, ItemsCount);
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * ItemsCount * sizeof(ValueType));
+}
+BENCHMARK_TEMPLATE(BM_BytesOrderLoad, BytesOrder::le<uint32_t>);
+BENCHMARK_TEMPLATE(BM_BytesOrderLoad, BytesOrder::be<uint16_t>);
+BENCHMARK_TEMPLATE(BM_BytesOrderLoad, BytesOrder::be<uint32_t>);
+BENCHMARK_TEMPLATE(BM_BytesOrderLoad, BytesOrder::be<uint64_t>);
@@ -0,0 +1,63 @@
+/**
+ * Benchmarks of time series codec
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include "Libs/TimeSeriesCodec.hpp"
+
+static const unsigned int ValuesCount = 4096;
+
+//! Timestamps with jitter: period 100 mS +/- 2 mS
+static void makeTimestamps(uint32_t *values)
+{
+	uint32_t t = 1000, seed = 1;
+	for(unsigned int i = 0; i < ValuesCount; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		t += 100 + (seed >> 16) % 5 - 2;
+		values[i] = t;
+	}
+}
+
+//! range(0): delta order, range(1): 1 - bit-packed blocks, 0 - varint
+static void BM_CodecEncode(benchmark::State &state)
+{
+	static uint32_t values[ValuesCount];
+	static uint8_t buffer[ValuesCount * 5 + 16];
+	makeTimestamps(values);
+	System::Codec::OptionsStruct options(state.range(0), true, state.range(1) != 0);
+	size_t length = 0;
+	for(auto _ : state)
+	{
+		System::Codec::TimeSeriesEncoderClass encoder(buffer, sizeof(buffer), options);
+		for(unsigned int i = 0; i < ValuesCount; i++)
+			encoder.Put(values[i]);
+		encoder.Flush();
+		length = encoder.getLength();
+		benchmark::DoNotOptimize(length);
+	}
+	state.SetBytesProcessed(state.iterations() * sizeof(values));
+	state.counters["ratio"] = (double)sizeof(values) / length;
+}
+BENCHMARK(BM_CodecEncode)->ArgNames({ "order", "packed" })->ArgsProduct({ { 1, 2 }, { 0, 1 } });
+
+static void BM_CodecDecode(benchmark::State &state)
+{
+	static uint32_t values[ValuesCount];
+	static uint8_t buffer[ValuesCount * 5 + 16];
+	makeTimestamps(values);
+	System::Codec::TimeSeriesEncoderClass encoder(buffer, sizeof(buffer), System::Codec::OptionsStruct(state.range(0), true, state.range(1) != 0));
+	for(unsigned int i = 0; i < ValuesCount; i++)
+		encoder.Put(values[i]);
+	encoder.Flush();
+	for(auto _ : state)
+	{
+		System::Codec::TimeSeriesDecoderClass decoder(buffer, encoder.getLength());
+		benchmark::DoNotOptimize(decoder.Get(values, ValuesCount));
+	}
+	state.SetBytesProcessed(state.iterations() * sizeof(values));
+}
+BENCHMARK(BM_CodecDecode)->ArgNames({ "order", "packed" })->ArgsProduct({ { 1, 2 }, { 0, 1 } });
@@ -0,0 +1,27 @@
+/**
+ * Benchmarks of cyclic executive: dispatch of minor frame (table lookup; compare with BM_TimerTick scan)
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include "Services/Cyclic.h"
+
+static unsigned int TasksCount;
+
+CYCLIC_TASK(BenchCurrent, 1000, 150) { TasksCount++; }
+CYCLIC_TASK(BenchSpeed, 5000, 300) { TasksCount++; }
+CYCLIC_TASK(BenchPosition, 20000, 400) { TasksCount++; }
+typedef Cyclic::ScheduleClass<BenchCurrent, BenchSpeed, BenchPosition> BenchSchedule;
+
+//! Dispatch of minor frame: major frame of 20 frames, 1..2 tasks of frame
+static void BM_CyclicDispatch(benchmark::State &state)
+{
+	BenchSchedule::Init();
+	TasksCount = 0;
+	for(auto _ : state)
+		BenchSchedule::Dispatch();
+	state.counters["tasks"] = benchmark::Counter(TasksCount, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_CyclicDispatch);
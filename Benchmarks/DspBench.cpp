@@ -0,0 +1,67 @@
+/**
+ * Benchmarks of signal processing kernels: decimation of interleaved ADC block (SIMD & scalar) & averaging
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include "Libs/Dsp.hpp"
+
+static const uint32_t Frames = 250;		//!< Frames of block: acquisition block of 10 mS at 25 kHz
+static const uint32_t MaxChannels = 8;
+
+static uint16_t Block[Frames * MaxChannels];
+static uint16_t Out[Frames * MaxChannels];
+
+static void fill()
+{
+	uint32_t random = 1;
+	for(auto &sample : Block)
+	{
+		random = random * 1664525u + 1013904223u;
+		sample = (uint16_t)(random >> 20); // 12 bits
+	}
+}
+
+//! Decimation of block: channels, factor
+static void BM_DspDecimate(benchmark::State &state)
+{
+	auto channels = (uint32_t)state.range(0), factor = (uint32_t)state.range(1);
+	fill();
+	for(auto _ : state)
+	{
+		Dsp::Decimate(Block, Frames, channels, factor, Out);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * Frames * channels);
+}
+BENCHMARK(BM_DspDecimate)->Args({ 1, 25 })->Args({ 4, 25 })->Args({ 4, 5 })->Args({ 8, 25 })->Args({ 3, 25 });
+
+//! Scalar kernel: reference of BM_DspDecimate
+static void BM_DspDecimateScalar(benchmark::State &state)
+{
+	auto channels = (uint32_t)state.range(0), factor = (uint32_t)state.range(1);
+	fill();
+	for(auto _ : state)
+	{
+		Dsp::DecimateScalar(Block, Frames, channels, factor, Out);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * Frames * channels);
+}
+BENCHMARK(BM_DspDecimateScalar)->Args({ 1, 25 })->Args({ 4, 25 })->Args({ 4, 5 })->Args({ 8, 25 })->Args({ 3, 25 });
+
+//! Mean of block: channels
+static void BM_DspAverage(benchmark::State &state)
+{
+	auto channels = (uint32_t)state.range(0);
+	fill();
+	for(auto _ : state)
+	{
+		Dsp::Average(Block, Frames, channels, Out);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * Frames * channels);
+}
+BENCHMARK(BM_DspAverage)->Arg(4);
@@ -0,0 +1,51 @@
+/**
+ * Benchmarks of energy accounting: power mode marks, peripherals & report
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include "Services/Energy.h"
+
+ENERGY_PERIPHERAL_DECLARE(BenchRadio, 12000, NULL)
+
+//! Sleep mark of message loop iteration: Enter & Exit
+static void BM_EnergySleep(benchmark::State &state)
+{
+	Energy::Reset();
+	for(auto _ : state)
+	{
+		Energy::Enter(Energy::ModeEnum::Sleep);
+		Energy::Exit();
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EnergySleep);
+
+static void BM_EnergyPeripheral(benchmark::State &state)
+{
+	for(auto _ : state)
+	{
+		ENERGY_PERIPHERAL(BenchRadio)->On();
+		ENERGY_PERIPHERAL(BenchRadio)->Off();
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EnergyPeripheral);
+
+//! Report of window & all the consumers (timers & services of benchmarks)
+static void BM_EnergyReport(benchmark::State &state)
+{
+	Energy::ReportStruct report;
+	Energy::ConsumerReportStruct consumer;
+	unsigned int consumers = 0;
+	for(auto _ : state)
+	{
+		Energy::Report(report);
+		for(consumers = 0; Energy::GetConsumer(consumers, consumer); consumers++)
+			benchmark::DoNotOptimize(consumer.Charge);
+	}
+	state.counters["consumers"] = consumers;
+}
+BENCHMARK(BM_EnergyReport);
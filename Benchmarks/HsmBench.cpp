@@ -0,0 +1,201 @@
+/**
+ * Benchmarks of hierarchical state machine: table dispatch of Services/Hsm.h & the same machine as hand-written switch
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include "Services/Hsm.h"
+
+namespace
+{
+	enum StateEnum : Hsm::StateId { Top, Off, On, Idle, Running, Slow, Fast, Error, StatesCount };
+	enum EventEnum : Hsm::EventId { Power, Start, Stop, Speed, Fault, Reset, EventsCount };
+
+	//! Actions log: checksum of actions order
+	static uint32_t Log, Faults;
+
+	static void action(uint32_t id) { Log = Log * 31 + id; }
+	static void powerOn() { action(1); }
+	static void powerOff() { action(2); }
+	static void motorOn() { action(3); }
+	static void motorOff() { action(4); }
+	static void alarm() { action(5); }
+	static void recover() { action(6); }
+	static void report() { action(7); }
+	static bool isPrimed() { return true; }
+	static bool isRecoverable() { return (Faults++ & 1) == 0; }
+
+	static constexpr Hsm::StateStruct States[StatesCount] = {
+		{ Hsm::None, Off, NULL, NULL },			// Top
+		{ Top, Hsm::None, NULL, NULL },			// Off
+		{ Top, Idle, &powerOn, &powerOff },		// On
+		{ On, Hsm::None, NULL, NULL },			// Idle
+		{ On, Slow, &motorOn, &motorOff },		// Running
+		{ Running, Hsm::None, NULL, NULL },		// Slow
+		{ Running, Hsm::None, NULL, NULL },		// Fast
+		{ Top, Hsm::None, &alarm, NULL },		// Error
+	};
+	static constexpr Hsm::TransitionStruct Transitions[] = {
+		{ Off, Power, On, NULL, NULL },
+		{ On, Power, Off, NULL, NULL },
+		{ Idle, Start, Running, &isPrimed, NULL },
+		{ Running, Stop, Idle, NULL, NULL },
+		{ Slow, Speed, Fast, NULL, NULL },
+		{ Fast, Speed, Slow, NULL, NULL },
+		{ Running, Fault, Hsm::None, &isRecoverable, &recover },
+		{ On, Fault, Error, NULL, &report },
+		{ Error, Reset, Off, NULL, NULL },
+	};
+	HSM_MACHINE(Machine, States, Transitions, EventsCount)
+
+	//! Events of service state bits: local bits 0..3 - Power, Start, Stop, Speed; bit 0 of source service - Fault & Reset
+	static const char *SourceName = "Source";
+	static constexpr Hsm::BitEventStruct LocalBits[] = { { 0, true, Power }, { 1, true, Start }, { 2, true, Stop }, { 3, true, Speed } };
+	static constexpr Hsm::BitEventStruct SourceBits[] = { { 0, true, Fault }, { 0, false, Reset } };
+	HSM_BITS(LocalEvents, LocalBits)
+	HSM_BITS(SourceEvents, SourceBits)
+
+	//! The same machine: switch of leaf state, then events of parent state
+	static Hsm::StateId HandState;
+
+	static bool handDispatch(Hsm::EventId event)
+	{
+		switch(HandState)
+		{
+		case Off:
+			if(event == Power)
+			{
+				powerOn();
+				HandState = Idle;
+				return true;
+			}
+			return false;
+		case Idle:
+			if(event == Start && isPrimed())
+			{
+				motorOn();
+				HandState = Slow;
+				return true;
+			}
+			break;
+		case Slow:
+		case Fast:
+			if(event == Speed)
+			{
+				HandState = HandState == Slow ? Fast : Slow;
+				return true;
+			}
+			if(event == Stop)
+			{
+				motorOff();
+				HandState = Idle;
+				return true;
+			}
+			if(event == Fault && isRecoverable())
+			{
+				recover();
+				return true;
+			}
+			if(event == Power || event == Fault)
+				motorOff(); // transition of On: exit of Running
+			break;
+		case Error:
+			if(event == Reset)
+			{
+				HandState = Off;
+				return true;
+			}
+			return false;
+		default:
+			return false;
+		}
+		// On
+		if(event == Power)
+		{
+			powerOff();
+			HandState = Off;
+			return true;
+		}
+		if(event == Fault)
+		{
+			powerOff();
+			report();
+			alarm();
+			HandState = Error;
+			return true;
+		}
+		return false;
+	}
+
+	//! Events of scenario: each state & guard, unhandled events
+	static const Hsm::EventId Events[] = { Power, Start, Speed, Speed, Fault, Fault, Reset, Power, Start, Stop, Start, Speed, Stop, Power, Fault, Stop };
+	static const unsigned int EventsLength = sizeof(Events) / sizeof(Events[0]);
+
+	//! Runs scenario: actions log & final state
+	template<typename Dispatch> static uint64_t scenario(Dispatch dispatch, Hsm::StateId (*state)())
+	{
+		Log = Faults = 0;
+		for(unsigned int i = 0; i < EventsLength * 4; i++)
+			dispatch(Events[i % EventsLength]);
+		return (uint64_t)Log << 8 | state();
+	}
+}
+
+//! Table dispatch: cycles per event, bytes of tables (flat tables & declaration tables)
+static void BM_HsmDispatch(benchmark::State &state)
+{
+	Machine::Init();
+	HandState = Off;
+	if(scenario(&Machine::Dispatch, &Machine::getState) != scenario(&handDispatch, []() { return HandState; }))
+		state.SkipWithError("state machine differs from hand-written switch");
+	Machine::Init();
+	unsigned int i = 0;
+	for(auto _ : state)
+	{
+		benchmark::DoNotOptimize(Machine::Dispatch(Events[i]));
+		i = i + 1 == EventsLength ? 0 : i + 1;
+	}
+	state.SetItemsProcessed(state.iterations());
+	state.counters["tables"] = Machine::TablesSize + sizeof(States) + sizeof(Transitions);
+}
+BENCHMARK(BM_HsmDispatch);
+
+//! Hand-written switch: reference of BM_HsmDispatch
+static void BM_HsmHandWritten(benchmark::State &state)
+{
+	HandState = Off;
+	unsigned int i = 0;
+	for(auto _ : state)
+	{
+		benchmark::DoNotOptimize(handDispatch(Events[i]));
+		i = i + 1 == EventsLength ? 0 : i + 1;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HsmHandWritten);
+
+//! Events of service state bits by callbacks of SERVICE_DECLARE: local state & state of another service
+static void BM_HsmServiceEvents(benchmark::State &state)
+{
+	static const Services::StateType Local[] = { 1, 2, 8, 8, 4, 1 }; // Power, Start, Speed, Speed, Stop, Power
+	Services::LocalStateChangedCallback local = &Hsm::LocalStateChanged<Machine, LocalEvents>;
+	Services::StateChangedCallback changed = &Hsm::StateChanged<Machine, &SourceName, SourceEvents>;
+	Machine::Init();
+	unsigned int i = 0;
+	Services::StateType source = 0;
+	for(auto _ : state)
+	{
+		auto bits = Local[i];
+		local("Bench", bits);
+		if(++i == sizeof(Local) / sizeof(Local[0]))
+		{
+			i = 0;
+			source ^= 1;
+			changed(SourceName, source, 1); // Fault (unhandled in Off) & Reset
+		}
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_HsmServiceEvents);
@@ -0,0 +1,58 @@
+/**
+ * Benchmarks of metrics registry: updates & export
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include "Libs/Metrics.hpp"
+
+METRICS_COUNTER(bench_events_total)
+METRICS_GAUGE(bench_level)
+METRICS_HISTOGRAM(bench_duration_us, 10, 100, 1000, 10000)
+
+static void BM_MetricsCounterAdd(benchmark::State &state)
+{
+	for(auto _ : state)
+		METRIC(bench_events_total)->Add();
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MetricsCounterAdd);
+
+static void BM_MetricsGaugeSet(benchmark::State &state)
+{
+	int32_t level = 0;
+	for(auto _ : state)
+		METRIC(bench_level)->Set(level++);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MetricsGaugeSet);
+
+//! Observation of values over all the buckets
+static void BM_MetricsHistogramObserve(benchmark::State &state)
+{
+	uint32_t value = 0;
+	for(auto _ : state)
+	{
+		METRIC(bench_duration_us)->Observe(value);
+		value = (value + 997) % 20000;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MetricsHistogramObserve);
+
+//! Snapshot of all the metrics: range(0) - export kind
+static void BM_MetricsExport(benchmark::State &state)
+{
+	uint8_t buffer[256];
+	auto kind = (Metrics::ExportEnum)state.range(0);
+	size_t len = 0;
+	for(auto _ : state)
+	{
+		METRIC(bench_events_total)->Add(3);
+		benchmark::DoNotOptimize(len = Metrics::Export(kind, buffer, sizeof(buffer)));
+	}
+	state.counters["bytes"] = len;
+}
+BENCHMARK(BM_MetricsExport)->ArgName("kind")->Arg((int)Metrics::ExportEnum::Delta)->Arg((int)Metrics::ExportEnum::Full);
@@ -0,0 +1,71 @@
+/**
+ * Benchmarks of hot code placement: message loop round with timer callback in FLASH & in RAM (TIMER_CALLBACK_HOT)
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Cycles are measured by profile sites: the same measurement of target build (DWT cycles counter) shows
+ * FLASH wait states & prefetch misses saved by RAM code. Host has no code placement (placement macros are empty):
+ * both sites show the same cycles, the difference is the noise of measurement.
+ */
+
+#include <benchmark/benchmark.h>
+#include "Services/Timer.h"
+#include "Libs/Profile.hpp"
+
+PROFILE_SITE_DECLARE(PlacementFlash)
+PROFILE_SITE_DECLARE(PlacementRam)
+
+//! Samples of the callback loop: moving sum
+static const unsigned int SamplesCount = 64;
+static int16_t Samples[SamplesCount];
+static volatile int32_t Sum;
+
+TIMER_DECLARE(PlacementFlash)
+TIMER_DECLARE(PlacementRam)
+
+TIMER_CALLBACK(PlacementFlash)
+{
+	int32_t sum = 0;
+	for(unsigned int i = 0; i < SamplesCount; i++)
+		sum += Samples[i] * (int32_t)(i + 1);
+	Sum = sum;
+}
+
+TIMER_CALLBACK_HOT(PlacementRam, PORT_RAMFUNC)
+{
+	int32_t sum = 0;
+	for(unsigned int i = 0; i < SamplesCount; i++)
+		sum += Samples[i] * (int32_t)(i + 1);
+	Sum = sum;
+}
+
+//! Message loop round: Timer::Tick with the timer due each tick
+static void placementTick(benchmark::State &state, Timer::TimerStateStruct *timer, Profile::SiteStruct *site)
+{
+	Timer::Init();
+	SystemTime = 0;
+	Timer::Start(1, timer);
+	site->Reset();
+	for(auto _ : state)
+	{
+		SystemTime++;
+		Profile::Scope scope(site);
+		Timer::Tick();
+	}
+	Timer::Stop(timer);
+	state.counters["min"] = site->Min;
+	state.counters["avg"] = site->Average();
+}
+
+static void BM_PlacementTickFlash(benchmark::State &state)
+{
+	placementTick(state, TIMER_STATE(PlacementFlash), PROFILE_SITE(PlacementFlash));
+}
+BENCHMARK(BM_PlacementTickFlash);
+
+static void BM_PlacementTickRam(benchmark::State &state)
+{
+	placementTick(state, TIMER_STATE(PlacementRam), PROFILE_SITE(PlacementRam));
+}
+BENCHMARK(BM_PlacementTickRam);
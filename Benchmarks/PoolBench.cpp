@@ -0,0 +1,106 @@
+/**
+ * Benchmarks of pool & arena allocators versus heap
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <stdlib.h>
+#include "Libs/Pool.hpp"
+#include "Libs/Arena.hpp"
+
+static const unsigned int BlockSize = 64;
+static const unsigned int BlocksCount = 64;
+
+POOL_DECLARE(BenchPool, BlockSize, BlocksCount)
+
+static System::ArenaBufferClass<BlockSize * BlocksCount> BenchArena;
+
+//! Allocation & free of one block
+//! @note Host malloc is about 2x faster (thread cache of glibc, no atomics): pool pays compare-exchange & statistics
+//! for lock-free safety from ISRs, constant time (no search, no fragmentation) & no heap; device malloc has none of them
+static void BM_PoolAllocFree(benchmark::State &state)
+{
+	for(auto _ : state)
+	{
+		auto block = POOL(BenchPool)->Alloc();
+		benchmark::DoNotOptimize(block);
+		POOL(BenchPool)->Free(block);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PoolAllocFree);
+
+static void BM_MallocFree(benchmark::State &state)
+{
+	for(auto _ : state)
+	{
+		auto block = malloc(BlockSize);
+		benchmark::DoNotOptimize(block);
+		free(block);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MallocFree);
+
+//! Burst: @c BlocksCount allocations, then frees
+static void BM_PoolBurst(benchmark::State &state)
+{
+	void *blocks[BlocksCount];
+	for(auto _ : state)
+	{
+		for(unsigned int i = 0; i < BlocksCount; i++)
+			blocks[i] = POOL(BenchPool)->Alloc();
+		benchmark::DoNotOptimize(blocks);
+		for(unsigned int i = 0; i < BlocksCount; i++)
+			POOL(BenchPool)->Free(blocks[i]);
+	}
+	state.SetItemsProcessed(state.iterations() * BlocksCount);
+}
+BENCHMARK(BM_PoolBurst);
+
+static void BM_MallocBurst(benchmark::State &state)
+{
+	void *blocks[BlocksCount];
+	for(auto _ : state)
+	{
+		for(unsigned int i = 0; i < BlocksCount; i++)
+			blocks[i] = malloc(BlockSize);
+		benchmark::DoNotOptimize(blocks);
+		for(unsigned int i = 0; i < BlocksCount; i++)
+			free(blocks[i]);
+	}
+	state.SetItemsProcessed(state.iterations() * BlocksCount);
+}
+BENCHMARK(BM_MallocBurst);
+
+//! Burst of allocations released by scope
+static void BM_ArenaBurst(benchmark::State &state)
+{
+	void *blocks[BlocksCount];
+	for(auto _ : state)
+	{
+		System::ArenaClass::ScopeClass scope(BenchArena);
+		for(unsigned int i = 0; i < BlocksCount; i++)
+			blocks[i] = BenchArena.Allocate(BlockSize);
+		benchmark::DoNotOptimize(blocks);
+	}
+	state.SetItemsProcessed(state.iterations() * BlocksCount);
+}
+BENCHMARK(BM_ArenaBurst);
+
+//! Contention: threads share the pool
+static void BM_PoolAllocFreeThreads(benchmark::State &state)
+{
+	for(auto _ : state)
+	{
+		auto block = POOL(BenchPool)->Alloc();
+		benchmark::DoNotOptimize(block);
+		POOL(BenchPool)->Free(block);
+	}
+	state.SetItemsProcessed(state.iterations());
+	if(state.thread_index() == 0)
+		state.counters["HighWater"] = POOL(BenchPool)->getHighWater();
+}
+BENCHMARK(BM_PoolAllocFreeThreads)->Threads(1)->Threads(2);
@@ -0,0 +1,35 @@
+/**
+ * Benchmarks of profiling clock & statistics sites
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include "Libs/Profile.hpp"
+
+PROFILE_SITE_DECLARE(BenchScope)
+
+static void BM_ProfileCycles(benchmark::State &state)
+{
+	Profile::Init();
+	for(auto _ : state)
+		benchmark::DoNotOptimize(Profile::Cycles());
+	state.counters["frequency"] = Profile::Frequency();
+}
+BENCHMARK(BM_ProfileCycles);
+
+//! Empty scope: overhead of measurement (two clock reads & site update)
+static void BM_ProfileScope(benchmark::State &state)
+{
+	PROFILE_SITE(BenchScope)->Reset();
+	for(auto _ : state)
+	{
+		PROFILE_SCOPE(BenchScope);
+		benchmark::ClobberMemory();
+	}
+	state.counters["min"] = PROFILE_SITE(BenchScope)->Min;
+	state.counters["avg"] = PROFILE_SITE(BenchScope)->Average();
+	state.counters["max"] = PROFILE_SITE(BenchScope)->Max;
+}
+BENCHMARK(BM_ProfileScope);
@@ -0,0 +1,134 @@
+/**
+ * Benchmarks of services: states processing, lookup by name & enable in dependencies order
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <thread>
+#include "Services/IService.h"
+
+//! Services count of the table
+static const unsigned int ServicesCount = 32;
+
+static unsigned int CallbacksCount;
+
+//! Duration of enable callback, uS: blocking initialization of device (sleep: waits of I/O, not CPU work)
+static unsigned int EnableWork;
+
+namespace Services
+{
+	namespace Bench
+	{
+		static bool Enable(const char *, bool)
+		{
+			if(EnableWork != 0)
+				std::this_thread::sleep_for(std::chrono::microseconds(EnableWork));
+			return true;
+		}
+		static void StateChanged(const char *, StateType, StateType) { CallbacksCount++; }
+		static void StateChangedBy(const char *, StateType &stateBits, StateType) { stateBits = 0; }
+	}
+}
+
+//! Service @c n: depends on @c dependencies (levels: group of 8 services depends on the previous group)
+#define BENCH_SERVICE(n, dependencies...) \
+	namespace Services { namespace Bench##n { \
+		SERVICE_DEPENDS(Bench##n, ##dependencies) \
+		SERVICE_DECLARE(Bench##n, &Bench::Enable, &Bench::StateChanged, &Bench::StateChangedBy, NULL) \
+		IServiceStateStruct *State = &SERVICE_STATE(Bench##n); \
+	} }
+#define BENCH_SERVICES_8(n, d...) BENCH_SERVICE(n##0, ##d) BENCH_SERVICE(n##1, ##d) BENCH_SERVICE(n##2, ##d) BENCH_SERVICE(n##3, ##d) BENCH_SERVICE(n##4, ##d) BENCH_SERVICE(n##5, ##d) BENCH_SERVICE(n##6, ##d) BENCH_SERVICE(n##7, ##d)
+BENCH_SERVICES_8(0) BENCH_SERVICES_8(1, Bench00, Bench07) BENCH_SERVICES_8(2, Bench10, Bench17) BENCH_SERVICES_8(3, Bench20, Bench27)
+
+static Services::IServiceStateStruct *States[ServicesCount] =
+{
+	Services::Bench00::State, Services::Bench01::State, Services::Bench02::State, Services::Bench03::State,
+	Services::Bench04::State, Services::Bench05::State, Services::Bench06::State, Services::Bench07::State,
+	Services::Bench10::State, Services::Bench11::State, Services::Bench12::State, Services::Bench13::State,
+	Services::Bench14::State, Services::Bench15::State, Services::Bench16::State, Services::Bench17::State,
+	Services::Bench20::State, Services::Bench21::State, Services::Bench22::State, Services::Bench23::State,
+	Services::Bench24::State, Services::Bench25::State, Services::Bench26::State, Services::Bench27::State,
+	Services::Bench30::State, Services::Bench31::State, Services::Bench32::State, Services::Bench33::State,
+	Services::Bench34::State, Services::Bench35::State, Services::Bench36::State, Services::Bench37::State,
+};
+
+static const char *Names[ServicesCount] =
+{
+	Services::Bench00::ServiceName, Services::Bench01::ServiceName, Services::Bench02::ServiceName, Services::Bench03::ServiceName,
+	Services::Bench04::ServiceName, Services::Bench05::ServiceName, Services::Bench06::ServiceName, Services::Bench07::ServiceName,
+	Services::Bench10::ServiceName, Services::Bench11::ServiceName, Services::Bench12::ServiceName, Services::Bench13::ServiceName,
+	Services::Bench14::ServiceName, Services::Bench15::ServiceName, Services::Bench16::ServiceName, Services::Bench17::ServiceName,
+	Services::Bench20::ServiceName, Services::Bench21::ServiceName, Services::Bench22::ServiceName, Services::Bench23::ServiceName,
+	Services::Bench24::ServiceName, Services::Bench25::ServiceName, Services::Bench26::ServiceName, Services::Bench27::ServiceName,
+	Services::Bench30::ServiceName, Services::Bench31::ServiceName, Services::Bench32::ServiceName, Services::Bench33::ServiceName,
+	Services::Bench34::ServiceName, Services::Bench35::ServiceName, Services::Bench36::ServiceName, Services::Bench37::ServiceName,
+};
+
+static void enableServices()
+{
+	Services::Init();
+	Services::Enable(NULL);
+}
+
+//! Processing round with @c range(0) changed services of @c ServicesCount
+static void BM_ServicesProcessStates(benchmark::State &state)
+{
+	enableServices();
+	const unsigned int changes = state.range(0);
+	CallbacksCount = 0;
+	for(auto _ : state)
+	{
+		for(unsigned int i = 0; i < changes; i++)
+			States[i * ServicesCount / changes]->SetState(1);
+		Services::ProcessStates();
+	}
+	state.counters["callbacks"] = benchmark::Counter(CallbacksCount, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_ServicesProcessStates)->ArgName("changes")->Arg(0)->Arg(1)->Arg(4)->Arg(ServicesCount);
+
+//! Lookup by name (findIndex) of service @c range(0) of the table
+static void BM_ServicesSetState(benchmark::State &state)
+{
+	enableServices();
+	auto name = Names[state.range(0)];
+	for(auto _ : state)
+		benchmark::DoNotOptimize(Services::SetState(name, 1, 1));
+}
+BENCHMARK(BM_ServicesSetState)->ArgName("index")->Arg(0)->Arg(ServicesCount / 2)->Arg(ServicesCount - 1);
+
+static void BM_ServicesState(benchmark::State &state)
+{
+	enableServices();
+	auto name = Names[state.range(0)];
+	for(auto _ : state)
+		benchmark::DoNotOptimize(Services::State(name));
+}
+BENCHMARK(BM_ServicesState)->ArgName("index")->Arg(0)->Arg(ServicesCount / 2)->Arg(ServicesCount - 1);
+
+//! Enable & disable of all the services: 4 levels of 8 services; range(0): 1 - parallel workers of level;
+//! range(1): duration of enable callback, uS (0 - trivial callbacks: wakeup of workers costs more than the callbacks)
+static void BM_ServicesEnable(benchmark::State &state)
+{
+	Services::Init();
+	const bool parallel = state.range(0);
+	EnableWork = state.range(1);
+	for(auto _ : state)
+	{
+		if(parallel)
+		{
+			Services::EnableParallel(true);
+			Services::EnableParallel(false);
+		}
+		else
+		{
+			Services::Enable(NULL, true);
+			Services::Enable(NULL, false);
+		}
+	}
+	EnableWork = 0;
+	state.counters["ready_us"] = Services::ReadyTime();
+}
+BENCHMARK(BM_ServicesEnable)->ArgNames({ "parallel", "work_us" })->ArgsProduct({ { 0, 1 }, { 0, 100 } })->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,66 @@
+/**
+ * Benchmarks of software PWM: interrupts of period & commit of duties
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include "stm32l0xx.h"
+#include "Libs/SoftPwm.hpp"
+
+static const unsigned int MaxChannels = 16;
+static const uint16_t Period = 1000;
+
+//! Channels of two ports, different duties: steps count is channels count plus one
+static void setup(System::Pwm::SoftPwmClass<MaxChannels> &pwm, unsigned int channels)
+{
+	for(unsigned int i = 0; i < MaxChannels; i++)
+	{
+		auto bit = 1UL << (i / 2);
+		if(i < channels)
+			pwm.SetChannel(i, &(i % 2 == 0 ? GPIOA : GPIOB)->BSRR, bit, bit << 16);
+		pwm.SetDuty(i, (uint16_t)(Period - 1 - i * 37));
+	}
+	pwm.Commit();
+}
+
+//! All the interrupts of one period: range(0) - channels
+static void BM_SoftPwm(benchmark::State &state)
+{
+	auto channels = (unsigned int)state.range(0);
+	System::Pwm::SoftPwmClass<MaxChannels> pwm(Period);
+	setup(pwm, channels);
+	uint32_t interrupts = 0;
+	for(auto _ : state)
+	{
+		uint32_t time = 0;
+		while(time < Period)
+		{
+			time += pwm.Interrupt();
+			interrupts++;
+		}
+		benchmark::DoNotOptimize(time);
+	}
+	state.SetItemsProcessed(interrupts);
+	state.counters["interrupts"] = benchmark::Counter(interrupts, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_SoftPwm)->ArgName("channels")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16);
+
+//! Commit of new duty & the period which applies it (reference: BM_SoftPwm): range(0) - channels
+static void BM_SoftPwmCommit(benchmark::State &state)
+{
+	auto channels = (unsigned int)state.range(0);
+	System::Pwm::SoftPwmClass<MaxChannels> pwm(Period);
+	setup(pwm, channels);
+	uint16_t shift = 0;
+	for(auto _ : state)
+	{
+		pwm.SetDuty(0, (uint16_t)(++shift % Period));
+		benchmark::DoNotOptimize(pwm.Commit());
+		for(uint32_t time = 0; time < Period;)
+			time += pwm.Interrupt();
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SoftPwmCommit)->ArgName("channels")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16);
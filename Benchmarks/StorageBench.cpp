@@ -0,0 +1,139 @@
+/**
+ * Benchmarks of page cache & page storage on RAM device
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <string.h>
+#include "Libs/PageCacheClass.hpp"
+#include "Libs/PersistentStorage.hpp"
+
+static const unsigned int PageSize = 256;
+static const unsigned int DeviceSize = 64 * 1024;
+
+//! RAM device
+static uint8_t Device[DeviceSize];
+
+class RamPageCacheClass : public System::Cache::PageCacheClass<uint32_t, PageSize>
+{
+protected:
+	bool Write(const void *buffer, uint32_t address, unsigned int len) override
+	{
+		memcpy(&Device[address % DeviceSize], buffer, len);
+		return true;
+	}
+	bool Read(void *buffer, uint32_t address, unsigned int len) override
+	{
+		memcpy(buffer, &Device[address % DeviceSize], len);
+		return true;
+	}
+};
+
+//! Sequential unaligned writes of @c range(0) bytes: log append pattern
+static void BM_PageCacheSetDataSequential(benchmark::State &state)
+{
+	RamPageCacheClass cache;
+	uint8_t data[PageSize] = { 0 };
+	const unsigned int len = state.range(0);
+	uint32_t address = 1;
+	for(auto _ : state)
+	{
+		benchmark::DoNotOptimize(cache.SetData(data, address, len));
+		address = (address + len) % (DeviceSize - PageSize);
+	}
+	state.SetBytesProcessed(state.iterations() * len);
+}
+BENCHMARK(BM_PageCacheSetDataSequential)->ArgName("len")->Arg(4)->Arg(16)->Arg(64);
+
+//! Whole page writes: cache bypass
+static void BM_PageCacheSetDataPage(benchmark::State &state)
+{
+	RamPageCacheClass cache;
+	uint8_t data[PageSize] = { 0 };
+	uint32_t address = 0;
+	for(auto _ : state)
+	{
+		benchmark::DoNotOptimize(cache.SetData(data, address, PageSize));
+		address = (address + PageSize) % DeviceSize;
+	}
+	state.SetBytesProcessed(state.iterations() * PageSize);
+}
+BENCHMARK(BM_PageCacheSetDataPage);
+
+//! Reads of @c range(0) bytes; range(1): 1 - from cached page, 0 - from device
+static void BM_PageCacheGetData(benchmark::State &state)
+{
+	RamPageCacheClass cache;
+	uint8_t data[PageSize] = { 0 };
+	const unsigned int len = state.range(0);
+	const bool cached = state.range(1) != 0;
+	cache.SetData(data, 1, 1); // cache first page
+	uint32_t address = cached ? 3 : PageSize * 2 + 3;
+	for(auto _ : state)
+	{
+		benchmark::DoNotOptimize(cache.GetData(data, address, len));
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(state.iterations() * len);
+}
+BENCHMARK(BM_PageCacheGetData)->ArgNames({ "len", "cached" })->ArgsProduct({ { 4, 64 }, { 0, 1 } });
+
+class RamPageStorageClass : public System::PersistentStorage::PageStorageClass<uint32_t, uint16_t, uint16_t>
+{
+protected:
+	bool Compare(const void *pattern, uint32_t address, uint16_t len) const override
+	{
+		return memcmp(pattern, &Device[address], len) == 0;
+	}
+	bool Read(void *data, uint32_t address, uint16_t len) const override
+	{
+		memcpy(data, &Device[address], len);
+		return true;
+	}
+	uint16_t CalculatePageCRC(uint32_t address, uint16_t len) const override
+	{
+		// CRC-16/CCITT, bitwise
+		uint16_t crc = 0xFFFF;
+		for(auto p = &Device[address]; len > 0; len--, p++)
+		{
+			crc ^= (uint16_t)*p << 8;
+			for(unsigned int i = 0; i < 8; i++)
+				crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+		}
+		return crc;
+	}
+	bool WritePage(const void *data, uint32_t address, uint16_t len) const override
+	{
+		memcpy(&Device[address], data, len);
+		return true;
+	}
+
+public:
+	RamPageStorageClass(const System::UUID &uuid, uint32_t address) : PageStorageClass(uuid, address) {}
+
+	//! Writes page of @c len bytes of user data
+	void Format(uint16_t len)
+	{
+		for(unsigned int i = 0; i < len; i++)
+			Device[m_Address + PageHeaderLayout::Size + i] = (uint8_t)i;
+		PageHeaderMetricsStruct metrics = { len, 0, len, CalculatePageCRC(m_Address + PageHeaderLayout::Size, len) };
+		SetHeader(metrics);
+	}
+};
+
+static constexpr System::UUID DataUUID = System::UUID::Parse("0e1d5a52-9d4c-4b6e-8a51-3b8c5f2a7d10");
+
+//! Page check; range(0): 0 - full check, 1 - no CRC check, 2 - UUIDs only
+static void BM_PageStorageIsPageCorrect(benchmark::State &state)
+{
+	RamPageStorageClass storage(DataUUID, 0);
+	storage.Format(PageSize - 64);
+	RamPageStorageClass::CheckOptions options(state.range(0) >= 1, state.range(0) >= 2);
+	for(auto _ : state)
+		benchmark::DoNotOptimize(storage.isPageCorrect(0, PageSize, options));
+	if(storage.isPageCorrect(0, PageSize) != RamPageStorageClass::PageCheckResultEnum::Ok)
+		state.SkipWithError("page is not correct");
+}
+BENCHMARK(BM_PageStorageIsPageCorrect)->ArgName("options")->Arg(0)->Arg(1)->Arg(2);
@@ -0,0 +1,77 @@
+/**
+ * Benchmarks of timer: table scan & callbacks
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include "Services/Timer.h"
+
+//! Timers count of the table
+static const unsigned int TimersCount = 64;
+
+static unsigned int CallbacksCount;
+
+#define BENCH_TIMER(n) \
+	TIMER_DECLARE(Bench##n) \
+	TIMER_CALLBACK(Bench##n) { CallbacksCount++; }
+#define BENCH_TIMERS_8(n) BENCH_TIMER(n##0) BENCH_TIMER(n##1) BENCH_TIMER(n##2) BENCH_TIMER(n##3) BENCH_TIMER(n##4) BENCH_TIMER(n##5) BENCH_TIMER(n##6) BENCH_TIMER(n##7)
+BENCH_TIMERS_8(0) BENCH_TIMERS_8(1) BENCH_TIMERS_8(2) BENCH_TIMERS_8(3) BENCH_TIMERS_8(4) BENCH_TIMERS_8(5) BENCH_TIMERS_8(6) BENCH_TIMERS_8(7)
+
+//! Starts first @c enabled timers of the table
+static void startTimers(unsigned int enabled, uint32_t interval)
+{
+	Timer::Init();
+	SystemTime = 0;
+	for(unsigned int i = 0; i < enabled; i++)
+		Timer::Start(interval, Timer::TimersTable::At(i).State);
+}
+
+//! Tick: @c range(0) enabled timers of @c TimersCount; range(1): 1 - all enabled timers are due each tick, 0 - none is due
+static void BM_TimerTick(benchmark::State &state)
+{
+	startTimers(state.range(0), state.range(1) ? 1 : 0xFFFFFFF);
+	CallbacksCount = 0;
+	for(auto _ : state)
+	{
+		SystemTime++;
+		Timer::Tick();
+	}
+	state.counters["callbacks"] = benchmark::Counter(CallbacksCount, benchmark::Counter::kIsRate);
+	state.counters["timers"] = (double)Timer::TimersTable::size();
+}
+BENCHMARK(BM_TimerTick)->ArgNames({ "enabled", "due" })->ArgsProduct({ { 0, 8, TimersCount }, { 0, 1 } });
+
+static void BM_TimerStart(benchmark::State &state)
+{
+	startTimers(0, 0);
+	auto timer = Timer::TimersTable::At(0).State;
+	for(auto _ : state)
+	{
+		Timer::Start(10, timer, true);
+		benchmark::ClobberMemory();
+	}
+}
+BENCHMARK(BM_TimerStart);
+
+#define BENCH_ISR_TIMER(n) \
+	TIMER_ISR_DECLARE(BenchIsr##n) \
+	TIMER_ISR_CALLBACK(BenchIsr##n) { CallbacksCount++; }
+BENCH_ISR_TIMER(0) BENCH_ISR_TIMER(1) BENCH_ISR_TIMER(2) BENCH_ISR_TIMER(3)
+
+//! SysTick interrupt of ISR class timers: range(0) - interval, mS; 10 - most interrupts return by cached time stamp
+static void BM_TimerIsrTick(benchmark::State &state)
+{
+	startTimers(0, 0);
+	for(auto &table : Timer::IsrTimersTable())
+		Timer::Start(state.range(0), table.State);
+	CallbacksCount = 0;
+	for(auto _ : state)
+	{
+		SystemTime++;
+		Timer::IsrTick();
+	}
+	state.counters["callbacks"] = benchmark::Counter(CallbacksCount, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_TimerIsrTick)->ArgName("interval")->Arg(1)->Arg(10);
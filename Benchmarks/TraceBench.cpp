@@ -0,0 +1,72 @@
+/**
+ * Benchmarks of trace & deferred log: records write cost
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ * @note Trace is enabled by CMake option: -DCORTEXM_TRACE_BUFFER_SIZE=1024
+ */
+
+#include <benchmark/benchmark.h>
+#include "Libs/Trace.hpp"
+#include "Libs/Log.hpp"
+
+#ifdef TRACE_BUFFER_SIZE
+
+static void BM_TraceEvent(benchmark::State &state)
+{
+	Trace::Init();
+	uint32_t arg = 0;
+	for(auto _ : state)
+		TRACE_EVENT(Trace::User, arg++, 1);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TraceEvent);
+
+static void BM_TraceScope(benchmark::State &state)
+{
+	Trace::Init();
+	uint32_t arg = 0;
+	for(auto _ : state)
+	{
+		TRACE_SCOPE(Trace::User, arg++);
+	}
+	state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_TraceScope);
+
+//! Multi-producer: records of threads into one ring
+static void BM_TraceEventThreads(benchmark::State &state)
+{
+	if(state.thread_index() == 0)
+		Trace::Init();
+	uint32_t arg = 0;
+	for(auto _ : state)
+		TRACE_EVENT(Trace::User, arg++, state.thread_index());
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TraceEventThreads)->Threads(1)->Threads(2);
+
+static void BM_LogNoArgs(benchmark::State &state)
+{
+	Trace::Init();
+	for(auto _ : state)
+		LOG_INFO("Message");
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LogNoArgs);
+
+//! Three arguments: two records
+static void BM_LogArgs(benchmark::State &state)
+{
+	Trace::Init();
+	uint32_t arg = 0;
+	for(auto _ : state)
+	{
+		LOG_INFO("Page 0x%08X: %u bytes, %d", arg, arg * 2, -1);
+		arg++;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LogArgs);
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * Benchmarks of USB control endpoint: SETUP requests handling
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <string.h>
+#include "Libs/UsbBase.hpp"
+
+class BenchUsbClass : public Usb::UsbBase
+{
+	uint8_t m_Descriptor[64];
+
+public:
+	BenchUsbClass()
+	{
+		memset(m_Descriptor, 0x5A, sizeof(m_Descriptor));
+		_state = Usb::StateEnum::UNCONNECTED;
+		reset();
+	}
+
+	void sof() override {}
+	uint16_t getMaxPacketSize(uint8_t) override { return 8; }
+	bool setupNonStandartRequest(Usb::EndpointStatusStruct *, Usb::DataPointerStruct *data) override { return data->set(m_Descriptor, 4); }
+	bool getDeviceDescriptor(Usb::DataPointerStruct *data) override { return data->set(m_Descriptor, 18); }
+	bool getConfigDescriptor(Usb::DataPointerStruct *data) override { return data->set(m_Descriptor, sizeof(m_Descriptor)); }
+	bool getStringDescriptor(const uint8_t, const uint16_t, Usb::DataPointerStruct *data) override { return data->set(m_Descriptor, 10); }
+	bool setConfiguration(uint8_t) override { return true; }
+
+	//! SETUP request & IN packets until answer is sent
+	//! @return Packets count
+	unsigned int Request(uint8_t bmRequestType, uint8_t bRequest, uint16_t wValue, uint16_t wLength)
+	{
+		Usb::EndpointStatusStruct ep = { 0, Usb::EndpointStateEnum::WAIT_SETUP };
+		Usb::DeviceRequestStruct request;
+		request.bmRequestType = bmRequestType;
+		request.bRequest = bRequest;
+		request.wValue = wValue;
+		request.wIndex = 0;
+		request.wLength = wLength;
+		Usb::DataPointerStruct data((uint8_t*)&request, sizeof(request));
+		if(!setupRequest(&ep, &data))
+			return 0;
+		unsigned int packets = 0;
+		Usb::DataPointerStruct packet;
+		while(controlEPOutgoingData(&ep, &packet))
+			packets++;
+		return packets;
+	}
+};
+
+//! GET_DESCRIPTOR: range(0) - descriptor type
+static void BM_UsbGetDescriptor(benchmark::State &state)
+{
+	BenchUsbClass usb;
+	const uint16_t wValue = (uint16_t)(state.range(0) << 8);
+	for(auto _ : state)
+		benchmark::DoNotOptimize(usb.Request((uint8_t)Usb::RequestTypeEnum::DIRECTION_DEVICE_TO_HOST, (uint8_t)Usb::StandardRequestsEnum::GET_DESCRIPTOR, wValue, 0xFF));
+}
+BENCHMARK(BM_UsbGetDescriptor)->ArgName("type")->Arg((int)Usb::DescriptorTypesEnum::DEVICE)->Arg((int)Usb::DescriptorTypesEnum::CONFIG);
+
+static void BM_UsbVendorRequest(benchmark::State &state)
+{
+	BenchUsbClass usb;
+	for(auto _ : state)
+		benchmark::DoNotOptimize(usb.Request((uint8_t)Usb::RequestTypeEnum::TYPE_VENDOR, 0x01, 0, 4));
+}
+BENCHMARK(BM_UsbVendorRequest);
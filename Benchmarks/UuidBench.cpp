@@ -0,0 +1,116 @@
+/**
+ * Benchmarks of UUID: compare, hash, map lookup & generation
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include "Libs/UuidMap.hpp"
+#include "Libs/UuidGenerator.hpp"
+
+static const unsigned int MapCapacity = 64;
+
+static System::UuidGeneratorClass<> Generator;
+
+//! Unaligned UUIDs: offset 1
+struct __attribute__((packed)) UnalignedUuidStruct
+{
+	uint8_t Pad;
+	System::UUID Uuid;
+};
+
+//! range(0): 1 - equal UUIDs, 0 - UUIDs differ at the last byte
+static void BM_UuidCompare(benchmark::State &state)
+{
+	UnalignedUuidStruct u1, u2;
+	u1.Uuid = u2.Uuid = Generator.V4();
+	if(!state.range(0))
+		u2.Uuid.Bytes[15] ^= 1;
+	for(auto _ : state)
+	{
+		benchmark::DoNotOptimize(u1);
+		benchmark::DoNotOptimize(System::UUID::IsEqual(&u1.Uuid, &u2.Uuid));
+	}
+}
+BENCHMARK(BM_UuidCompare)->ArgName("equal")->Arg(0)->Arg(1);
+
+static void BM_UuidHash(benchmark::State &state)
+{
+	UnalignedUuidStruct u;
+	u.Uuid = Generator.V4();
+	for(auto _ : state)
+	{
+		benchmark::DoNotOptimize(u);
+		benchmark::DoNotOptimize(u.Uuid.Hash());
+	}
+}
+BENCHMARK(BM_UuidHash);
+
+//! Keys of time-ordered UUIDs: differ by few bits
+static void makeKeys(System::UUID *keys, unsigned int count)
+{
+	for(unsigned int i = 0; i < count; i++)
+		keys[i] = Generator.V7(i);
+}
+
+//! Map lookup; range(0): keys count (load), range(1): 1 - hit, 0 - miss
+static void BM_UuidMapFind(benchmark::State &state)
+{
+	System::UuidMapClass<unsigned int, MapCapacity> map;
+	System::UUID keys[MapCapacity];
+	const unsigned int count = state.range(0);
+	makeKeys(keys, count + 1);
+	for(unsigned int i = 0; i < count; i++)
+		map.Insert(keys[i], i);
+	const bool hit = state.range(1) != 0;
+	unsigned int i = 0;
+	for(auto _ : state)
+	{
+		benchmark::DoNotOptimize(map.Find(keys[hit ? i : count]));
+		i = i + 1 < count ? i + 1 : 0;
+	}
+}
+BENCHMARK(BM_UuidMapFind)->ArgNames({ "keys", "hit" })->ArgsProduct({ { MapCapacity / 4, MapCapacity / 2, MapCapacity * 3 / 4 }, { 0, 1 } });
+
+//! Linear search baseline for @c BM_UuidMapFind
+static void BM_UuidLinearFind(benchmark::State &state)
+{
+	System::UUID keys[MapCapacity];
+	const unsigned int count = state.range(0);
+	makeKeys(keys, count + 1);
+	const bool hit = state.range(1) != 0;
+	unsigned int i = 0;
+	for(auto _ : state)
+	{
+		auto &key = keys[hit ? i : count];
+		unsigned int j = 0;
+		for(; j < count && !(keys[j] == key); j++);
+		benchmark::DoNotOptimize(j);
+		i = i + 1 < count ? i + 1 : 0;
+	}
+}
+BENCHMARK(BM_UuidLinearFind)->ArgNames({ "keys", "hit" })->ArgsProduct({ { MapCapacity / 4, MapCapacity / 2, MapCapacity * 3 / 4 }, { 0, 1 } });
+
+static void BM_UuidParse(benchmark::State &state)
+{
+	System::UUID uuid;
+	for(auto _ : state)
+		benchmark::DoNotOptimize(System::UUID::Parse("b024f2dc-72ea-11e8-858e-2cfda1e1cef5", uuid));
+}
+BENCHMARK(BM_UuidParse);
+
+static void BM_UuidGenerateV4(benchmark::State &state)
+{
+	for(auto _ : state)
+		benchmark::DoNotOptimize(Generator.V4());
+}
+BENCHMARK(BM_UuidGenerateV4);
+
+//! Burst: all UUIDs at the same millisecond
+static void BM_UuidGenerateV7(benchmark::State &state)
+{
+	for(auto _ : state)
+		benchmark::DoNotOptimize(Generator.V7(1000));
+}
+BENCHMARK(BM_UuidGenerateV7);
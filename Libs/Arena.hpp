@@ -0,0 +1,122 @@
+/**
+ * Monotonic arena: bump allocation from static buffer, release by reset
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Allocation is the pointer increment: objects of the arena are not freed one by one,
+ * arena is reset to the mark (scope start) or to the beginning. Destructors are not called on reset.
+ * Arena is not reentrant: use it from one context (message loop) or ISR-local arena.
+ */
+
+/**
+ * @page Arena
+ * @par Usage
+ * @code
+#include "Libs/Arena.hpp"
+
+static System::ArenaBufferClass<1024> Arena;
+
+void request()
+{
+	System::ArenaClass::ScopeClass scope(Arena); // memory is released at scope exit
+	auto buffer = (uint8_t*)Arena.Allocate(256);
+	auto message = Arena.New<MessageStruct>();
+	if(buffer == NULL || message == NULL)
+		return;
+	...
+}
+auto maxUsage = Arena.getHighWater();
+ * @endcode
+ */
+
+#ifndef SRC_LIB_ARENA_HPP_
+#define SRC_LIB_ARENA_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+#include <utility>
+
+namespace System
+{
+	//! Monotonic arena of external buffer
+	class ArenaClass
+	{
+	protected:
+		uint8_t *m_Buffer;
+		size_t m_Size;
+		size_t m_Used;		//!< Allocated bytes (with alignment padding)
+		size_t m_HighWater;	//!< Maximum of allocated bytes
+		uint32_t m_Failures;	//!< Allocations failed: arena is full
+
+	public:
+
+		//! Scope of allocations: arena is reset to the scope start at exit
+		class ScopeClass
+		{
+			ArenaClass &m_Arena;
+			size_t m_Mark;
+
+		public:
+			ScopeClass(ArenaClass &arena) : m_Arena(arena), m_Mark(arena.getMark()) {}
+			~ScopeClass() { m_Arena.Reset(m_Mark); }
+		};
+
+		ArenaClass(void *buffer, size_t size) : m_Buffer((uint8_t*)buffer), m_Size(size), m_Used(0), m_HighWater(0), m_Failures(0) {}
+
+		//! Allocates memory
+		//! @param size		Bytes count
+		//! @param align	Alignment: power of 2
+		//! @return Memory; NULL - arena is full
+		void *Allocate(size_t size, size_t align = 8)
+		{
+			auto offset = ((uintptr_t)m_Buffer + m_Used + align - 1) & ~(uintptr_t)(align - 1);
+			offset -= (uintptr_t)m_Buffer;
+			if(offset > m_Size || size > m_Size - offset)
+			{
+				m_Failures++;
+				return NULL;
+			}
+			m_Used = offset + size;
+			if(m_Used > m_HighWater)
+				m_HighWater = m_Used;
+			return m_Buffer + offset;
+		}
+
+		//! Allocates memory & constructs object
+		//! @return Object; NULL - arena is full
+		template<typename T, typename... ARGS>
+		T *New(ARGS&&... args)
+		{
+			auto memory = Allocate(sizeof(T), alignof(T));
+			return memory == NULL ? NULL : new(memory) T(std::forward<ARGS>(args)...);
+		}
+
+		//! Returns mark of current usage: argument of @c Reset
+		inline size_t getMark() const { return m_Used; }
+
+		//! Releases memory allocated after mark
+		//! @param mark		Mark of @c getMark; 0 - whole arena
+		inline void Reset(size_t mark = 0) { if(mark < m_Used) m_Used = mark; }
+
+		inline size_t getSize() const { return m_Size; }
+		inline size_t getUsed() const { return m_Used; }
+		inline size_t getHighWater() const { return m_HighWater; }
+		inline uint32_t getFailures() const { return m_Failures; }
+	};
+
+	//! Monotonic arena with own buffer
+	//! @param SIZE		Buffer size, bytes
+	template<size_t SIZE>
+	class ArenaBufferClass : public ArenaClass
+	{
+	protected:
+		uint8_t m_Data[SIZE] __attribute__((aligned(8)));
+
+	public:
+		ArenaBufferClass() : ArenaClass(m_Data, SIZE) {}
+	};
+}
+
+#endif /* SRC_LIB_ARENA_HPP_ */
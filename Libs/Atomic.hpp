@@ -0,0 +1,131 @@
+/**
+ * Atomic operations on 32-bit words & flag bytes: safe for ISRs & message loop
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Cortex-M3 and later (& host): exclusive access instructions (LDREX/STREX) by GCC builtins.
+ * Cortex-M0/M0+/M23 have no exclusive access: operation masks interrupts for a few cycles.
+ */
+
+/**
+ * @page Atomic
+ * @par Usage
+ * @code
+#include "Libs/Atomic.hpp"
+
+static uint32_t Counter;
+auto previous = System::Atomic::FetchAdd(&Counter, 1);
+auto expected = System::Atomic::Load(&Counter);
+while(!System::Atomic::CompareExchange(&Counter, expected, expected * 2));
+ * @endcode
+ */
+
+#ifndef SRC_LIB_ATOMIC_HPP_
+#define SRC_LIB_ATOMIC_HPP_
+
+#include <stdint.h>
+
+namespace System
+{
+	namespace Atomic
+	{
+		//! Loads value: acquire
+		inline uint32_t Load(const uint32_t *value)
+		{
+			return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+		}
+
+		//! Stores value: release
+		inline void Store(uint32_t *value, uint32_t desired)
+		{
+			__atomic_store_n(value, desired, __ATOMIC_RELEASE);
+		}
+
+#if defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_8M_BASE__)
+		//! Masks interrupts
+		//! @return Previous mask (PRIMASK)
+		inline uint32_t lock()
+		{
+			uint32_t primask;
+			__asm volatile ("mrs %0, primask\n cpsid i" : "=r" (primask) :: "memory");
+			return primask;
+		}
+
+		//! Restores interrupts mask
+		inline void unlock(uint32_t primask)
+		{
+			__asm volatile ("msr primask, %0" :: "r" (primask) : "memory");
+		}
+
+		//! Adds to value
+		//! @return Previous value
+		inline uint32_t FetchAdd(uint32_t *value, uint32_t add)
+		{
+			auto primask = lock();
+			auto previous = *value;
+			*value = previous + add;
+			unlock(primask);
+			return previous;
+		}
+
+		//! Sets flag byte
+		//! @return Previous value
+		inline uint8_t Exchange(volatile uint8_t *value, uint8_t desired)
+		{
+			auto primask = lock();
+			uint8_t previous = *value;
+			*value = desired;
+			unlock(primask);
+			return previous;
+		}
+
+		//! Sets value to @c desired if it is equal to @c expected
+		//! @param expected		Expected value; current value on failure
+		//! @return True - success
+		inline bool CompareExchange(uint32_t *value, uint32_t &expected, uint32_t desired)
+		{
+			auto primask = lock();
+			auto current = *value;
+			if(current == expected)
+				*value = desired;
+			unlock(primask);
+			if(current == expected)
+				return true;
+			expected = current;
+			return false;
+		}
+#else
+		//! Adds to value
+		//! @return Previous value
+		inline uint32_t FetchAdd(uint32_t *value, uint32_t add)
+		{
+			return __atomic_fetch_add(value, add, __ATOMIC_ACQ_REL);
+		}
+
+		//! Sets flag byte
+		//! @return Previous value
+		inline uint8_t Exchange(volatile uint8_t *value, uint8_t desired)
+		{
+			return __atomic_exchange_n(value, desired, __ATOMIC_ACQ_REL);
+		}
+
+		//! Sets value to @c desired if it is equal to @c expected
+		//! @param expected		Expected value; current value on failure
+		//! @return True - success
+		inline bool CompareExchange(uint32_t *value, uint32_t &expected, uint32_t desired)
+		{
+			return __atomic_compare_exchange_n(value, &expected, desired, true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+		}
+#endif
+
+		//! Raises value to @c candidate if it is less
+		inline void Max(uint32_t *value, uint32_t candidate)
+		{
+			auto current = Load(value);
+			while(current < candidate && !CompareExchange(value, current, candidate));
+		}
+	}
+}
+
+#endif /* SRC_LIB_ATOMIC_HPP_ */
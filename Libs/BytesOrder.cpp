@@ -0,0 +1,125 @@
+/**
+ * Bytes-order conversion module. Bulk arrays conversion kernels
+ *
+ * @date 18/10/2026
+ * @author Viktoria Danchenko
+ */
+
+#include "Libs/BytesOrder.h"
+#include <string.h>
+
+#if defined(__SSSE3__)
+#	include <tmmintrin.h>
+#elif defined(__SSE2__)
+#	include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#	include <arm_neon.h>
+#endif
+
+namespace BytesOrder
+{
+	//! Scalar loop: one load, @c rev/bswap & store per item
+	template<typename T>
+	static inline void swapTail(uint8_t *dst, const uint8_t *src, size_t count)
+	{
+		for(; count > 0; count--, dst += sizeof(T), src += sizeof(T))
+		{
+			T v;
+			memcpy(&v, src, sizeof(v));
+			v = Swap(v);
+			memcpy(dst, &v, sizeof(v));
+		}
+	}
+
+#if defined(__SSSE3__) || defined(__SSE2__)
+	//! Bytes swap of 16 bytes block
+	//! @param SIZE		Item size, bytes
+	template<unsigned int SIZE> static inline __m128i swapBlock(__m128i v);
+
+#	if defined(__SSSE3__)
+	template<> inline __m128i swapBlock<2>(__m128i v) { return _mm_shuffle_epi8(v, _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1)); }
+	template<> inline __m128i swapBlock<4>(__m128i v) { return _mm_shuffle_epi8(v, _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3)); }
+	template<> inline __m128i swapBlock<8>(__m128i v) { return _mm_shuffle_epi8(v, _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7)); }
+#	else
+	template<> inline __m128i swapBlock<2>(__m128i v) { return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)); }
+	template<> inline __m128i swapBlock<4>(__m128i v)
+	{
+		// swap 16-bit halves, then bytes of halves
+		v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+		return swapBlock<2>(v);
+	}
+	template<> inline __m128i swapBlock<8>(__m128i v)
+	{
+		// reverse 16-bit quarters, then bytes of quarters
+		v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+		return swapBlock<2>(v);
+	}
+#	endif
+
+	template<typename T>
+	static inline void swapArray(void *dst, const void *src, size_t count)
+	{
+		auto d = (uint8_t*)dst;
+		auto s = (const uint8_t*)src;
+		for(; count >= 16 / sizeof(T); count -= 16 / sizeof(T), d += 16, s += 16)
+			_mm_storeu_si128((__m128i*)d, swapBlock<sizeof(T)>(_mm_loadu_si128((const __m128i*)s)));
+		swapTail<T>(d, s, count);
+	}
+
+#elif defined(__ARM_NEON)
+	template<unsigned int SIZE> static inline uint8x16_t swapBlock(uint8x16_t v);
+	template<> inline uint8x16_t swapBlock<2>(uint8x16_t v) { return vrev16q_u8(v); }
+	template<> inline uint8x16_t swapBlock<4>(uint8x16_t v) { return vrev32q_u8(v); }
+	template<> inline uint8x16_t swapBlock<8>(uint8x16_t v) { return vrev64q_u8(v); }
+
+	template<typename T>
+	static inline void swapArray(void *dst, const void *src, size_t count)
+	{
+		auto d = (uint8_t*)dst;
+		auto s = (const uint8_t*)src;
+		for(; count >= 16 / sizeof(T); count -= 16 / sizeof(T), d += 16, s += 16)
+			vst1q_u8(d, swapBlock<sizeof(T)>(vld1q_u8(s)));
+		swapTail<T>(d, s, count);
+	}
+
+#else
+	template<typename T>
+	static inline void swapArray(void *dst, const void *src, size_t count)
+	{
+		auto d = (uint8_t*)dst;
+		auto s = (const uint8_t*)src;
+		if(((uintptr_t)d | (uintptr_t)s) % sizeof(uint32_t) == 0)
+		{
+			// aligned arrays // 4 items per loop round
+			auto d32 = (T*)d;
+			auto s32 = (const T*)s;
+			for(; count >= 4; count -= 4, d32 += 4, s32 += 4)
+			{
+				T v0 = s32[0], v1 = s32[1], v2 = s32[2], v3 = s32[3];
+				d32[0] = Swap(v0);
+				d32[1] = Swap(v1);
+				d32[2] = Swap(v2);
+				d32[3] = Swap(v3);
+			}
+			d = (uint8_t*)d32;
+			s = (const uint8_t*)s32;
+		}
+		swapTail<T>(d, s, count);
+	}
+#endif
+
+	void Swap16(void *dst, const void *src, size_t count)
+	{
+		swapArray<uint16_t>(dst, src, count);
+	}
+
+	void Swap32(void *dst, const void *src, size_t count)
+	{
+		swapArray<uint32_t>(dst, src, count);
+	}
+
+	void Swap64(void *dst, const void *src, size_t count)
+	{
+		swapArray<uint64_t>(dst, src, count);
+	}
+}
@@ -3,10 +3,31 @@
  *
  * @date 10/10/2012
  * @author Viktoria Danchenko
+ *
+ * @note C++ part: @c BytesOrder::le<T> & @c BytesOrder::be<T> types and bulk arrays conversion.
+ * @code
+struct _PACKED MessageStruct
+{
+	BytesOrder::be<uint32_t> Id;
+	BytesOrder::le<uint16_t> Len;
+};
+MessageStruct *msg = (MessageStruct*)buffer; // alignment insensible
+uint32_t id = msg->Id; // load & convert
+msg->Len = 10; // convert & store
+msg->Len += 2;
+static constexpr BytesOrder::be<uint32_t> Magic(0xB024F2DC); // compile time conversion
+BytesOrder::Load(values, (const BytesOrder::be<uint32_t>*)buffer, count); // bulk conversion
+ * @endcode
  */
 
+#ifndef SRC_LIB_BYTESORDER_H_
+#define SRC_LIB_BYTESORDER_H_
+
 #ifdef __cplusplus
 #include <stdint.h>
+#include <stddef.h>
+#include <type_traits>
+#include "Libs/Sequence.hpp"
 extern "C" {
 #endif
 
@@ -24,6 +45,12 @@ extern "C" {
 		uint8_t Bytes[4];
 	} uint32_le_t;
 
+	//! Little-endian
+	typedef struct uint64_le_t
+	{
+		uint8_t Bytes[8];
+	} uint64_le_t;
+
 	/**
 	 * Gets value from little-endian
 	 * @param d		Little-endian to convert
@@ -43,7 +70,56 @@ extern "C" {
 	 */
 	inline uint32_t uint32_le_get(uint32_le_t* d)
 	{
-		return (d->Bytes[3] << 24) + (d->Bytes[2] << 16) + (d->Bytes[1] << 8) + d->Bytes[0];
+		return ((uint32_t)d->Bytes[3] << 24) + ((uint32_t)d->Bytes[2] << 16) + ((uint32_t)d->Bytes[1] << 8) + d->Bytes[0];
+	}
+
+	/**
+	 * Gets value from little-endian
+	 * @param d		Little-endian to convert
+	 * @return Converted value
+	 * @note (d) is alignment insensible
+	 */
+	inline uint64_t uint64_le_get(uint64_le_t* d)
+	{
+		return ((uint64_t)uint32_le_get((uint32_le_t*)&d->Bytes[4]) << 32) + uint32_le_get((uint32_le_t*)&d->Bytes[0]);
+	}
+
+	/**
+	 * Sets value to little-endian
+	 * @param d		Little-endian to set
+	 * @param v		Value to convert
+	 * @note (d) is alignment insensible
+	 */
+	inline void uint16_le_set(uint16_le_t* d, uint16_t v)
+	{
+		d->Bytes[0] = (uint8_t)v;
+		d->Bytes[1] = (uint8_t)(v >> 8);
+	}
+
+	/**
+	 * Sets value to little-endian
+	 * @param d		Little-endian to set
+	 * @param v		Value to convert
+	 * @note (d) is alignment insensible
+	 */
+	inline void uint32_le_set(uint32_le_t* d, uint32_t v)
+	{
+		d->Bytes[0] = (uint8_t)v;
+		d->Bytes[1] = (uint8_t)(v >> 8);
+		d->Bytes[2] = (uint8_t)(v >> 16);
+		d->Bytes[3] = (uint8_t)(v >> 24);
+	}
+
+	/**
+	 * Sets value to little-endian
+	 * @param d		Little-endian to set
+	 * @param v		Value to convert
+	 * @note (d) is alignment insensible
+	 */
+	inline void uint64_le_set(uint64_le_t* d, uint64_t v)
+	{
+		uint32_le_set((uint32_le_t*)&d->Bytes[0], (uint32_t)v);
+		uint32_le_set((uint32_le_t*)&d->Bytes[4], (uint32_t)(v >> 32));
 	}
 
 	//! big-endian
@@ -58,6 +134,12 @@ extern "C" {
 		uint8_t Bytes[4];
 	} uint32_be_t;
 
+	//! big-endian
+	typedef struct uint64_be_t
+	{
+		uint8_t Bytes[8];
+	} uint64_be_t;
+
 	/**
 	 * Gets value from big-endian
 	 * @param d		Big-endian to convert
@@ -77,9 +159,265 @@ extern "C" {
 	 */
 	inline uint32_t uint32_be_get(uint32_be_t* d)
 	{
-		return (d->Bytes[0] << 24) + (d->Bytes[1] << 16) + (d->Bytes[2] << 8) + d->Bytes[3];
+		return ((uint32_t)d->Bytes[0] << 24) + ((uint32_t)d->Bytes[1] << 16) + ((uint32_t)d->Bytes[2] << 8) + d->Bytes[3];
+	}
+
+	/**
+	 * Gets value from big-endian
+	 * @param d		Big-endian to convert
+	 * @return Converted value
+	 * @note (d) is alignment insensible
+	 */
+	inline uint64_t uint64_be_get(uint64_be_t* d)
+	{
+		return ((uint64_t)uint32_be_get((uint32_be_t*)&d->Bytes[0]) << 32) + uint32_be_get((uint32_be_t*)&d->Bytes[4]);
+	}
+
+	/**
+	 * Sets value to big-endian
+	 * @param d		Big-endian to set
+	 * @param v		Value to convert
+	 * @note (d) is alignment insensible
+	 */
+	inline void uint16_be_set(uint16_be_t* d, uint16_t v)
+	{
+		d->Bytes[0] = (uint8_t)(v >> 8);
+		d->Bytes[1] = (uint8_t)v;
+	}
+
+	/**
+	 * Sets value to big-endian
+	 * @param d		Big-endian to set
+	 * @param v		Value to convert
+	 * @note (d) is alignment insensible
+	 */
+	inline void uint32_be_set(uint32_be_t* d, uint32_t v)
+	{
+		d->Bytes[0] = (uint8_t)(v >> 24);
+		d->Bytes[1] = (uint8_t)(v >> 16);
+		d->Bytes[2] = (uint8_t)(v >> 8);
+		d->Bytes[3] = (uint8_t)v;
+	}
+
+	/**
+	 * Sets value to big-endian
+	 * @param d		Big-endian to set
+	 * @param v		Value to convert
+	 * @note (d) is alignment insensible
+	 */
+	inline void uint64_be_set(uint64_be_t* d, uint64_t v)
+	{
+		uint32_be_set((uint32_be_t*)&d->Bytes[0], (uint32_t)(v >> 32));
+		uint32_be_set((uint32_be_t*)&d->Bytes[4], (uint32_t)v);
 	}
 
 #ifdef __cplusplus
 }
+
+namespace BytesOrder
+{
+	namespace Detail
+	{
+		//! Bytes of value
+		//! @note Compiler translates the shifts pattern to one load/store & @c rev/bswap instruction
+		template<typename U, unsigned N>
+		struct Bytes
+		{
+			//! Value from little-endian bytes
+			static constexpr U LE(const uint8_t *b) { return ((U)b[N - 1] << (8 * (N - 1))) | Bytes<U, N - 1>::LE(b); }
+			//! Value from big-endian bytes
+			static constexpr U BE(const uint8_t *b) { return ((U)b[N - 1] << (8 * (sizeof(U) - N))) | Bytes<U, N - 1>::BE(b); }
+		};
+
+		template<typename U>
+		struct Bytes<U, 0>
+		{
+			static constexpr U LE(const uint8_t *) { return 0; }
+			static constexpr U BE(const uint8_t *) { return 0; }
+		};
+
+		template<typename T>
+		struct Unsigned
+		{
+			static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "Bytes order: integral or enum type expected");
+			typedef typename std::conditional<sizeof(T) == 1, uint8_t,
+				typename std::conditional<sizeof(T) == 2, uint16_t,
+				typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type>::type>::type Type;
+		};
+	}
+
+	//! Checks is host little-endian
+	static constexpr bool isHostLE() { return __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__; }
+
+	inline uint8_t Swap(uint8_t v) { return v; }
+	inline uint16_t Swap(uint16_t v) { return __builtin_bswap16(v); }
+	inline uint32_t Swap(uint32_t v) { return __builtin_bswap32(v); }
+	inline uint64_t Swap(uint64_t v) { return __builtin_bswap64(v); }
+
+	//! Little-endian value
+	//! @note Alignment insensible. Layout compatible with @c uint16_le_t, @c uint32_le_t, @c uint64_le_t
+	template<typename T>
+	struct __attribute__((packed)) le
+	{
+		typedef T Type;
+		typedef typename Detail::Unsigned<T>::Type UnsignedType;
+
+		uint8_t Bytes[sizeof(T)];
+
+		le() = default;
+		constexpr le(T value) : le(value, typename System::MakeSequence<sizeof(T)>::Type()) {}
+
+		//! Gets value
+		constexpr T get() const { return (T)Detail::Bytes<UnsignedType, sizeof(T)>::LE(Bytes); }
+
+		//! Sets value
+		void set(T value)
+		{
+			for(unsigned int i = 0; i < sizeof(T); i++)
+				Bytes[i] = (uint8_t)((UnsignedType)value >> (8 * i));
+		}
+
+		constexpr operator T() const { return get(); }
+		inline le& operator=(T value) { set(value); return *this; }
+		inline le& operator+=(T value) { set(get() + value); return *this; }
+		inline le& operator-=(T value) { set(get() - value); return *this; }
+		inline le& operator|=(T value) { set(get() | value); return *this; }
+		inline le& operator&=(T value) { set(get() & value); return *this; }
+		inline le& operator^=(T value) { set(get() ^ value); return *this; }
+		inline le& operator++() { return *this += 1; }
+		inline le& operator--() { return *this -= 1; }
+
+	private:
+		template<uint32_t... I>
+		constexpr le(T value, System::Sequence<I...>) : Bytes{ (uint8_t)((UnsignedType)value >> (8 * I))... } {}
+	};
+
+	//! Big-endian value
+	//! @note Alignment insensible. Layout compatible with @c uint16_be_t, @c uint32_be_t, @c uint64_be_t
+	template<typename T>
+	struct __attribute__((packed)) be
+	{
+		typedef T Type;
+		typedef typename Detail::Unsigned<T>::Type UnsignedType;
+
+		uint8_t Bytes[sizeof(T)];
+
+		be() = default;
+		constexpr be(T value) : be(value, typename System::MakeSequence<sizeof(T)>::Type()) {}
+
+		//! Gets value
+		constexpr T get() const { return (T)Detail::Bytes<UnsignedType, sizeof(T)>::BE(Bytes); }
+
+		//! Sets value
+		void set(T value)
+		{
+			for(unsigned int i = 0; i < sizeof(T); i++)
+				Bytes[i] = (uint8_t)((UnsignedType)value >> (8 * (sizeof(T) - 1 - i)));
+		}
+
+		constexpr operator T() const { return get(); }
+		inline be& operator=(T value) { set(value); return *this; }
+		inline be& operator+=(T value) { set(get() + value); return *this; }
+		inline be& operator-=(T value) { set(get() - value); return *this; }
+		inline be& operator|=(T value) { set(get() | value); return *this; }
+		inline be& operator&=(T value) { set(get() & value); return *this; }
+		inline be& operator^=(T value) { set(get() ^ value); return *this; }
+		inline be& operator++() { return *this += 1; }
+		inline be& operator--() { return *this -= 1; }
+
+	private:
+		template<uint32_t... I>
+		constexpr be(T value, System::Sequence<I...>) : Bytes{ (uint8_t)((UnsignedType)value >> (8 * (sizeof(T) - 1 - I)))... } {}
+	};
+
+	//! Bytes swap of array
+	//! @param dst		Array to write to. Can be the same memory as @c src
+	//! @param src		Array to read from
+	//! @param count	Count of items
+	//! @note Arrays are alignment insensible. Vectorized by SSE2/SSSE3/NEON on host, @c rev loop on Cortex-M
+	void Swap16(void *dst, const void *src, size_t count);
+	void Swap32(void *dst, const void *src, size_t count);
+	void Swap64(void *dst, const void *src, size_t count);
+
+	namespace Detail
+	{
+		//! Array of items with size N, bytes
+		template<unsigned N> struct Array;
+
+		template<>
+		struct Array<1>
+		{
+			static inline void Copy(void *dst, const void *src, size_t count) { if(dst != src) __builtin_memmove(dst, src, count); }
+			static inline void Swap(void *dst, const void *src, size_t count) { Copy(dst, src, count); }
+		};
+
+		template<>
+		struct Array<2>
+		{
+			static inline void Copy(void *dst, const void *src, size_t count) { Array<1>::Copy(dst, src, count * 2); }
+			static inline void Swap(void *dst, const void *src, size_t count) { Swap16(dst, src, count); }
+		};
+
+		template<>
+		struct Array<4>
+		{
+			static inline void Copy(void *dst, const void *src, size_t count) { Array<1>::Copy(dst, src, count * 4); }
+			static inline void Swap(void *dst, const void *src, size_t count) { Swap32(dst, src, count); }
+		};
+
+		template<>
+		struct Array<8>
+		{
+			static inline void Copy(void *dst, const void *src, size_t count) { Array<1>::Copy(dst, src, count * 8); }
+			static inline void Swap(void *dst, const void *src, size_t count) { Swap64(dst, src, count); }
+		};
+	}
+
+	//! Converts array to host bytes order
+	//! @param dst		Array to write to
+	//! @param src		Array to read from. Can be the same memory as @c dst
+	//! @param count	Count of items
+	template<typename T>
+	inline void Load(T *dst, const le<T> *src, size_t count)
+	{
+		if(isHostLE())
+			Detail::Array<sizeof(T)>::Copy(dst, src, count);
+		else
+			Detail::Array<sizeof(T)>::Swap(dst, src, count);
+	}
+
+	template<typename T>
+	inline void Load(T *dst, const be<T> *src, size_t count)
+	{
+		if(isHostLE())
+			Detail::Array<sizeof(T)>::Swap(dst, src, count);
+		else
+			Detail::Array<sizeof(T)>::Copy(dst, src, count);
+	}
+
+	//! Converts array from host bytes order
+	//! @param dst		Array to write to
+	//! @param src		Array to read from. Can be the same memory as @c dst
+	//! @param count	Count of items
+	template<typename T>
+	inline void Store(le<T> *dst, const T *src, size_t count)
+	{
+		if(isHostLE())
+			Detail::Array<sizeof(T)>::Copy(dst, src, count);
+		else
+			Detail::Array<sizeof(T)>::Swap(dst, src, count);
+	}
+
+	template<typename T>
+	inline void Store(be<T> *dst, const T *src, size_t count)
+	{
+		if(isHostLE())
+			Detail::Array<sizeof(T)>::Swap(dst, src, count);
+		else
+			Detail::Array<sizeof(T)>::Copy(dst, src, count);
+	}
+}
+
 #endif
+
+#endif /* SRC_LIB_BYTESORDER_H_ */
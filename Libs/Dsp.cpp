@@ -0,0 +1,128 @@
+/**
+ * Signal processing kernels of sample blocks: decimation & averaging of interleaved ADC channels
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include "Libs/Dsp.hpp"
+#include <string.h>
+
+#if defined(__SSE2__)
+#	include <emmintrin.h>
+#elif defined(__ARM_FEATURE_SIMD32)
+#	include <arm_acle.h>
+#endif
+
+namespace Dsp
+{
+	//! Lanes of SIMD sums: lane j is the sum of channel j % channels
+	static const uint32_t Lanes = 8;
+
+	//! Rounded mean of sum
+	static inline uint16_t mean(uint32_t sum, uint32_t count) { return (uint16_t)((sum + count / 2) / count); }
+
+	//! Sums of channels of frames by lanes: sums[c] += sum of lanes j % channels == c
+	static inline void reduce(const uint32_t *lanes, uint32_t lanesCount, uint32_t channels, uint32_t *sums)
+	{
+		for(uint32_t j = 0; j < lanesCount; j++)
+			sums[j % channels] += lanes[j];
+	}
+
+#if defined(__SSE2__)
+	//! Sums of 16-bit lanes of count samples: 8 samples per vector, then the scalar tail
+	//! @return Samples summed by lanes
+	static inline uint32_t sumLanes(const uint16_t *samples, uint32_t count, uint32_t *lanes)
+	{
+		auto zero = _mm_setzero_si128();
+		auto low = zero, high = zero;
+		auto vectors = count / Lanes;
+		for(auto s = samples; vectors > 0;)
+		{
+			auto chunk = vectors < LaneAdditions ? vectors : LaneAdditions;
+			vectors -= chunk;
+			auto packed = zero;
+			for(; chunk > 0; chunk--, s += Lanes)
+				packed = _mm_add_epi16(packed, _mm_loadu_si128((const __m128i*)s));
+			low = _mm_add_epi32(low, _mm_unpacklo_epi16(packed, zero));
+			high = _mm_add_epi32(high, _mm_unpackhi_epi16(packed, zero));
+		}
+		_mm_storeu_si128((__m128i*)lanes, low);
+		_mm_storeu_si128((__m128i*)(lanes + 4), high);
+		return count / Lanes * Lanes;
+	}
+#elif defined(__ARM_FEATURE_SIMD32)
+	//! Sums of 16-bit lanes of count samples: rows of words (two samples of word), word w of row is lanes 2w, 2w + 1
+	//! @return Samples summed by lanes
+	static inline uint32_t sumLanes(const uint16_t *samples, uint32_t count, uint32_t channels, uint32_t *lanes)
+	{
+		auto words = channels > 2 ? channels / 2 : 1;
+		auto rows = count / (words * 2);
+		memset(lanes, 0, Lanes * sizeof(uint32_t));
+		for(auto s = samples; rows > 0;)
+		{
+			auto chunk = rows < LaneAdditions ? rows : LaneAdditions;
+			rows -= chunk;
+			uint32_t packed[Lanes / 2] = { 0 };
+			for(; chunk > 0; chunk--)
+				for(uint32_t w = 0; w < words; w++, s += 2)
+				{
+					uint32_t v;
+					memcpy(&v, s, sizeof(v)); // LDR: unaligned access of Cortex-M4
+					packed[w] = __uadd16(packed[w], v);
+				}
+			for(uint32_t w = 0; w < words; w++)
+			{
+				lanes[w * 2] += packed[w] & 0xFFFF;
+				lanes[w * 2 + 1] += packed[w] >> 16;
+			}
+		}
+		return count / (words * 2) * (words * 2);
+	}
+#endif
+
+	uint32_t DecimateScalar(const uint16_t *samples, uint32_t frames, uint32_t channels, uint32_t factor, uint16_t *out)
+	{
+		if(channels == 0 || factor == 0)
+			return 0;
+		auto outFrames = frames / factor;
+		for(uint32_t f = 0; f < outFrames; f++, samples += factor * channels, out += channels)
+			for(uint32_t c = 0; c < channels; c++)
+			{
+				uint32_t sum = 0;
+				for(uint32_t i = c; i < factor * channels; i += channels)
+					sum += samples[i];
+				out[c] = mean(sum, factor);
+			}
+		return outFrames;
+	}
+
+	uint32_t Decimate(const uint16_t *samples, uint32_t frames, uint32_t channels, uint32_t factor, uint16_t *out)
+	{
+#if defined(__SSE2__) || defined(__ARM_FEATURE_SIMD32)
+		// short groups: reduction of lanes costs more than the scalar sum
+		if(channels == 0 || factor == 0 || Lanes % channels != 0 || factor * channels < 4 * Lanes)
+			return DecimateScalar(samples, frames, channels, factor, out);
+		auto outFrames = frames / factor;
+		auto count = factor * channels;
+		for(uint32_t f = 0; f < outFrames; f++, samples += count, out += channels)
+		{
+			uint32_t lanes[Lanes], sums[Lanes] = { 0 };
+#	if defined(__SSE2__)
+			auto summed = sumLanes(samples, count, lanes);
+#	else
+			auto summed = sumLanes(samples, count, channels, lanes);
+#	endif
+			reduce(lanes, Lanes, channels, sums);
+			// tail starts at the lane 0: sample i is channel i % channels
+			for(auto i = summed; i < count; i++)
+				sums[i % channels] += samples[i];
+			for(uint32_t c = 0; c < channels; c++)
+				out[c] = mean(sums[c], factor);
+		}
+		return outFrames;
+#else
+		return DecimateScalar(samples, frames, channels, factor, out);
+#endif
+	}
+}
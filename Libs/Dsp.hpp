@@ -0,0 +1,70 @@
+/**
+ * Signal processing kernels of sample blocks: decimation & averaging of interleaved ADC channels
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Samples are interleaved frames (one sample of each channel per frame) like ADC scan sequence writes them by DMA.
+ * Decimation by averaging: each output frame is the rounded mean of @c factor input frames of each channel.
+ * Kernels sum packed 16-bit lanes: samples of @c DSP_SAMPLE_BITS bits don't overflow the lane for
+ * 2^(16 - @c DSP_SAMPLE_BITS) additions, then lanes are widened to 32-bit sums.
+ * - Cortex-M4/M7 (DSP extension, @c __ARM_FEATURE_SIMD32): @c UADD16 adds two samples per instruction
+ * - host (SSE2): eight samples per instruction
+ * - else: scalar loop (@c DecimateScalar, reference of the SIMD kernels)
+ * SIMD kernels are used when channels count is 1, 2, 4 or 8 (lane of the sum is the channel) & output frame is the mean
+ * of 32 samples at least (shorter groups: reduction of lanes costs more than the scalar loop).
+ */
+
+/**
+ * @page Dsp
+ * @par Config
+ * @code
+#define DSP_SAMPLE_BITS 12		// ADC resolution: bits of samples, 8..16
+ * @endcode
+ * @par Usage
+ * @code
+#include "Libs/Dsp.hpp"
+
+uint16_t block[256 * 4];	// 256 frames of 4 channels
+uint16_t decimated[16 * 4];
+Dsp::Decimate(block, 256, 4, 16, decimated);	// 16 frames: mean of each 16 frames
+uint16_t mean[4];
+Dsp::Average(block, 256, 4, mean);
+ * @endcode
+ */
+
+#ifndef SRC_LIB_DSP_HPP_
+#define SRC_LIB_DSP_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef DSP_SAMPLE_BITS
+#	define DSP_SAMPLE_BITS 12
+#endif
+
+namespace Dsp
+{
+	static_assert(DSP_SAMPLE_BITS >= 8 && DSP_SAMPLE_BITS <= 16, "Dsp: DSP_SAMPLE_BITS must be 8..16");
+
+	//! Additions of samples to the 16-bit lane without overflow
+	static const uint32_t LaneAdditions = 1u << (16 - DSP_SAMPLE_BITS);
+
+	//! Decimation by averaging: output frame is the rounded mean of @c factor input frames of each channel
+	//! @param samples	Interleaved input frames: frames * channels samples
+	//! @param frames	Input frames count: multiple of factor (the rest is ignored)
+	//! @param channels	Channels count: 1..
+	//! @param factor	Decimation factor: 1..
+	//! @param out		Interleaved output frames: frames / factor * channels samples
+	//! @return Output frames count
+	uint32_t Decimate(const uint16_t *samples, uint32_t frames, uint32_t channels, uint32_t factor, uint16_t *out);
+
+	//! Scalar kernel of @c Decimate: reference of SIMD kernels
+	uint32_t DecimateScalar(const uint16_t *samples, uint32_t frames, uint32_t channels, uint32_t factor, uint16_t *out);
+
+	//! Rounded mean of all the frames of each channel
+	//! @param out		Mean of channels: channels samples
+	inline void Average(const uint16_t *samples, uint32_t frames, uint32_t channels, uint16_t *out) { Decimate(samples, frames, channels, frames, out); }
+}
+
+#endif /* SRC_LIB_DSP_HPP_ */
@@ -0,0 +1,104 @@
+/**
+ * Linker table: registry of entries collected by linker into one section
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Entries are declared by @c PORT_TABLE_ENTRY in any translation unit: linker places them one by one
+ * into section, so the section is the array of entries between begin & end symbols (see Port/Port.h).
+ * Entry of @c PORT_TABLE_ENTRY_PRIORITY goes into @c .<section>.<priority> subsection: linker script sorts
+ * subsections by name, so entries are ordered at link time (00 - first) and entries without priority follow them.
+ * No registration code & no sort at run time.
+ */
+
+/**
+ * @page LinkerTable
+ * @par Linker script sections:
+ * @code
+SECTIONS
+{
+	.handlers :
+	{
+		. = ALIGN(4);
+		PROVIDE(_Handlers_Table_Begin = .);
+		KEEP(*(SORT_BY_NAME(.handlers.*)))
+		KEEP(*(.handlers))
+		PROVIDE(_Handlers_Table_End = .);
+	} >FLASH
+}
+ * @endcode
+ * Host (Linux) build: section is @c handlers; prioritized tables are listed in Port/Host/Tables.ld.
+ * @par Usage
+ * Module .h file:
+ * @code
+#include "Libs/LinkerTable.hpp"
+
+struct HandlerStruct
+{
+	uint8_t Command;
+	void (*Handler)(const uint8_t *data);
+};
+
+#define HANDLER_DECLARE(name, command, priority) \
+	static const HandlerStruct _Handler_##name PORT_TABLE_ENTRY_PRIORITY(handlers, HandlerStruct, priority) = { command, &name };
+
+extern "C"
+{
+#ifdef PORT_HOST
+#	define _Handlers_Table_Begin PORT_SECTION_BEGIN(handlers)
+#	define _Handlers_Table_End PORT_SECTION_END(handlers)
+#endif
+	extern unsigned char _Handlers_Table_Begin[] PORT_LINKER_SYMBOL;
+	extern unsigned char _Handlers_Table_End[] PORT_LINKER_SYMBOL;
+}
+
+typedef System::LinkerTable<const HandlerStruct, _Handlers_Table_Begin, _Handlers_Table_End> HandlersTable;
+ * @endcode
+ * Module .cpp file:
+ * @code
+HANDLER_DECLARE(Reset, 0x01, 10)
+
+for(auto &handler : HandlersTable())
+	if(handler.Command == command)
+		handler.Handler(data);
+auto index = HandlersTable::IndexOf(&handler);
+ * @endcode
+ */
+
+#ifndef SRC_LIB_LINKERTABLE_HPP_
+#define SRC_LIB_LINKERTABLE_HPP_
+
+#include <stddef.h>
+#include "Port/Port.h"
+
+namespace System
+{
+	//! Linker table
+	//! @param T		Entry type: const for table of FLASH
+	//! @param BEGIN	Linker symbol: first byte of table
+	//! @param END		Linker symbol: first byte after table
+	template<typename T, unsigned char *BEGIN, unsigned char *END>
+	struct LinkerTable
+	{
+		typedef T Entry;
+		typedef T *iterator;
+
+		static inline T *begin() { return (T*)BEGIN; }
+		static inline T *end() { return (T*)END; }
+
+		//! Entries count
+		static inline size_t size() { return end() - begin(); }
+		static inline bool empty() { return begin() == end(); }
+
+		//! Entry by index
+		static inline T &At(size_t index) { return begin()[index]; }
+
+		//! Index of entry
+		static inline size_t IndexOf(const T *entry) { return entry - begin(); }
+
+		//! @return True - entry of the table
+		static inline bool Contains(const T *entry) { return entry >= begin() && entry < end(); }
+	};
+}
+
+#endif /* SRC_LIB_LINKERTABLE_HPP_ */
@@ -0,0 +1,180 @@
+/**
+ * Deferred binary logging: format string ID & raw arguments into the trace ring
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Log call doesn't format the message on target. Format string (with level & source location) is the entry of dictionary:
+ * own @c .logstr.<n> section of ELF file. Message ID is 32-bit FNV-1a hash of the entry, calculated at compile time.
+ * Log record holds ID & arguments as 32-bit words: one trace record for ID & first argument plus @c Data trace record
+ * per each two next arguments. So the call costs timestamp, one slot reservation & a few stores; format strings take
+ * no FLASH: @c .logstr is not loaded to device (INFO section of linker script).
+ * Tools/trace_decode.py reads dictionary sections of ELF file & formats the messages.
+ * Own section per entry: entries of inline & template functions (COMDAT) and of ordinary functions can't share section.
+ * Arguments: integral & enum (64-bit takes two words), pointer (32 bits), float & double (sent as float).
+ * @c %s prints the pointer only: strings of RAM are not available on host.
+ * Log is compiled out with trace (@c TRACE_BUFFER_SIZE is not defined) or by level (@c LOG_LEVEL).
+ */
+
+/**
+ * @page Log
+ * @par Config
+ * Compiler flags:
+ * @code
+-DTRACE_BUFFER_SIZE=256 -DLOG_LEVEL=3 // log level: 1 - errors ... 4 - debug; default 3 - info
+ * @endcode
+ * Linker script: dictionary section is not loaded
+ * @code
+.logstr 0 (INFO) : { KEEP(*(.logstr.*)) }
+ * @endcode
+ * @par Usage
+ * @code
+#include "Libs/Log.hpp"
+
+LOG_INFO("USB configured: %u mA", power * 2);
+LOG_ERROR("Page 0x%08X CRC: %04X != %04X", address, crc, expectedCrc);
+LOG_DEBUG("Time: %lld uS, level %.2f", time64, level);
+ * @endcode
+ * Host:
+ * @code
+python3 Tools/trace_decode.py dump.bin --elf firmware.elf --text
+ * @endcode
+ */
+
+#ifndef SRC_LIB_LOG_HPP_
+#define SRC_LIB_LOG_HPP_
+
+#include "Libs/Trace.hpp"
+
+#ifndef LOG_LEVEL
+#	define LOG_LEVEL 3
+#endif
+
+namespace Log
+{
+	//! Message level
+	enum LevelEnum
+	{
+		Error = 1,
+		Warning = 2,
+		Info = 3,
+		Debug = 4,
+	};
+}
+
+#ifdef TRACE_BUFFER_SIZE
+
+#include <string.h>
+#include <type_traits>
+
+namespace Log
+{
+	//! Message ID: FNV-1a hash of dictionary entry
+	constexpr uint32_t Hash(const char *entry, uint32_t hash = 2166136261u)
+	{
+		return *entry == 0 ? hash : Hash(entry + 1, (hash ^ (uint8_t)*entry) * 16777619u);
+	}
+
+	//! Argument conversion to 32-bit words: integral, enum
+	template<typename T, int CLASS = std::is_floating_point<T>::value ? 1 : std::is_pointer<T>::value ? 2 : 0>
+	struct Arg
+	{
+		static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "Log argument must be integral, enum, pointer or floating point");
+		static const unsigned Words = sizeof(T) > 4 ? 2 : 1;
+
+		static inline void Put(uint32_t *&words, T value)
+		{
+			*words++ = (uint32_t)value;
+			if(Words == 2)
+				*words++ = (uint32_t)((uint64_t)value >> 16 >> 16);
+		}
+	};
+
+	//! Floating point: sent as float
+	template<typename T>
+	struct Arg<T, 1>
+	{
+		static const unsigned Words = 1;
+
+		static inline void Put(uint32_t *&words, T value)
+		{
+			float f = (float)value;
+			memcpy(words++, &f, sizeof(f));
+		}
+	};
+
+	//! Pointer: low 32 bits
+	template<typename T>
+	struct Arg<T, 2>
+	{
+		static const unsigned Words = 1;
+
+		static inline void Put(uint32_t *&words, T value) { *words++ = (uint32_t)(uintptr_t)value; }
+	};
+
+	//! Words count of arguments
+	template<typename... ARGS>
+	struct Words
+	{
+		static const unsigned Count = 0;
+	};
+
+	template<typename T, typename... ARGS>
+	struct Words<T, ARGS...>
+	{
+		static const unsigned Count = Arg<T>::Words + Words<ARGS...>::Count;
+	};
+
+	//! Writes log records
+	//! @param id	Message ID
+	//! @note Trace event: @c Trace::Log + arguments words count
+	template<typename... ARGS>
+	inline void Write(uint32_t id, ARGS... args)
+	{
+		static const unsigned count = Words<ARGS...>::Count;
+		static_assert(count <= 0xFF, "Too many log arguments");
+		static const unsigned records = (count + 2) / 2; // ID & arguments: two words per record
+		uint32_t words[count + 2];
+		words[0] = id;
+		words[count + 1] = 0;
+		uint32_t *next = words + 1;
+		int put[] = { 0, (Arg<ARGS>::Put(next, args), 0)... };
+		(void)put;
+		(void)next;
+
+		auto timestamp = TRACE_TIMESTAMP();
+		auto isr = Trace::isrFlag();
+		auto index = Trace::Reserve(records);
+		Trace::Write(index, Trace::Log + count, (uint8_t)Trace::KindEnum::Instant | isr, timestamp, words[0], words[1]);
+		for(unsigned i = 1; i < records; i++)
+			Trace::Write(index + i, Trace::Log + count, (uint8_t)Trace::KindEnum::Data | isr, timestamp, words[i * 2], words[i * 2 + 1]);
+	}
+}
+
+#define _LOG_STRING2(x) #x
+#define _LOG_STRING(x) _LOG_STRING2(x)
+#define _LOG_ENTRY(level, format) #level "\x1F" __FILE__ ":" _LOG_STRING(__LINE__) "\x1F" format
+
+//! Message of level: format string & arguments
+//! @note Dictionary entry: "<level>\x1F<file>:<line>\x1F<format>"
+#define LOG(level, format, ...) do { \
+	if(Log::level <= LOG_LEVEL) \
+	{ \
+		static const char _LogEntry[] __attribute__((section(".logstr." _LOG_STRING(__COUNTER__)), used)) = _LOG_ENTRY(level, format); \
+		Log::Write(std::integral_constant<uint32_t, Log::Hash(_LOG_ENTRY(level, format))>::value, ##__VA_ARGS__); \
+	} \
+} while(0)
+
+#else
+
+// log is disabled: arguments are not evaluated
+#define LOG(level, format, ...) do {} while(0)
+
+#endif
+
+#define LOG_ERROR(format, ...) LOG(Error, format, ##__VA_ARGS__)
+#define LOG_WARNING(format, ...) LOG(Warning, format, ##__VA_ARGS__)
+#define LOG_INFO(format, ...) LOG(Info, format, ##__VA_ARGS__)
+#define LOG_DEBUG(format, ...) LOG(Debug, format, ##__VA_ARGS__)
+
+#endif /* SRC_LIB_LOG_HPP_ */
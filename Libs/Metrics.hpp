@@ -0,0 +1,265 @@
+/**
+ * Metrics registry: counters, gauges & fixed-bucket histograms with compact binary export
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Metrics declared by @c METRICS_COUNTER, @c METRICS_GAUGE, @c METRICS_HISTOGRAM in any translation unit are collected
+ * by linker into @c .metrics table (FLASH): name, type & bucket bounds are constant, values are the static RAM array of metric.
+ * No registration code & no heap. Counter/gauge update is one atomic add (store for gauge set): safe for ISRs & message loop.
+ * Histogram observation is the search of bucket (bounds are ascending, value <= bound) & two atomic adds: bucket & sum.
+ * Snapshot is the binary export of all the values: header & varint of each value, full (absolute values) or delta
+ * (zigzag difference to the previous snapshot: counters changes are small, so bytes count is about the metrics count).
+ * Varint & zigzag are the ones of the time series codec (Libs/TimeSeriesCodec.hpp): one wire encoding of values.
+ * Schema (names, types, bounds) is exported separately once; its hash is the part of snapshot header.
+ * Host (Tools/metrics_decode.py) accumulates snapshots & prints Prometheus text format; counters don't wrap on host.
+ * Deltas are consumed by one host: sequence number gap requests the full snapshot.
+ */
+
+/**
+ * @page Metrics
+ * @par Linker script sections:
+ * - Metrics table (ROM, FLASH)
+ * @code
+SECTIONS
+{
+	.metrics :
+	{
+		. = ALIGN(4);
+		PROVIDE(_Metrics_Table_Begin = .);
+		KEEP(*(.metrics .metrics.*))
+		PROVIDE(_Metrics_Table_End = .);
+	} >FLASH
+}
+ * @endcode
+ * Host (Linux) build needs no linker script: section is @c metrics (see Port/Port.h).
+ * @par Usage
+ * @code
+#include "Libs/Metrics.hpp"
+
+METRICS_COUNTER(usb_requests_total)
+METRICS_GAUGE(queue_depth)
+METRICS_HISTOGRAM(flush_duration_us, 100, 1000, 10000)
+
+METRIC(usb_requests_total)->Add();
+METRIC(queue_depth)->Set(depth);
+METRIC(flush_duration_us)->Observe(uS);
+
+// export: USB vendor request (see Usb::Cdc::setupVendorRequest), wValue - Metrics::ExportEnum
+static uint8_t Buffer[256];
+auto len = Metrics::Export((Metrics::ExportEnum)ActiveSetupRequest.wValue.get(), Buffer, sizeof(Buffer));
+return len != 0 && data->set(Buffer, len);
+ * @endcode
+ * Host:
+ * @code
+python3 Tools/metrics_decode.py schema.bin snapshot1.bin snapshot2.bin # Prometheus text format
+ * @endcode
+ */
+
+#ifndef SRC_LIB_METRICS_HPP_
+#define SRC_LIB_METRICS_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Port/Port.h"
+#include "Libs/LinkerTable.hpp"
+#include "Libs/Atomic.hpp"
+#include "Libs/TimeSeriesCodec.hpp"
+
+//! Declares counter: monotonic, wraps at 2^32 (host accumulates)
+//! @param name		Metric name: C identifier, Prometheus name
+#define METRICS_COUNTER(name)\
+	static Metrics::ValueStruct _MetricValues_##name[1];\
+	static const Metrics::MetricStruct PORT_TABLE_ENTRY(metrics, Metrics::MetricStruct) _Metric_##name = { #name, Metrics::TypeEnum::Counter, 0, NULL, _MetricValues_##name };
+
+//! Declares gauge: signed 32-bit value
+//! @param name		Metric name: C identifier, Prometheus name
+#define METRICS_GAUGE(name)\
+	static Metrics::ValueStruct _MetricValues_##name[1];\
+	static const Metrics::MetricStruct PORT_TABLE_ENTRY(metrics, Metrics::MetricStruct) _Metric_##name = { #name, Metrics::TypeEnum::Gauge, 0, NULL, _MetricValues_##name };
+
+//! Declares histogram
+//! @param name		Metric name: C identifier, Prometheus name
+//! @param bounds	Upper bounds of buckets: ascending, 1..32 values; overflow bucket is added
+#define METRICS_HISTOGRAM(name, bounds...)\
+	static const uint32_t _MetricBounds_##name[] = { bounds };\
+	static_assert(sizeof(_MetricBounds_##name) / sizeof(uint32_t) <= 32, "Histogram buckets count must be 1..32");\
+	static Metrics::ValueStruct _MetricValues_##name[sizeof(_MetricBounds_##name) / sizeof(uint32_t) + 2];\
+	static const Metrics::MetricStruct PORT_TABLE_ENTRY(metrics, Metrics::MetricStruct) _Metric_##name =\
+		{ #name, Metrics::TypeEnum::Histogram, sizeof(_MetricBounds_##name) / sizeof(uint32_t), _MetricBounds_##name, _MetricValues_##name };
+
+//! Metric pointer
+#define METRIC(name) (&_Metric_##name)
+
+extern "C"
+{
+#ifdef PORT_HOST
+#	define _Metrics_Table_Begin PORT_SECTION_BEGIN(metrics)
+#	define _Metrics_Table_End PORT_SECTION_END(metrics)
+#endif
+	extern unsigned char _Metrics_Table_Begin[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte of array
+	extern unsigned char _Metrics_Table_End[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte after array
+}
+
+namespace Metrics
+{
+	//! Metric type
+	//! @note Values are the part of schema format
+	enum class TypeEnum : uint8_t { Counter = 1, Gauge = 2, Histogram = 3 };
+
+	//! Export kind: USB vendor request wValue e.t.c.
+	//! @note Values are the part of export format
+	enum class ExportEnum : uint8_t { Delta = 0, Full = 1, Schema = 2 };
+
+	static const uint8_t Version = 1;	//!< Export format version
+	static const size_t HeaderSize = 8;	//!< Export header: kind, version, sequence (LE16), schema hash (LE32)
+
+	//! Value of metric
+	struct ValueStruct
+	{
+		uint32_t Value;
+		uint32_t Exported;	//!< Value of the last snapshot: base of delta
+	};
+
+	//! Metric of table
+	struct MetricStruct
+	{
+		const char *Name;
+		TypeEnum Type;
+		uint8_t Buckets;		//!< Histogram buckets count (without overflow bucket)
+		const uint32_t *Bounds;	//!< Histogram upper bounds of buckets
+		ValueStruct *Values;	//!< Counter, gauge: one value; histogram: buckets, overflow bucket, sum
+
+		//! Values count
+		inline unsigned int size() const { return Type == TypeEnum::Histogram ? Buckets + 2 : 1; }
+
+		//! Counter, gauge: adds
+		inline void Add(uint32_t value = 1) const { System::Atomic::FetchAdd(&Values[0].Value, value); }
+
+		//! Gauge: sets
+		inline void Set(int32_t value) const { System::Atomic::Store(&Values[0].Value, (uint32_t)value); }
+
+		//! Histogram: adds observation
+		inline void Observe(uint32_t value) const
+		{
+			unsigned int i = 0;
+			while(i < Buckets && value > Bounds[i])
+				i++;
+			System::Atomic::FetchAdd(&Values[i].Value, 1);
+			System::Atomic::FetchAdd(&Values[Buckets + 1].Value, value);
+		}
+
+		//! Counter, gauge: value; histogram: bucket count (index == Buckets - overflow bucket) or sum (index == Buckets + 1)
+		inline uint32_t Get(unsigned int index = 0) const { return System::Atomic::Load(&Values[index].Value); }
+	};
+
+	//! Metrics declared by @c METRICS_COUNTER, @c METRICS_GAUGE, @c METRICS_HISTOGRAM
+	typedef System::LinkerTable<const MetricStruct, _Metrics_Table_Begin, _Metrics_Table_End> MetricsTable;
+
+	//! Writer of export buffer
+	struct WriterStruct
+	{
+		uint8_t *Data;
+		size_t Size;
+		size_t Len;
+
+		inline bool put(uint8_t byte)
+		{
+			if(Len >= Size)
+				return false;
+			Data[Len++] = byte;
+			return true;
+		}
+
+		inline bool le(uint32_t value, unsigned int bytes)
+		{
+			for(unsigned int i = 0; i < bytes; i++, value >>= 8)
+				if(!put((uint8_t)value))
+					return false;
+			return true;
+		}
+
+		//! Unsigned LEB128 of the time series codec
+		inline bool varint(uint32_t value)
+		{
+			auto len = System::Codec::VarIntWrite(&Data[Len], Size - Len, value);
+			Len += len;
+			return len != 0;
+		}
+	};
+
+	//! FNV-1a of schema: names, types & bounds
+	inline uint32_t SchemaHash()
+	{
+		uint32_t hash = 2166136261u;
+		auto add = [&hash](uint8_t byte) { hash = (hash ^ byte) * 16777619u; };
+		for(auto &metric : MetricsTable())
+		{
+			for(auto p = metric.Name; *p != 0; p++)
+				add(*p);
+			add((uint8_t)metric.Type);
+			for(unsigned int i = 0; i < metric.Buckets; i++)
+				for(unsigned int b = 0; b < 32; b += 8)
+					add((uint8_t)(metric.Bounds[i] >> b));
+		}
+		return hash;
+	}
+
+	//! Sequence number of snapshots
+	inline uint16_t &sequence()
+	{
+		static uint16_t value;
+		return value;
+	}
+
+	//! Exports metrics
+	//! @param kind		Delta: differences to previous snapshot; full: values; schema: names, types & bounds
+	//! @param buffer	Export buffer
+	//! @param size		Buffer size, bytes
+	//! @return Export length, bytes; 0 - buffer is too small (host gets sequence gap)
+	//! @note Format (little endian): kind (1), version (1), sequence (2), schema hash (4);
+	//! snapshot: varint of each value in table order (delta: zigzag of signed 32-bit difference);
+	//! schema: for each metric: type (1), buckets count (1), name length (1), name, bounds (4 each)
+	inline size_t Export(ExportEnum kind, uint8_t *buffer, size_t size)
+	{
+		WriterStruct out = { buffer, size, 0 };
+		auto seq = kind == ExportEnum::Schema ? sequence() : (uint16_t)(sequence() + 1);
+		if(!out.put((uint8_t)kind) || !out.put(Version) || !out.le(seq, 2) || !out.le(SchemaHash(), 4))
+			return 0;
+		if(kind == ExportEnum::Schema)
+		{
+			for(auto &metric : MetricsTable())
+			{
+				size_t len = 0;
+				while(metric.Name[len] != 0 && len < 255)
+					len++;
+				if(!out.put((uint8_t)metric.Type) || !out.put(metric.Buckets) || !out.put((uint8_t)len))
+					return 0;
+				for(size_t i = 0; i < len; i++)
+					if(!out.put(metric.Name[i]))
+						return 0;
+				for(unsigned int i = 0; i < metric.Buckets; i++)
+					if(!out.le(metric.Bounds[i], 4))
+						return 0;
+			}
+			return out.Len;
+		}
+		for(auto &metric : MetricsTable())
+			for(unsigned int i = 0; i < metric.size(); i++)
+			{
+				auto &value = metric.Values[i];
+				auto current = System::Atomic::Load(&value.Value);
+				auto delta = (int32_t)(current - value.Exported);
+				value.Exported = current; // base of the next delta is exactly the exported value
+				if(!(kind == ExportEnum::Full ? out.varint(current) : out.varint(System::Codec::ZigZagEncode((uint32_t)delta))))
+				{
+					sequence() = seq; // delta base is changed partially: sequence gap requests full snapshot
+					return 0;
+				}
+			}
+		sequence() = seq;
+		return out.Len;
+	}
+}
+
+#endif /* SRC_LIB_METRICS_HPP_ */
@@ -16,6 +16,9 @@
 #define SRC_LIB_PAGECACHECLASS_HPP_
 
 #include <algorithm>
+#include <string.h>
+#include "Libs/Probe.hpp"
+#include "Libs/Trace.hpp"
 
 namespace System
 {
@@ -91,8 +94,10 @@ namespace System
 			//! @param callback	Used to callback before flush the cache; callback happens in case of dirty status only
 			bool Flush(PreFlushCallbackStruct *callback=nullptr)
 			{
+				PROBE_SCOPE(Probe::PageCacheFlush);
 				if(m_Status == StatusEnum::Dirty)
 				{
+					TRACE_SCOPE(Trace::PageCacheFlush, m_Address);
 					if(callback != nullptr && callback->Callback != nullptr)
 						callback->Callback(m_Buffer, m_Address, sizeof(m_Buffer), callback->arg);
 					if(!Write(m_Buffer, m_Address, sizeof(m_Buffer)))
@@ -110,6 +115,8 @@ namespace System
 			//! @note This procedure can cause a series of @c Flush calls
 			bool SetData(const void *data, ADDRESS_TYPE address, unsigned int len, PreFlushCallbackStruct *callback=nullptr)
 			{
+				PROBE_SCOPE(Probe::PageCacheSetData);
+				TRACE_EVENT(Trace::PageCacheSetData, address, len);
 				do
 				{
 					if((address % PAGE_SIZE) == 0 && len >= PAGE_SIZE)
@@ -151,6 +158,8 @@ namespace System
 			//! @param len		Read length, bytes
 			bool GetData(void *data, ADDRESS_TYPE address, unsigned int len)
 			{
+				PROBE_SCOPE(Probe::PageCacheGetData);
+				TRACE_EVENT(Trace::PageCacheGetData, address, len);
 				do
 				{
 					auto restPageSize = PAGE_SIZE - (address % PAGE_SIZE);
@@ -20,6 +20,8 @@
 #define SRC_LIB_PERSISTENTSTORAGE_HPP_
 
 #include "UUID.hpp"
+#include "Libs/WireLayout.hpp"
+#include "Libs/Trace.hpp"
 #include <string.h>
 
 namespace System
@@ -37,7 +39,28 @@ namespace System
 			CRC_TYPE StorageCrc;	//!< CRC of the persistent storage (excluding header)
 		} __attribute__((packed));
 
-		static const System::UUID StorageUUID = { 0xB0, 0x24, 0xF2, 0xDC, 0x72, 0xEA, 0x11, 0xE8, 0x85, 0x8E, 0x2C, 0xFD, 0xA1, 0xE1, 0xCE, 0xF5 };
+		//! Aligned version of @c StorageHeaderStruct metrics
+		template <typename ADDRESS_TYPE, typename CRC_TYPE>
+		struct StorageHeaderMetricsStruct
+		{
+			ADDRESS_TYPE Length;	//!< Length of the persistent storage (excluding storage header, client data only), bytes
+			CRC_TYPE StorageCrc;	//!< CRC of the persistent storage (excluding header)
+		};
+
+		//! Wire layout of @c StorageHeaderStruct
+		template <typename ADDRESS_TYPE, typename CRC_TYPE>
+		struct StorageHeaderLayout
+		{
+			typedef StorageHeaderMetricsStruct<ADDRESS_TYPE, CRC_TYPE> Metrics;
+			typedef Wire::Bytes<sizeof(System::UUID), 0> UuidField;
+			typedef Wire::Bytes<sizeof(System::UUID), 1> DataUuidField;
+			typedef WIRE_FIELD(Metrics, Length) LengthField;
+			typedef WIRE_FIELD(Metrics, StorageCrc) CrcField;
+			typedef Wire::Layout<Metrics, UuidField, DataUuidField, LengthField, CrcField> Type;
+			static_assert(Type::Size == sizeof(StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>), "Storage header layout mismatch");
+		};
+
+		static constexpr System::UUID StorageUUID = System::UUID::Parse("b024f2dc-72ea-11e8-858e-2cfda1e1cef5");
 
 		template <typename ADDRESS_TYPE, typename CRC_TYPE>
 		class StorageReaderClass
@@ -45,6 +68,8 @@ namespace System
 		public:
 			enum class StorageCheckEnum { Ok, NoStorage, AnotherStorage, DeviceError, StorageError };
 		protected:
+			typedef StorageHeaderLayout<ADDRESS_TYPE, CRC_TYPE> Header;
+			typedef typename Header::Type HeaderLayout;
 
 			//! Compare device data with pattern
 			//! @param pattern	Data pattern to compare
@@ -65,12 +90,31 @@ namespace System
 
 			inline bool getLength(ADDRESS_TYPE address, ADDRESS_TYPE &length) const
 			{
-				return Read(&length, address + (decltype(address))&(((StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>*)0)->Length), sizeof(length));
+				uint8_t field[Header::LengthField::Size];
+				if(!Read(field, address + HeaderLayout::template OffsetOf<typename Header::LengthField>(), sizeof(field)))
+					return false;
+				length = Header::LengthField::Get(field);
+				return true;
 			}
 
 			inline bool getCrc(ADDRESS_TYPE address, CRC_TYPE &crc) const
 			{
-				return Read(&crc, address + (decltype(address))&(((StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>*)0)->StorageCrc), sizeof(crc));
+				uint8_t field[Header::CrcField::Size];
+				if(!Read(field, address + HeaderLayout::template OffsetOf<typename Header::CrcField>(), sizeof(field)))
+					return false;
+				crc = Header::CrcField::Get(field);
+				return true;
+			}
+
+			//! Reads length & CRC by one device read
+			bool getMetrics(ADDRESS_TYPE address, typename Header::Metrics &metrics) const
+			{
+				uint8_t header[HeaderLayout::Size];
+				const auto offset = HeaderLayout::template OffsetOf<typename Header::LengthField>();
+				if(!Read(&header[offset], address + offset, sizeof(header) - offset))
+					return false;
+				HeaderLayout::Decode(metrics, header);
+				return true;
 			}
 
 			ADDRESS_TYPE m_Address; //!< Address into the device space
@@ -89,16 +133,13 @@ namespace System
 				if(!Compare(&StorageUUID, address, sizeof(StorageUUID)))
 					return StorageCheckEnum::NoStorage; // wrong storage UUID
 				// check persistent data UUID
-				if(!Compare(&uuid, address + (decltype(address))&(((StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>*)0)->DataUuid), sizeof(uuid)))
+				if(!Compare(&uuid, address + HeaderLayout::template OffsetOf<typename Header::DataUuidField>(), sizeof(uuid)))
 					return StorageCheckEnum::AnotherStorage; // wrong data UUID
 				// compare CRC from storage header and calculated CRC
-				decltype(StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>::Length) len;
-				decltype(StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>::StorageCrc) crc;
-				if(!getLength(address, len))
+				typename Header::Metrics metrics;
+				if(!getMetrics(address, metrics))
 					return StorageCheckEnum::DeviceError; // device error
-				if(!getCrc(address, crc))
-					return StorageCheckEnum::DeviceError; // device error
-				if(crc == CalculateCRC(address + sizeof(StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>), len))
+				if(metrics.StorageCrc == CalculateCRC(address + HeaderLayout::Size, metrics.Length))
 				{
 					m_Address = address;
 					return StorageCheckEnum::Ok;
@@ -113,7 +154,7 @@ namespace System
 			bool GetData(void *data, unsigned int len, unsigned int offset=0) const
 			{
 				// check out of data bound
-				decltype(StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>::Length) dataLength;
+				ADDRESS_TYPE dataLength;
 				if(!getLength(m_Address, dataLength))
 					return false; // device error
 				if(len + offset > dataLength)
@@ -126,6 +167,8 @@ namespace System
 		class StorageWriterClass
 		{
 		protected:
+			typedef StorageHeaderLayout<ADDRESS_TYPE, CRC_TYPE> Header;
+			typedef typename Header::Type HeaderLayout;
 
 			//! Write data to device
 			//! @param data		Buffer to write from
@@ -147,22 +190,21 @@ namespace System
 			//! @param crc		Storage CRC
 			bool SetData(const void *data, unsigned int len, CRC_TYPE crc) const
 			{
-				// check out of data bound
-				if(!Write(&StorageUUID, sizeof(StorageUUID), m_Address))
-					return false; // device error
-				if(!Write(&m_Uuid, sizeof(m_Uuid), m_Address + (decltype(m_Address))&(((StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>*)0)->DataUuid)))
-					return false; // device error
-				if(!Write(&len, sizeof(len), m_Address + (decltype(m_Address))&(((StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>*)0)->Length)))
-					return false; // device error
-				if(!Write(&crc, sizeof(crc), m_Address + (decltype(m_Address))&(((StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>*)0)->StorageCrc)))
+				// header
+				uint8_t header[HeaderLayout::Size];
+				const typename Header::Metrics metrics = { (ADDRESS_TYPE)len, crc };
+				Header::UuidField::Set(&header[HeaderLayout::template OffsetOf<typename Header::UuidField>()], &StorageUUID);
+				Header::DataUuidField::Set(&header[HeaderLayout::template OffsetOf<typename Header::DataUuidField>()], &m_Uuid);
+				HeaderLayout::Encode(header, metrics);
+				if(!Write(header, sizeof(header), m_Address))
 					return false; // device error
-				if(!Write(data, len, m_Address + sizeof(StorageHeaderStruct<ADDRESS_TYPE, CRC_TYPE>)))
+				if(!Write(data, len, m_Address + sizeof(header)))
 					return false; // device error
 				return true;
 			}
 		};
 
-		static const System::UUID PageStorageUUID = { 0xD2, 0x3C, 0x3B, 0x7A, 0x75, 0xF9, 0x11, 0xE8, 0x81, 0x90, 0x2C, 0xFD, 0xA1, 0xE1, 0xCE, 0xF5 };
+		static constexpr System::UUID PageStorageUUID = System::UUID::Parse("d23c3b7a-75f9-11e8-8190-2cfda1e1cef5");
 
 		//! Storage using the pages chain
 		template <typename ADDRESS_TYPE, typename LENGTH_TYPE, typename CRC_TYPE>
@@ -198,6 +240,16 @@ namespace System
 				CRC_TYPE PageCrc; //!< CRC of the user data (excluding page header, user data only)
 			};
 
+			//! Wire layout of @c PageHeaderStruct
+			typedef Wire::Bytes<sizeof(System::UUID), 0> UuidField;
+			typedef Wire::Bytes<sizeof(System::UUID), 1> DataUuidField;
+			typedef WIRE_FIELD(PageHeaderMetricsStruct, TotalLength) TotalLengthField;
+			typedef WIRE_FIELD(PageHeaderMetricsStruct, PageOffset) PageOffsetField;
+			typedef WIRE_FIELD(PageHeaderMetricsStruct, PageLength) PageLengthField;
+			typedef WIRE_FIELD(PageHeaderMetricsStruct, PageCrc) PageCrcField;
+			typedef Wire::Layout<PageHeaderMetricsStruct, UuidField, DataUuidField, TotalLengthField, PageOffsetField, PageLengthField, PageCrcField> PageHeaderLayout;
+			static_assert(PageHeaderLayout::Size == sizeof(PageHeaderStruct), "Page header layout mismatch");
+
 			const System::UUID &m_Uuid; //!< UUID of user data
 			ADDRESS_TYPE m_Address; //!< Address into the storage device space
 
@@ -225,42 +277,32 @@ namespace System
 
 			inline bool getMetrics(PageHeaderMetricsStruct &metrics) const { return getMetrics(metrics, m_Address); }
 
+			//! Reads page metrics by one device read
 			bool getMetrics(PageHeaderMetricsStruct &metrics, ADDRESS_TYPE address) const
 			{
-				if(!Read(&metrics.TotalLength, address + (decltype(address))&(((PageHeaderStruct*)0)->TotalLength), sizeof(PageHeaderStruct::TotalLength)))
-					return false;
-				if(!Read(&metrics.PageOffset, address + (decltype(address))&(((PageHeaderStruct*)0)->PageOffset), sizeof(PageHeaderStruct::PageOffset)))
-					return false;
-				if(!Read(&metrics.PageLength, address + (decltype(address))&(((PageHeaderStruct*)0)->PageLength), sizeof(PageHeaderStruct::PageLength)))
-					return false;
-				if(!Read(&metrics.PageCrc, address + (decltype(address))&(((PageHeaderStruct*)0)->PageCrc), sizeof(PageHeaderStruct::PageCrc)))
+				uint8_t header[PageHeaderLayout::Size];
+				const auto offset = PageHeaderLayout::template OffsetOf<TotalLengthField>();
+				if(!Read(&header[offset], address + offset, sizeof(header) - offset))
 					return false;
+				PageHeaderLayout::Decode(metrics, header);
 				return true;
 			}
 
-			//! Sets storage header
-			//! @param data		Buffer to read from
-			//! @param len		Buffer length, bytes
-			//! @param crc		Storage CRC
+			//! Sets storage page header
+			//! @param metrics	Page metrics
+			//! @note Header is written by one device write
 			bool SetHeader(const PageHeaderMetricsStruct &metrics) const
 			{
-				// check out of data bound
-				if(!WritePage(&PageStorageUUID, m_Address, sizeof(PageStorageUUID)))
-					return false; // device error
-				if(!WritePage(&m_Uuid, m_Address + (decltype(m_Address))&(((PageHeaderStruct*)0)->DataUuid), sizeof(m_Uuid)))
-					return false; // device error
-				if(!WritePage(&metrics.TotalLength, m_Address + (decltype(m_Address))&(((PageHeaderStruct*)0)->TotalLength), sizeof(metrics.TotalLength)))
-					return false; // device error
-				if(!WritePage(&metrics.PageOffset, m_Address + (decltype(m_Address))&(((PageHeaderStruct*)0)->PageOffset), sizeof(metrics.PageOffset)))
-					return false; // device error
-				if(!WritePage(&metrics.PageLength, m_Address + (decltype(m_Address))&(((PageHeaderStruct*)0)->PageLength), sizeof(metrics.PageLength)))
-					return false; // device error
-				if(!WritePage(&metrics.PageCrc, m_Address + (decltype(m_Address))&(((PageHeaderStruct*)0)->PageCrc), sizeof(metrics.PageCrc)))
+				uint8_t header[PageHeaderLayout::Size];
+				UuidField::Set(&header[PageHeaderLayout::template OffsetOf<UuidField>()], &PageStorageUUID);
+				DataUuidField::Set(&header[PageHeaderLayout::template OffsetOf<DataUuidField>()], &m_Uuid);
+				PageHeaderLayout::Encode(header, metrics);
+				if(!WritePage(header, m_Address, sizeof(header)))
 					return false; // device error
 				return true;
 			}
 
-			static inline LENGTH_TYPE getMaxPageLength(LENGTH_TYPE pageLen) { return pageLen - sizeof(PageHeaderStruct); }
+			static inline LENGTH_TYPE getMaxPageLength(LENGTH_TYPE pageLen) { return pageLen - PageHeaderLayout::Size; }
 
 		public:
 
@@ -273,11 +315,12 @@ namespace System
 			//! @param pageLen		Page length, bytes: @c sizeof(PageHeaderStruct)..
 			PageCheckResultEnum isPageCorrect(ADDRESS_TYPE address, LENGTH_TYPE pageLen, const CheckOptions options=CheckOptions())
 			{
+				TRACE_SCOPE(Trace::StoragePageCheck, address);
 				// check storage UUID
 				if(!Compare(&PageStorageUUID, address, sizeof(PageStorageUUID)))
 					return PageCheckResultEnum::NoStorage; // wrong storage UUID
 				// check persistent data UUID
-				if(!Compare(&m_Uuid, address + (decltype(address))&(((PageHeaderStruct*)0)->DataUuid), sizeof(m_Uuid)))
+				if(!Compare(&m_Uuid, address + PageHeaderLayout::template OffsetOf<DataUuidField>(), sizeof(m_Uuid)))
 					return PageCheckResultEnum::AnotherStorage; // wrong data UUID
 				if(!options.DontCheckMetrics)
 				{
@@ -287,7 +330,7 @@ namespace System
 						return PageCheckResultEnum::DeviceError; // device error
 					if(metrics.PageLength > getMaxPageLength(pageLen) || metrics.PageLength > metrics.TotalLength || metrics.PageOffset > metrics.TotalLength)
 						return PageCheckResultEnum::Error; // storage error
-					if(!options.DontCheckCrc && metrics.PageCrc != CalculatePageCRC(address + sizeof(PageHeaderStruct), metrics.PageLength))
+					if(!options.DontCheckCrc && metrics.PageCrc != CalculatePageCRC(address + PageHeaderLayout::Size, metrics.PageLength))
 						return PageCheckResultEnum::Error; // CRC error
 				}
 				m_Address = address;
@@ -0,0 +1,215 @@
+/**
+ * Fixed-block memory pool: lock-free, safe for ISRs & message loop
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Storage is the static array of blocks: compile time allocation, no heap.
+ * Free blocks are the list (Treiber stack): first 2 bytes of free block hold index of next free block.
+ * List head is 32-bit word: index (low 16 bits) & change tag (high 16 bits), so one compare-exchange
+ * pops/pushes the block & ABA problem (head block popped & pushed by preempting ISR) is detected by tag.
+ * Blocks which were never allocated are taken in order by counter: pool needs no initialization.
+ * Pools declared by @c POOL_DECLARE are collected by linker into @c .pools table (RAM) like the timers: usage
+ * statistics of all the pools are available for diagnostics.
+ * Block size is rounded up to the alignment of @c max_align_t (8 bytes on Cortex-M): each block holds any scalar type.
+ */
+
+/**
+ * @page Pool
+ * @par Linker script sections:
+ * - Pools table (RAM, initialized data)
+ * @code
+SECTIONS
+{
+	.data :
+	{
+		...
+		. = ALIGN(4);
+		PROVIDE(_Pools_Table_Begin = .);
+		KEEP(*(.pools .pools.*))
+		PROVIDE(_Pools_Table_End = .);
+	} >RAM AT>FLASH
+}
+ * @endcode
+ * Host (Linux) build needs no linker script: section is @c pools (see Port/Port.h).
+ * @par Usage
+ * @code
+#include "Libs/Pool.hpp"
+
+POOL_DECLARE(Packets, sizeof(PacketStruct), 16)
+
+auto packet = POOL(Packets)->New<PacketStruct>(); // ISR or message loop
+if(packet != NULL)
+	...
+POOL(Packets)->Delete(packet);
+
+auto buffer = POOL(Packets)->Alloc(); // raw block
+POOL(Packets)->Free(buffer);
+
+for(auto &pool : System::PoolsTable()) // diagnostics
+	printf("%s: %u/%u, max %u, failures %u", pool.getName(), pool.getUsed(), pool.getCount(), pool.getHighWater(), pool.getFailures());
+ * @endcode
+ */
+
+#ifndef SRC_LIB_POOL_HPP_
+#define SRC_LIB_POOL_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <new>
+#include <utility>
+#include "Port/Port.h"
+#include "Libs/LinkerTable.hpp"
+#include "Libs/Atomic.hpp"
+
+//! Declares pool
+//! @param name			Pool name: C identifier
+//! @param blockSize	Block size, bytes: rounded up block size is 65535 bytes at most
+//! @param count		Blocks count: 1..65534
+#define POOL_DECLARE(name, blockSize, count)\
+	static_assert((count) > 0 && (count) < System::PoolClass::None, "Pool blocks count must be 1..65534");\
+	static_assert(System::PoolClass::BlockSize(blockSize) <= 0xFFFF, "Pool block size is too big");\
+	static uint8_t _PoolStorage_##name[System::PoolClass::BlockSize(blockSize) * (count)] __attribute__((aligned(System::PoolClass::Alignment)));\
+	static System::PoolClass PORT_TABLE_ENTRY(pools, System::PoolClass) _Pool_##name(#name, _PoolStorage_##name, System::PoolClass::BlockSize(blockSize), count);
+
+//! Pool pointer
+#define POOL(name) (&_Pool_##name)
+
+extern "C"
+{
+#ifdef PORT_HOST
+#	define _Pools_Table_Begin PORT_SECTION_BEGIN(pools)
+#	define _Pools_Table_End PORT_SECTION_END(pools)
+#endif
+	extern unsigned char _Pools_Table_Begin[] PORT_LINKER_SYMBOL; //!< RAM address, first byte of array
+	extern unsigned char _Pools_Table_End[] PORT_LINKER_SYMBOL; //!< RAM address, first byte after array
+}
+
+namespace System
+{
+	//! Fixed-block pool
+	class PoolClass
+	{
+	public:
+		static const uint16_t None = 0xFFFF; //!< No block index
+
+		static const size_t Alignment = alignof(max_align_t); //!< Alignment of storage & blocks
+
+		//! Block size of storage: rounded up to @c Alignment (free list link & alignment of objects)
+		static constexpr size_t BlockSize(size_t size) { return size < Alignment ? Alignment : (size + Alignment - 1) & ~(Alignment - 1); }
+
+	protected:
+		const char *m_Name;
+		uint8_t *m_Storage;
+		uint16_t m_BlockSize;
+		uint16_t m_Count;
+		uint32_t m_Head;		//!< Free list: change tag << 16 | first free block index
+		uint32_t m_Fresh;		//!< Blocks never allocated: m_Fresh..m_Count - 1
+		uint32_t m_Used;		//!< Allocated blocks count
+		uint32_t m_HighWater;	//!< Maximum of allocated blocks count
+		uint32_t m_Failures;	//!< Allocations failed: pool is empty
+
+		inline uint8_t *block(uint32_t index) const { return m_Storage + index * m_BlockSize; }
+
+		inline void *taken(uint32_t index)
+		{
+			Atomic::Max(&m_HighWater, Atomic::FetchAdd(&m_Used, 1) + 1);
+			return block(index);
+		}
+
+	public:
+
+		constexpr PoolClass(const char *name, uint8_t *storage, uint16_t blockSize, uint16_t count) :
+			m_Name(name), m_Storage(storage), m_BlockSize(blockSize), m_Count(count),
+			m_Head(None), m_Fresh(0), m_Used(0), m_HighWater(0), m_Failures(0) {}
+
+		//! Allocates block
+		//! @return Block; NULL - pool is empty
+		void *Alloc()
+		{
+			auto head = Atomic::Load(&m_Head);
+			while((uint16_t)head != None)
+			{
+				uint16_t next;
+				memcpy(&next, block((uint16_t)head), sizeof(next)); // garbage if block is taken meanwhile: tag is changed, so exchange fails
+				if(Atomic::CompareExchange(&m_Head, head, ((head + 0x10000) & 0xFFFF0000) | next))
+					return taken((uint16_t)head);
+			}
+			auto fresh = Atomic::Load(&m_Fresh);
+			while(fresh < m_Count)
+			{
+				if(Atomic::CompareExchange(&m_Fresh, fresh, fresh + 1))
+					return taken(fresh);
+			}
+			Atomic::FetchAdd(&m_Failures, 1);
+			return NULL;
+		}
+
+		//! Frees block
+		//! @param block	Block of the pool; NULL is ignored
+		//! @return True - success; false - block is not of the pool
+		bool Free(void *block)
+		{
+			if(block == NULL)
+				return true;
+			if(!Contains(block))
+				return false;
+			uint16_t index = ((uint8_t*)block - m_Storage) / m_BlockSize;
+			auto head = Atomic::Load(&m_Head);
+			do
+			{
+				uint16_t next = (uint16_t)head;
+				memcpy(block, &next, sizeof(next));
+			}
+			while(!Atomic::CompareExchange(&m_Head, head, ((head + 0x10000) & 0xFFFF0000) | index));
+			Atomic::FetchAdd(&m_Used, (uint32_t)-1);
+			return true;
+		}
+
+		//! Allocates block & constructs object
+		//! @return Object; NULL - pool is empty or block is too small
+		template<typename T, typename... ARGS>
+		T *New(ARGS&&... args)
+		{
+			static_assert(alignof(T) <= Alignment, "Pool: over-aligned type");
+			if(sizeof(T) > m_BlockSize)
+				return NULL;
+			auto block = Alloc();
+			return block == NULL ? NULL : new(block) T(std::forward<ARGS>(args)...);
+		}
+
+		//! Destroys object & frees block
+		template<typename T>
+		void Delete(T *object)
+		{
+			if(object != NULL)
+			{
+				object->~T();
+				Free(object);
+			}
+		}
+
+		//! @return True - block of the pool
+		inline bool Contains(const void *block) const
+		{
+			auto offset = (const uint8_t*)block - m_Storage;
+			return (const uint8_t*)block >= m_Storage && (size_t)offset < (size_t)m_Count * m_BlockSize && offset % m_BlockSize == 0;
+		}
+
+		//! Starts high-water mark from current usage
+		inline void ResetHighWater() { m_HighWater = Atomic::Load(&m_Used); }
+
+		inline const char *getName() const { return m_Name; }
+		inline uint16_t getBlockSize() const { return m_BlockSize; }
+		inline uint16_t getCount() const { return m_Count; }
+		inline uint32_t getUsed() const { return Atomic::Load(&m_Used); }
+		inline uint32_t getHighWater() const { return Atomic::Load(&m_HighWater); }
+		inline uint32_t getFailures() const { return Atomic::Load(&m_Failures); }
+	};
+
+	//! Pools declared by @c POOL_DECLARE
+	typedef LinkerTable<PoolClass, _Pools_Table_Begin, _Pools_Table_End> PoolsTable;
+}
+
+#endif /* SRC_LIB_POOL_HPP_ */
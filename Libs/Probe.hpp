@@ -0,0 +1,192 @@
+/**
+ * Hot-path GPIO probes for oscilloscope & logic analyzer profiling
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Probe point is a compile time ID. Each probe point can be mapped to the GPIO:
+ * - one pin: entry/exit edges (@see PROBE_PIN)
+ * - pins group of the same port: N-bit code of the probe point while entry, zero code while exit (@see PROBE_CODE)
+ * - cycles statistics of entry..exit (@see PROBE_PROFILE, Libs/Profile.hpp): hot code placement comparison e.t.c.
+ * - entries counter (@see PROBE_COUNT): callbacks counts of simulation e.t.c.
+ * Enabled probe costs one store to BSRR/BRR register. Not mapped probe point compiles to nothing.
+ * Mapping is collected into the config file that included by all translation units.
+ */
+
+/**
+ * @page Probe
+ * @par Config
+ * Compiler flag to enable the probes:
+ * @code
+-DPROBE_CONFIG='"ProbeConfig.h"'
+ * @endcode
+ * ProbeConfig.h file:
+ * @code
+#include "stm32l0xx.h"
+#include "pin.h"
+typedef Pin<'A', 5> PA5;
+typedef PinList<Pin<'B', 0>, Pin<'B', 1>, Pin<'B', 2>, Pin<'B', 3>> PB0_3;
+PROBE_PIN(Probe::TimerTick, PA5) // PA5 is high while Timer::Tick() runs
+PROBE_CODE(Probe::TimerCallback, PB0_3) // PB0..PB3 shows code of probe point while timer callback runs
+PROBE_CODE(Probe::ServicesCallback, PB0_3)
+PROBE_PROFILE(Probe::ServicesProcessStates) // cycles of Services::ProcessStates()
+PROBE_COUNT(Probe::UsbSetupRequest) // SETUP requests count
+ * @endcode
+ * @par Usage
+ * @code
+#include "Libs/Probe.hpp"
+enum { MyProbe = Probe::User };
+void function()
+{
+	PROBE_SCOPE(MyProbe);
+	// ...
+}
+auto &site = Probe::ProfileProbe<Probe::ServicesProcessStates>::Site(); // min/avg/max cycles; the site is in Profile::SitesTable() too
+auto requests = Probe::CounterProbe<Probe::UsbSetupRequest>::Counter(); // entries of counted probe point
+ * @endcode
+ */
+
+#ifndef SRC_LIB_PROBE_HPP_
+#define SRC_LIB_PROBE_HPP_
+
+#include "Libs/Profile.hpp"
+
+namespace Probe
+{
+	//! Probe points of the framework
+	enum PointEnum
+	{
+		TimerTick,					//!< Timer::Tick() body
+		TimerCallback,				//!< Timer callback called by Timer::Tick()
+		ServicesProcessStates,		//!< Services::ProcessStates() body
+		ServicesCallback,			//!< Service callback called by Services::ProcessStates()
+		UsbSetupRequest,			//!< Usb::UsbBase::setupRequest() body
+		UsbControlEPOutgoingData,	//!< Usb::UsbBase::controlEPOutgoingData() body
+		PageCacheFlush,				//!< System::Cache::PageCacheClass::Flush() body
+		PageCacheSetData,			//!< System::Cache::PageCacheClass::SetData() body
+		PageCacheGetData,			//!< System::Cache::PageCacheClass::GetData() body
+		TimerIsrCallback,			//!< ISR class timer callback called by Timer::IsrTick()
+		User,						//!< First probe point of user: User, User + 1 ...
+	};
+
+	//! Probe point
+	//! @note Not mapped probe point: nothing to do
+	template<unsigned POINT>
+	struct Point
+	{
+		static inline void Enter() {}
+		static inline void Exit() {}
+	};
+
+	//! Probe point mapped to one pin: active state while entry, inactive state while exit
+	template<class PIN>
+	struct PinProbe
+	{
+		static inline void Enter() { PIN::On(); }
+		static inline void Exit() { PIN::Off(); }
+	};
+
+	//! Probe point mapped to pins group of the same port (@see PinList): CODE while entry, zero while exit
+	template<class PINLIST, unsigned CODE>
+	struct CodeProbe
+	{
+		static_assert(CODE < (1ull << PINLIST::width), "Probe: code of probe point (point + 1) doesn't fit the bits of pins group");
+
+		static inline void Enter() { PINLIST::Write(CODE); }
+		static inline void Exit() { PINLIST::Write(0); }
+	};
+
+	//! Probe point mapped to cycles statistics: duration of entry..exit
+	//! @note Not reentrant: one context of probe point
+	template<unsigned POINT>
+	struct ProfileProbe
+	{
+		//! Site of profile sites table: defined by @c PROBE_PROFILE
+		static Profile::SiteStruct &Site();
+
+		static inline uint32_t &start()
+		{
+			static uint32_t cycles;
+			return cycles;
+		}
+
+		static inline void Enter() { start() = Profile::Cycles(); }
+		static inline void Exit() { Site().Add(Profile::Cycles() - start()); }
+	};
+
+	//! Probe point mapped to counter: entries count (wraps)
+	template<unsigned POINT>
+	struct CounterProbe
+	{
+		static inline uint32_t &Counter()
+		{
+			static uint32_t count;
+			return count;
+		}
+
+		static inline void Enter() { Counter()++; }
+		static inline void Exit() {}
+	};
+
+	template<unsigned POINT>
+	inline void Enter() { Point<POINT>::Enter(); }
+
+	template<unsigned POINT>
+	inline void Exit() { Point<POINT>::Exit(); }
+
+	//! Probe of the scope: entry while construction, exit while destruction
+	template<unsigned POINT>
+	struct Scope
+	{
+		inline Scope() { Point<POINT>::Enter(); }
+		inline ~Scope() { Point<POINT>::Exit(); }
+	};
+}
+
+#define _PROBE_CONCAT2(a, b) a##b
+#define _PROBE_CONCAT(a, b) _PROBE_CONCAT2(a, b)
+
+//! Maps probe point to the pin
+//! @param point	Probe point: Probe::PointEnum or user probe point
+//! @param pin		Pin type: Pin<port, pin_no, activestate>
+#define PROBE_PIN(point, pin...)\
+	namespace Probe { template<> struct Point<point> : PinProbe<pin> {}; }
+
+//! Maps probe point to the pins group; probe point code is (point + 1): must fit the pins count bits
+//! @param point	Probe point: Probe::PointEnum or user probe point
+//! @param pinList	Pins group type: PinList<pins...>
+#define PROBE_CODE(point, pinList...)\
+	namespace Probe { template<> struct Point<point> : CodeProbe<pinList, (point) + 1> {}; }
+
+//! Maps probe point to cycles statistics (@see ProfileProbe)
+//! @note Site is the entry of profile sites table named as the point: one entry of all translation units
+//! (inline function static in @c .profile_sites.probe subsection, merged by linker)
+//! @param point	Probe point: Probe::PointEnum or user probe point
+#define PROBE_PROFILE(point)\
+	namespace Probe\
+	{\
+		template<> inline Profile::SiteStruct &ProfileProbe<point>::Site()\
+		{\
+			static Profile::SiteStruct site PORT_TABLE_ENTRY_PRIORITY(profile_sites, Profile::SiteStruct, probe) = { #point, 0, 0xFFFFFFFF, 0, 0 };\
+			return site;\
+		}\
+		template<> struct Point<point> : ProfileProbe<point> {};\
+	}
+
+//! Maps probe point to entries counter (@see CounterProbe)
+//! @param point	Probe point: Probe::PointEnum or user probe point
+#define PROBE_COUNT(point)\
+	namespace Probe { template<> struct Point<point> : CounterProbe<point> {}; }
+
+//! Probe of the current scope
+#define PROBE_SCOPE(point) Probe::Scope<point> _PROBE_CONCAT(_ProbeScope_, __LINE__)
+
+#define PROBE_ENTER(point) Probe::Enter<point>()
+
+#define PROBE_EXIT(point) Probe::Exit<point>()
+
+#ifdef PROBE_CONFIG
+#	include PROBE_CONFIG
+#endif
+
+#endif /* SRC_LIB_PROBE_HPP_ */
@@ -0,0 +1,266 @@
+/**
+ * Profiling clock: cycles counter, scoped timing & per-site statistics
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Clock is 32-bit counter of cycles (wraps; differences are valid up to 2^32 cycles):
+ * - Cortex-M3/M4/M7/M33: DWT cycles counter (CYCCNT), one load
+ * - Cortex-M0/M0+/M23: SysTick (processor clock source) & system time ticks: @c SystemTime * reload + sub-tick counter
+ * - host: @c clock_gettime (nS); x86 time stamp counter with @c PROFILE_TSC (frequency is calibrated by @c Init)
+ * Site is the statistics of measured durations: count, min, average, max. Sites declared by @c PROFILE_SITE_DECLARE
+ * are collected by linker into @c .profile_sites table (RAM) like the timers: all the sites are available for report.
+ * Sites of profiled probe points (@c PROBE_PROFILE of Libs/Probe.hpp) are the @c .profile_sites.probe subsection.
+ * Site is not reentrant: one context (message loop or ISR) per site.
+ */
+
+/**
+ * @page Profile
+ * @par Config
+ * @code
+#define PROFILE_TSC // host, x86: time stamp counter instead of clock_gettime
+ * @endcode
+ * @par Linker script sections:
+ * - Sites table (RAM, initialized data)
+ * @code
+SECTIONS
+{
+	.data :
+	{
+		...
+		. = ALIGN(4);
+		PROVIDE(_Profile_SitesTable_Begin = .);
+		KEEP(*(.profile_sites .profile_sites.*))
+		PROVIDE(_Profile_SitesTable_End = .);
+	} >RAM AT>FLASH
+}
+ * @endcode
+ * @par Usage
+ * @code
+#include "Libs/Profile.hpp"
+
+PROFILE_SITE_DECLARE(Parse)
+PROFILE_SITE_DECLARE(UsbLatency)
+PROFILE_SITE_DECLARE(SysTickLatency)
+
+Profile::Init(); // after SystemCoreClock setup
+
+void parse()
+{
+	PROFILE_SCOPE(Parse); // duration of the scope
+	...
+}
+
+auto start = Profile::Cycles();
+...
+auto uS = Profile::ToMicroseconds(Profile::Cycles() - start);
+
+static uint32_t Trigger;
+Profile::Trigger(Trigger); // before the interrupt source is triggered (software pending, timer event e.t.c.)
+void USB_IRQHandler()
+{
+	PROFILE_LATENCY(UsbLatency, Trigger); // trigger to ISR entry
+}
+void SysTick_Handler()
+{
+	PROFILE_SITE(SysTickLatency)->Add(Profile::SysTickLatency()); // cycles since SysTick reload
+}
+
+for(auto &site : Profile::SitesTable()) // report
+	printf("%s: %u x %u..%u, avg %u cycles", site.Name, site.Count, site.Min, site.Max, site.Average());
+ * @endcode
+ */
+
+#ifndef SRC_LIB_PROFILE_HPP_
+#define SRC_LIB_PROFILE_HPP_
+
+#include <stdint.h>
+#include "Port/Port.h"
+#include "Libs/LinkerTable.hpp"
+
+#ifdef PORT_HOST
+#	include <time.h>
+#	ifdef PROFILE_TSC
+#		include <x86intrin.h>
+#	endif
+#endif
+
+//! Declares statistics site
+#define PROFILE_SITE_DECLARE(name)\
+	static Profile::SiteStruct PORT_TABLE_ENTRY(profile_sites, Profile::SiteStruct) _ProfileSite_##name = { #name, 0, 0xFFFFFFFF, 0, 0 };
+
+//! Site pointer
+#define PROFILE_SITE(name) (&_ProfileSite_##name)
+
+#define _PROFILE_CONCAT2(a, b) a##b
+#define _PROFILE_CONCAT(a, b) _PROFILE_CONCAT2(a, b)
+
+//! Measures duration of the current scope to the site
+#define PROFILE_SCOPE(name) Profile::Scope _PROFILE_CONCAT(_ProfileScope_, __LINE__)(PROFILE_SITE(name))
+
+//! Measures interrupt latency to the site: cycles since trigger (@see Profile::Trigger)
+#define PROFILE_LATENCY(name, trigger) PROFILE_SITE(name)->Add(Profile::Cycles() - (trigger))
+
+extern "C"
+{
+#ifdef PORT_HOST
+#	define _Profile_SitesTable_Begin PORT_SECTION_BEGIN(profile_sites)
+#	define _Profile_SitesTable_End PORT_SECTION_END(profile_sites)
+#else
+	extern uint32_t SystemCoreClock; //!< Core clock, Hz (CMSIS)
+#endif
+	extern unsigned char _Profile_SitesTable_Begin[] PORT_LINKER_SYMBOL; //!< RAM address, first byte of array
+	extern unsigned char _Profile_SitesTable_End[] PORT_LINKER_SYMBOL; //!< RAM address, first byte after array
+	extern volatile uint32_t SystemTime; //!< System time, mS: SysTick interrupts count
+}
+
+namespace Profile
+{
+	//! Durations statistics of the site, cycles
+	struct SiteStruct
+	{
+		const char *Name;
+		uint32_t Count;
+		uint32_t Min;
+		uint32_t Max;
+		uint64_t Total;
+
+		inline void Add(uint32_t cycles)
+		{
+			Count++;
+			Total += cycles;
+			if(cycles < Min)
+				Min = cycles;
+			if(cycles > Max)
+				Max = cycles;
+		}
+
+		inline uint32_t Average() const { return Count == 0 ? 0 : (uint32_t)(Total / Count); }
+
+		inline void Reset()
+		{
+			Count = Max = 0;
+			Min = 0xFFFFFFFF;
+			Total = 0;
+		}
+	};
+
+	//! Sites declared by @c PROFILE_SITE_DECLARE
+	typedef System::LinkerTable<SiteStruct, _Profile_SitesTable_Begin, _Profile_SitesTable_End> SitesTable;
+
+#if defined(PORT_HOST)
+#	ifdef PROFILE_TSC
+	//! Calibrated frequency of time stamp counter
+	inline uint32_t &tscFrequency()
+	{
+		static uint32_t frequency;
+		return frequency;
+	}
+
+	//! Calibrates time stamp counter by monotonic clock: 10 mS
+	inline void Init()
+	{
+		timespec begin, now;
+		clock_gettime(CLOCK_MONOTONIC, &begin);
+		auto start = __rdtsc();
+		int64_t elapsed;
+		do
+		{
+			clock_gettime(CLOCK_MONOTONIC, &now);
+			elapsed = (now.tv_sec - begin.tv_sec) * 1000000000LL + now.tv_nsec - begin.tv_nsec;
+		}
+		while(elapsed < 10000000);
+		tscFrequency() = (uint32_t)((__rdtsc() - start) * 1000000000ULL / elapsed);
+	}
+
+	inline uint32_t Cycles() { return (uint32_t)__rdtsc(); }
+
+	//! Clock frequency, Hz
+	inline uint32_t Frequency() { return tscFrequency(); }
+#	else
+	inline void Init() {}
+
+	//! Monotonic clock, nS
+	inline uint32_t Cycles()
+	{
+		timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (uint32_t)ts.tv_sec * 1000000000u + (uint32_t)ts.tv_nsec;
+	}
+
+	//! Clock frequency, Hz
+	inline uint32_t Frequency() { return 1000000000u; }
+#	endif
+
+	inline uint32_t SysTickLatency() { return 0; }
+#else
+	//! Register of core
+	inline volatile uint32_t &reg(uint32_t address) { return *(volatile uint32_t*)address; }
+
+	static const uint32_t SysTickLoad = 0xE000E014;	//!< SysTick LOAD
+	static const uint32_t SysTickVal = 0xE000E018;	//!< SysTick VAL
+	static const uint32_t Icsr = 0xE000ED04;		//!< SCB ICSR
+	static const uint32_t IcsrPendStSet = 1u << 26;	//!< SysTick exception is pending
+
+	//! Cycles since SysTick reload: latency of SysTick_Handler at its entry
+	inline uint32_t SysTickLatency() { return reg(SysTickLoad) - reg(SysTickVal); }
+
+#	if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+	static const uint32_t DwtCtrl = 0xE0001000;		//!< DWT CTRL
+	static const uint32_t DwtCyccnt = 0xE0001004;	//!< DWT CYCCNT
+	static const uint32_t DwtLar = 0xE0001FB0;		//!< DWT lock access (Cortex-M7)
+	static const uint32_t Demcr = 0xE000EDFC;		//!< CoreDebug DEMCR
+
+	//! Enables DWT cycles counter
+	inline void Init()
+	{
+		reg(Demcr) |= 1u << 24; // TRCENA
+		reg(DwtLar) = 0xC5ACCE55;
+		reg(DwtCyccnt) = 0;
+		reg(DwtCtrl) |= 1; // CYCCNTENA
+	}
+
+	inline uint32_t Cycles() { return reg(DwtCyccnt); }
+#	else
+	inline void Init() {}
+
+	//! SysTick ticks & sub-tick counter
+	//! @note SysTick must count processor clock & increment @c SystemTime
+	inline uint32_t Cycles()
+	{
+		uint32_t ticks, value, pending;
+		do
+		{
+			ticks = SystemTime;
+			value = reg(SysTickVal);
+			pending = reg(Icsr) & IcsrPendStSet;
+			if(pending)
+				value = reg(SysTickVal); // counter wrapped & interrupt is masked: value after the wrap
+		}
+		while(ticks != SystemTime);
+		auto reload = reg(SysTickLoad);
+		return (ticks + (pending ? 1 : 0)) * (reload + 1) + (reload - value);
+	}
+#	endif
+
+	//! Clock frequency, Hz
+	inline uint32_t Frequency() { return SystemCoreClock; }
+#endif
+
+	//! Converts cycles to microseconds
+	inline uint32_t ToMicroseconds(uint32_t cycles) { return (uint32_t)((uint64_t)cycles * 1000000u / Frequency()); }
+
+	//! Marks trigger of interrupt latency measurement (@see PROFILE_LATENCY)
+	inline void Trigger(uint32_t &trigger) { trigger = Cycles(); }
+
+	//! Duration of the scope to the site
+	struct Scope
+	{
+		SiteStruct *m_Site;
+		uint32_t m_Start;
+		inline Scope(SiteStruct *site) : m_Site(site), m_Start(Cycles()) {}
+		inline ~Scope() { m_Site->Add(Cycles() - m_Start); }
+	};
+}
+
+#endif /* SRC_LIB_PROFILE_HPP_ */
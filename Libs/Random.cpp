@@ -0,0 +1,76 @@
+/**
+ * Random numbers source: hardware RNG or mock
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include "Libs/Random.hpp"
+#include "stm32l0xx.h"
+
+namespace System
+{
+	namespace Random
+	{
+#ifdef RNG
+		void Init()
+		{
+			RNG->CR |= RNG_CR_RNGEN;
+		}
+
+		void Seed(uint32_t)
+		{
+		}
+
+		uint32_t Get()
+		{
+			for(;;)
+			{
+				auto sr = RNG->SR;
+				if(sr & (RNG_SR_SEIS | RNG_SR_CEIS))
+				{
+					// error: restart RNG
+					RNG->SR = 0;
+					RNG->CR &= ~RNG_CR_RNGEN;
+					RNG->CR |= RNG_CR_RNGEN;
+					continue;
+				}
+				if(sr & RNG_SR_DRDY)
+					return RNG->DR;
+			}
+		}
+#else
+		//! xorshift128 state
+		static struct MockStateStruct
+		{
+			uint32_t X, Y, Z, W;
+		} MockState = { 123456789, 362436069, 521288629, 88675123 };
+
+		void Init()
+		{
+		}
+
+		void Seed(uint32_t seed)
+		{
+			auto &s = MockState;
+			s.X = 123456789 ^ seed;
+			s.Y = 362436069;
+			s.Z = 521288629;
+			s.W = 88675123 ^ (seed * 0x9E3779B9);
+			if((s.X | s.W) == 0)
+				s.X = 1; // state can't be zero
+		}
+
+		uint32_t Get()
+		{
+			auto &s = MockState;
+			auto t = s.X ^ (s.X << 11);
+			s.X = s.Y;
+			s.Y = s.Z;
+			s.Z = s.W;
+			s.W = s.W ^ (s.W >> 19) ^ t ^ (t >> 8);
+			return s.W;
+		}
+#endif
+	}
+}
@@ -0,0 +1,52 @@
+/**
+ * Random numbers source: hardware RNG or mock
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Hardware RNG is used when device header defines @c RNG (STM32 true RNG peripheral).
+ * Otherwise (host, device without RNG) xorshift128 generator is used: not cryptographic, must be seeded.
+ * The source is chosen once by Libs/Random.cpp (device header of the build): all the translation units call
+ * the same functions, whatever they include before this header.
+ */
+
+/**
+ * @page Random
+ * @par Usage
+ * @code
+#include "Libs/Random.hpp"
+
+RCC->AHBENR |= RCC_AHBENR_RNGEN; // RNG clock (HSI48 on STM32L0)
+System::Random::Init();
+auto value = System::Random::Get();
+ * @endcode
+ * Host or device without RNG:
+ * @code
+System::Random::Seed(seed); // unique per device: chip ID, ADC noise e.t.c.
+auto value = System::Random::Get();
+ * @endcode
+ */
+
+#ifndef SRC_LIB_RANDOM_HPP_
+#define SRC_LIB_RANDOM_HPP_
+
+#include <stdint.h>
+
+namespace System
+{
+	namespace Random
+	{
+		//! Enables RNG
+		//! @note RNG clock must be enabled before. No RNG: nothing
+		void Init();
+
+		//! Seeds generator
+		//! @note Hardware RNG: nothing (entropy source needs no seed)
+		void Seed(uint32_t seed);
+
+		//! Returns 32 bits: entropy of RNG (waits for it; seed or clock error restarts RNG) or pseudo random
+		uint32_t Get();
+	}
+}
+
+#endif /* SRC_LIB_RANDOM_HPP_ */
@@ -0,0 +1,52 @@
+/**
+ * Compile-time integer sequences of C++11: constant tables built from constexpr functions of index
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note C++11 has no std::integer_sequence: @c MakeSequence concatenates halves, so instantiation depth is log2(N)
+ * & tables of hundreds entries don't hit the template depth limit. Used by compiled tables of Services/Cyclic.h
+ * & Services/Hsm.h, constexpr endian values of Libs/BytesOrder.h.
+ */
+
+/**
+ * @page Sequence
+ * @par Usage
+ * @code
+#include "Libs/Sequence.hpp"
+
+template<typename Sequence> struct SquaresTable;
+template<uint32_t... I> struct SquaresTable<System::Sequence<I...>>
+{
+	static constexpr uint32_t Values[sizeof...(I)] = { I * I... };
+};
+template<uint32_t... I> constexpr uint32_t SquaresTable<System::Sequence<I...>>::Values[];
+typedef SquaresTable<System::MakeSequence<16>::Type> Squares;
+ * @endcode
+ */
+
+#ifndef SRC_LIB_SEQUENCE_HPP_
+#define SRC_LIB_SEQUENCE_HPP_
+
+#include <stdint.h>
+
+namespace System
+{
+	constexpr uint32_t Max(uint32_t a, uint32_t b) { return a > b ? a : b; }
+
+	//! Integer sequence: parameter pack of indexes
+	template<uint32_t... I> struct Sequence {};
+
+	namespace SequenceDetail
+	{
+		template<typename A, typename B> struct Concat;
+		template<uint32_t... A, uint32_t... B> struct Concat<Sequence<A...>, Sequence<B...>> { typedef Sequence<A..., ((uint32_t)sizeof...(A) + B)...> Type; };
+	}
+
+	//! Integer sequence 0..N-1: halves are concatenated, instantiation depth is log2(N)
+	template<uint32_t N> struct MakeSequence { typedef typename SequenceDetail::Concat<typename MakeSequence<N / 2>::Type, typename MakeSequence<N - N / 2>::Type>::Type Type; };
+	template<> struct MakeSequence<0> { typedef Sequence<> Type; };
+	template<> struct MakeSequence<1> { typedef Sequence<0> Type; };
+}
+
+#endif /* SRC_LIB_SEQUENCE_HPP_ */
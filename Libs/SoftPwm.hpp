@@ -0,0 +1,269 @@
+/**
+ * Multi-channel software PWM driven by one hardware timer compare interrupt
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note The period is the schedule of steps: step 0 at period start switches on all active channels,
+ * the next steps switch off the channels sorted by duty. Channels with the same edge time are merged into one step,
+ * and channels of the same port within step are merged into one BSRR store.
+ * So, interrupts count per period is count of different duties plus one, and each interrupt is a few stores.
+ * The schedule is double-buffered: new duties are sorted into back schedule by @c Commit (out of interrupt context)
+ * and interrupt swaps the schedules at the period start only. So duty change is glitch-free.
+ */
+
+/**
+ * @page SoftPwm
+ * @par Usage
+ * @code
+#include "stm32l0xx.h"
+#include "pin.h"
+#include "Libs/SoftPwm.hpp"
+
+static System::Pwm::SoftPwmClass<16> Pwm(1000); // 16 channels, period is 1000 ticks of hardware timer
+
+void init()
+{
+	Pwm.SetChannel<Pin<'A', 0>>(0);
+	Pwm.SetChannel<Pin<'B', 3, 'L'>>(1);
+	// ...
+	Pwm.SetDuty(0, 250);
+	Pwm.SetDuty(1, 500);
+	Pwm.Commit();
+	// start free-running hardware timer with compare interrupt
+}
+
+extern "C" void TIM2_IRQHandler()
+{
+	TIM2->SR = ~TIM_SR_CC1IF;
+	TIM2->CCR1 += Pwm.Interrupt(); // next compare
+}
+ * @endcode
+ */
+
+#ifndef SRC_LIB_SOFTPWM_HPP_
+#define SRC_LIB_SOFTPWM_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+
+template<char port, int pin_no, char activestate> struct Pin;
+
+namespace System
+{
+	namespace Pwm
+	{
+		//! BSRR bits of pin to switch on/off the PWM channel
+		template<class PIN> struct PinBits;
+
+		template<char port, int pin_no, char activestate>
+		struct PinBits<Pin<port, pin_no, activestate>>
+		{
+			static const uint32_t On = activestate == 'L' ? (1UL << pin_no) << 16 : 1UL << pin_no;
+			static const uint32_t Off = activestate == 'L' ? 1UL << pin_no : (1UL << pin_no) << 16;
+		};
+
+		//! Software PWM
+		//! @param CHANNELS		Count of channels: 1..127 (stores & steps are indexed by bytes)
+		//! @param TIME_TYPE	Hardware timer counter type
+		template <unsigned int CHANNELS, typename TIME_TYPE = uint16_t>
+		class SoftPwmClass
+		{
+			static_assert(CHANNELS >= 1 && CHANNELS <= 127, "SoftPwm: CHANNELS must be 1..127");
+
+		public:
+			//! PWM channel output
+			struct ChannelStruct
+			{
+				volatile uint32_t *Bsrr; //!< Port BSRR register; NULL - channel is not used
+				uint32_t On; //!< BSRR bits to switch on
+				uint32_t Off; //!< BSRR bits to switch off
+			};
+
+		protected:
+			//! Store to port
+			struct WriteStruct
+			{
+				volatile uint32_t *Bsrr;
+				uint32_t Bits;
+			};
+
+			//! Edge time of the period
+			struct StepStruct
+			{
+				TIME_TYPE Time; //!< Time from period start, timer ticks
+				uint8_t First; //!< First store index
+				uint8_t Count; //!< Stores count
+			};
+
+			struct ScheduleStruct
+			{
+				uint8_t StepsCount;
+				StepStruct Steps[CHANNELS + 1];
+				WriteStruct Writes[CHANNELS * 2];
+			};
+
+			TIME_TYPE m_Period; //!< Period, timer ticks
+			ChannelStruct m_Channels[CHANNELS];
+			TIME_TYPE m_Duty[CHANNELS]; //!< Duties to commit
+			ScheduleStruct m_Schedules[2];
+			ScheduleStruct *volatile m_Front; //!< Schedule of interrupt
+			volatile bool m_Pending; //!< Back schedule is ready to swap at the period start
+			uint8_t m_Step; //!< Current step of front schedule
+
+			//! Adds the bits to the step
+			//! @note The stores to the same port are merged
+			static void addWrite(ScheduleStruct &schedule, StepStruct &step, volatile uint32_t *bsrr, uint32_t bits)
+			{
+				for(auto i = step.First; i < step.First + step.Count; i++)
+				{
+					if(schedule.Writes[i].Bsrr == bsrr)
+					{
+						schedule.Writes[i].Bits |= bits;
+						return;
+					}
+				}
+				auto &write = schedule.Writes[step.First + step.Count++];
+				write.Bsrr = bsrr;
+				write.Bits = bits;
+			}
+
+			//! Builds the schedule according to duties
+			void build(ScheduleStruct &schedule) const
+			{
+				// sort channels by duty
+				uint8_t order[CHANNELS];
+				unsigned int count = 0;
+				for(unsigned int i = 0; i < CHANNELS; i++)
+				{
+					if(m_Channels[i].Bsrr == NULL || m_Duty[i] == 0 || m_Duty[i] >= m_Period)
+						continue; // no switch off edge
+					auto j = count++;
+					for(; j > 0 && m_Duty[order[j - 1]] > m_Duty[i]; j--)
+						order[j] = order[j - 1];
+					order[j] = i;
+				}
+				// step 0: switch on active channels & switch off inactive channels
+				auto step = &schedule.Steps[0];
+				step->Time = 0;
+				step->First = step->Count = 0;
+				for(unsigned int i = 0; i < CHANNELS; i++)
+					if(m_Channels[i].Bsrr != NULL)
+						addWrite(schedule, *step, m_Channels[i].Bsrr, m_Duty[i] != 0 ? m_Channels[i].On : m_Channels[i].Off);
+				// switch off edges
+				for(unsigned int i = 0; i < count; i++)
+				{
+					auto &channel = m_Channels[order[i]];
+					if(step->Time != m_Duty[order[i]])
+					{
+						// new edge time
+						auto first = step->First + step->Count;
+						step++;
+						step->Time = m_Duty[order[i]];
+						step->First = first;
+						step->Count = 0;
+					}
+					addWrite(schedule, *step, channel.Bsrr, channel.Off);
+				}
+				schedule.StepsCount = step - &schedule.Steps[0] + 1;
+			}
+
+		public:
+
+			//! @param period	Period, timer ticks: 2..
+			SoftPwmClass(TIME_TYPE period) : m_Period(period), m_Front(&m_Schedules[0]), m_Pending(false), m_Step(0)
+			{
+				for(unsigned int i = 0; i < CHANNELS; i++)
+				{
+					m_Channels[i].Bsrr = NULL;
+					m_Duty[i] = 0;
+				}
+				build(m_Schedules[0]);
+			}
+
+			//! Sets the channel output
+			//! @param channel	Channel index: 0..CHANNELS-1
+			//! @param bsrr		Port BSRR register
+			//! @param on		BSRR bits to switch on the channel
+			//! @param off		BSRR bits to switch off the channel
+			//! @note Applied by @c Commit
+			bool SetChannel(unsigned int channel, volatile uint32_t *bsrr, uint32_t on, uint32_t off)
+			{
+				if(channel >= CHANNELS)
+					return false;
+				m_Channels[channel].Bsrr = bsrr;
+				m_Channels[channel].On = on;
+				m_Channels[channel].Off = off;
+				return true;
+			}
+
+			//! Sets the channel output pin
+			//! @param PIN		Pin type: Pin<port, pin_no, activestate>
+			//! @param channel	Channel index: 0..CHANNELS-1
+			//! @note Applied by @c Commit
+			template<class PIN>
+			bool SetChannel(unsigned int channel)
+			{
+				return SetChannel(channel, &((decltype(PIN::GPIOx.operator->()))PIN::GPIOx_BASE)->BSRR, PinBits<PIN>::On, PinBits<PIN>::Off);
+			}
+
+			//! Sets the channel duty
+			//! @param channel	Channel index: 0..CHANNELS-1
+			//! @param duty		Duty, timer ticks: 0 - off; 1..period-1; period.. - on
+			//! @note Applied by @c Commit
+			bool SetDuty(unsigned int channel, TIME_TYPE duty)
+			{
+				if(channel >= CHANNELS)
+					return false;
+				m_Duty[channel] = duty;
+				return true;
+			}
+
+			//! Gets the channel duty to commit
+			inline TIME_TYPE getDuty(unsigned int channel) const { return m_Duty[channel]; }
+
+			inline TIME_TYPE getPeriod() const { return m_Period; }
+
+			//! Checks is commit waiting for the period start
+			inline bool isPending() const { return m_Pending; }
+
+			//! Applies channels & duties since the next period start
+			//! @return True - success; false - previous commit is not applied yet (try later)
+			//! @note Called out of interrupt context
+			bool Commit()
+			{
+				if(m_Pending)
+					return false;
+				build(m_Front == &m_Schedules[0] ? m_Schedules[1] : m_Schedules[0]);
+				__asm__ __volatile__("" ::: "memory");
+				m_Pending = true;
+				return true;
+			}
+
+			//! Hardware timer compare interrupt handler
+			//! @return Time to next interrupt, timer ticks
+			//! @note Called from interrupt context
+			TIME_TYPE Interrupt()
+			{
+				if(m_Step == 0 && m_Pending)
+				{
+					// period start // swap schedules
+					m_Front = m_Front == &m_Schedules[0] ? &m_Schedules[1] : &m_Schedules[0];
+					m_Pending = false;
+				}
+				auto schedule = m_Front;
+				auto &step = schedule->Steps[m_Step];
+				for(auto write = &schedule->Writes[step.First]; write < &schedule->Writes[step.First + step.Count]; write++)
+					*write->Bsrr = write->Bits;
+				if(++m_Step >= schedule->StepsCount)
+				{
+					m_Step = 0;
+					return m_Period - step.Time;
+				}
+				return schedule->Steps[m_Step].Time - step.Time;
+			}
+		};
+	}
+}
+
+#endif /* SRC_LIB_SOFTPWM_HPP_ */
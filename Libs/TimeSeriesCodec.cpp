@@ -0,0 +1,247 @@
+/**
+ * Streaming codec of time series: timestamps, samples, counters
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include "Libs/TimeSeriesCodec.hpp"
+
+namespace System
+{
+	namespace Codec
+	{
+		/**
+		 * Bit-packed block:
+		 * - header byte: bits 0..5 - bits width of residuals: 0..32; bit 7 - not complete block, next byte is residuals count
+		 * - residuals: bits width each, LSB first
+		 */
+		static const uint8_t BlockPartialFlag = 0x80;
+
+		unsigned int VarIntWrite(uint8_t *buffer, size_t size, uint32_t value)
+		{
+			unsigned int i = 0;
+			for(; value >= 0x80; value >>= 7)
+			{
+				if(i >= size)
+					return 0;
+				buffer[i++] = (uint8_t)value | 0x80;
+			}
+			if(i >= size)
+				return 0;
+			buffer[i++] = (uint8_t)value;
+			return i;
+		}
+
+		unsigned int VarIntRead(const uint8_t *data, size_t len, uint32_t &value)
+		{
+			uint32_t v = 0;
+			for(unsigned int i = 0; i < len && i < 5; i++)
+			{
+				v |= (uint32_t)(data[i] & 0x7F) << (7 * i);
+				if((data[i] & 0x80) == 0)
+				{
+					value = v;
+					return i + 1;
+				}
+			}
+			return 0;
+		}
+
+		//! Bits width of value: 0..32
+		static inline unsigned int bitsWidth(uint32_t v)
+		{
+			return v == 0 ? 0 : 32 - __builtin_clz(v);
+		}
+
+		// TimeSeriesEncoderClass
+
+		TimeSeriesEncoderClass::TimeSeriesEncoderClass(uint8_t *buffer, size_t size, OptionsStruct options) :
+			m_Buffer(buffer), m_Size(size), m_Length(0), m_Options(options), m_BlockBits(0), m_BlockCount(0)
+		{
+			if(m_Size > 0)
+				m_Buffer[m_Length++] = m_Options.toByte();
+		}
+
+		uint32_t TimeSeriesEncoderClass::residual(uint32_t value)
+		{
+			uint32_t r = value;
+			if(m_Options.Order > 0)
+			{
+				// delta
+				auto delta = m_Delta.Count > 0 ? value - m_Delta.Previous : value;
+				r = delta;
+				if(m_Options.Order > 1)
+					r = m_Delta.Count > 1 ? delta - m_Delta.PreviousDelta : delta; // delta of delta
+				m_Delta.PreviousDelta = delta;
+			}
+			m_Delta.Previous = value;
+			m_Delta.Count++;
+			return m_Options.ZigZag ? ZigZagEncode(r) : r;
+		}
+
+		//! Length of bit-packed block, bytes
+		static inline size_t blockLength(unsigned int count, unsigned int width)
+		{
+			return 1 + (count < BlockLength ? 1 : 0) + (width * count + 7) / 8;
+		}
+
+		bool TimeSeriesEncoderClass::writeBlock()
+		{
+			if(m_BlockCount == 0)
+				return true;
+			auto width = bitsWidth(m_BlockBits);
+			auto partial = m_BlockCount < BlockLength;
+			auto len = blockLength(m_BlockCount, width);
+			if(m_Length + len > m_Size)
+				return false;
+			auto p = &m_Buffer[m_Length];
+			*p++ = (uint8_t)width | (partial ? BlockPartialFlag : 0);
+			if(partial)
+				*p++ = m_BlockCount;
+			// pack residuals, LSB first
+			uint64_t acc = 0;
+			unsigned int accBits = 0;
+			for(unsigned int i = 0; i < m_BlockCount; i++)
+			{
+				acc |= (uint64_t)m_Block[i] << accBits;
+				accBits += width;
+				for(; accBits >= 8; accBits -= 8, acc >>= 8)
+					*p++ = (uint8_t)acc;
+			}
+			if(accBits > 0)
+				*p++ = (uint8_t)acc;
+			m_Length += len;
+			m_BlockCount = 0;
+			m_BlockBits = 0;
+			return true;
+		}
+
+		bool TimeSeriesEncoderClass::Put(uint32_t value)
+		{
+			if(m_Size == 0)
+				return false;
+			// keep delta state to restore if no space
+			auto delta = m_Delta;
+			auto r = residual(value);
+			if(m_Options.Packed)
+			{
+				// buffered values are encoded: the block with the value must fit (as partial block by Flush)
+				auto bits = m_BlockBits | r;
+				if(m_Length + blockLength(m_BlockCount + 1, bitsWidth(bits)) > m_Size)
+				{
+					m_Delta = delta;
+					return false;
+				}
+				m_Block[m_BlockCount++] = r;
+				m_BlockBits = bits;
+				if(m_BlockCount == BlockLength)
+					writeBlock();
+				return true;
+			}
+			auto len = VarIntWrite(&m_Buffer[m_Length], m_Size - m_Length, r);
+			if(len == 0)
+			{
+				m_Delta = delta;
+				return false;
+			}
+			m_Length += len;
+			return true;
+		}
+
+		bool TimeSeriesEncoderClass::Flush()
+		{
+			return writeBlock();
+		}
+
+		// TimeSeriesDecoderClass
+
+		TimeSeriesDecoderClass::TimeSeriesDecoderClass(const uint8_t *data, size_t len) :
+			m_Data(data), m_Len(len), m_Offset(0), m_BlockCount(0), m_BlockIndex(0)
+		{
+			if(m_Len > 0)
+				m_Options = OptionsStruct::fromByte(m_Data[m_Offset++]);
+		}
+
+		uint32_t TimeSeriesDecoderClass::value(uint32_t residual)
+		{
+			uint32_t r = m_Options.ZigZag ? ZigZagDecode(residual) : residual;
+			uint32_t v = r;
+			if(m_Options.Order > 0)
+			{
+				auto delta = r;
+				if(m_Options.Order > 1 && m_Delta.Count > 1)
+					delta = r + m_Delta.PreviousDelta; // delta of delta
+				v = m_Delta.Count > 0 ? m_Delta.Previous + delta : delta;
+				m_Delta.PreviousDelta = delta;
+			}
+			m_Delta.Previous = v;
+			m_Delta.Count++;
+			return v;
+		}
+
+		bool TimeSeriesDecoderClass::readBlock()
+		{
+			if(m_Offset >= m_Len)
+				return false;
+			auto header = m_Data[m_Offset];
+			unsigned int width = header & 0x3F;
+			unsigned int count = BlockLength;
+			size_t offset = m_Offset + 1;
+			if(header & BlockPartialFlag)
+			{
+				if(offset >= m_Len)
+					return false;
+				count = m_Data[offset++];
+				if(count == 0 || count > BlockLength)
+					return false;
+			}
+			if(width > 32 || offset + (width * count + 7) / 8 > m_Len)
+				return false; // wrong or not complete block
+			// unpack residuals, LSB first
+			auto p = &m_Data[offset];
+			uint64_t acc = 0;
+			unsigned int accBits = 0;
+			const uint64_t mask = width == 32 ? 0xFFFFFFFFULL : (1ULL << width) - 1;
+			for(unsigned int i = 0; i < count; i++)
+			{
+				for(; accBits < width; accBits += 8)
+					acc |= (uint64_t)*p++ << accBits;
+				m_Block[i] = (uint32_t)(acc & mask);
+				acc >>= width;
+				accBits -= width;
+			}
+			m_Offset = offset + (width * count + 7) / 8;
+			m_BlockCount = count;
+			m_BlockIndex = 0;
+			return true;
+		}
+
+		bool TimeSeriesDecoderClass::Get(uint32_t &v)
+		{
+			uint32_t r;
+			if(m_Options.Packed)
+			{
+				if(m_BlockIndex >= m_BlockCount && !readBlock())
+					return false;
+				r = m_Block[m_BlockIndex++];
+			}
+			else
+			{
+				auto len = VarIntRead(&m_Data[m_Offset], m_Len - m_Offset, r);
+				if(len == 0)
+					return false;
+				m_Offset += len;
+			}
+			v = value(r);
+			return true;
+		}
+
+		size_t TimeSeriesDecoderClass::Get(uint32_t *values, size_t count)
+		{
+			size_t i = 0;
+			for(; i < count && Get(values[i]); i++);
+			return i;
+		}
+	}
+}
@@ -0,0 +1,162 @@
+/**
+ * Streaming codec of time series: timestamps, samples, counters
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Each value passes the stages:
+ * - delta: value (order 0), delta (order 1) or delta-of-delta (order 2) from previous values
+ * - zigzag: signed residual maps to unsigned: 0, -1, 1, -2 ... to 0, 1, 2, 3 ...
+ * - packing: varint (LEB128, 7 bits per byte) or bit-packed blocks (@c BlockLength residuals with the same bits width)
+ * So, timestamps with constant period (delta-of-delta is zero) take 1 bit per value by bit-packed blocks,
+ * slowly changing samples take 1 byte per value by varint.
+ * Stream starts with options byte. So decoder is configured by stream itself.
+ * No heap: encoder & decoder work with user buffer.
+ */
+
+/**
+ * @page TimeSeriesCodec
+ * @par Usage
+ * @code
+#include "Libs/TimeSeriesCodec.hpp"
+
+uint8_t buffer[256];
+System::Codec::TimeSeriesEncoderClass encoder(buffer, sizeof(buffer), System::Codec::OptionsStruct(2, true, true));
+for(auto timestamp : timestamps)
+	if(!encoder.Put(timestamp))
+		break; // buffer is full
+encoder.Flush();
+send(buffer, encoder.getLength());
+
+System::Codec::TimeSeriesDecoderClass decoder(buffer, length);
+uint32_t value;
+while(decoder.Get(value))
+	process(value);
+ * @endcode
+ */
+
+#ifndef SRC_LIB_TIMESERIESCODEC_HPP_
+#define SRC_LIB_TIMESERIESCODEC_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace System
+{
+	namespace Codec
+	{
+		//! Residuals count of bit-packed block
+		static const unsigned int BlockLength = 16;
+
+		//! Codec options
+		//! @note Stored to first byte of stream
+		struct OptionsStruct
+		{
+			uint8_t Order : 2; //!< Delta order: 0 - values; 1 - deltas; 2 - deltas of deltas
+			bool ZigZag : 1; //!< True - zigzag encoding of residuals (for negative deltas)
+			bool Packed : 1; //!< True - bit-packed blocks; false - varint
+			OptionsStruct(uint8_t order = 1, bool zigZag = true, bool packed = false) : Order(order), ZigZag(zigZag), Packed(packed) {}
+			inline uint8_t toByte() const { return Order | (ZigZag ? 4 : 0) | (Packed ? 8 : 0); }
+			static inline OptionsStruct fromByte(uint8_t b) { return OptionsStruct(b & 3, (b & 4) != 0, (b & 8) != 0); }
+		};
+
+		//! ZigZag encoding of signed value
+		static inline uint32_t ZigZagEncode(uint32_t v) { return (v << 1) ^ (uint32_t)((int32_t)v >> 31); }
+
+		//! ZigZag decoding to signed value
+		static inline uint32_t ZigZagDecode(uint32_t v) { return (v >> 1) ^ (0 - (v & 1)); }
+
+		//! Writes varint (LEB128)
+		//! @return Bytes count: 1..5; 0 - not enough space
+		unsigned int VarIntWrite(uint8_t *buffer, size_t size, uint32_t value);
+
+		//! Reads varint (LEB128)
+		//! @return Bytes count: 1..5; 0 - not enough data or wrong varint
+		unsigned int VarIntRead(const uint8_t *data, size_t len, uint32_t &value);
+
+		//! Delta stage state
+		struct DeltaStruct
+		{
+			uint32_t Previous; //!< Previous value
+			uint32_t PreviousDelta; //!< Previous delta
+			uint32_t Count; //!< Values count
+
+			DeltaStruct() : Previous(0), PreviousDelta(0), Count(0) {}
+		};
+
+		//! Time series encoder
+		class TimeSeriesEncoderClass
+		{
+		protected:
+			uint8_t *m_Buffer;
+			size_t m_Size; //!< Buffer size, bytes
+			size_t m_Length; //!< Encoded data length, bytes
+			OptionsStruct m_Options;
+			DeltaStruct m_Delta;
+			uint32_t m_Block[BlockLength]; //!< Residuals of bit-packed block
+			uint32_t m_BlockBits; //!< Bits of residuals of block: bits width
+			uint8_t m_BlockCount;
+
+			uint32_t residual(uint32_t value);
+			bool writeBlock();
+
+		public:
+
+			//! @param buffer	Buffer to write to
+			//! @param size		Buffer size, bytes
+			//! @param options	Codec options
+			TimeSeriesEncoderClass(uint8_t *buffer, size_t size, OptionsStruct options = OptionsStruct());
+
+			//! Encodes value
+			//! @note Bit-packed value is accepted if its block fits the buffer: @c Flush of accepted values doesn't fail
+			//! @return True - success; false - buffer is full (value is not encoded)
+			bool Put(uint32_t value);
+
+			//! Writes not complete bit-packed block
+			//! @return True - success (always for the values accepted by @c Put)
+			bool Flush();
+
+			//! Encoded data length, bytes
+			//! @note Call @c Flush to include not complete bit-packed block
+			inline size_t getLength() const { return m_Length; }
+
+			//! Count of encoded values
+			inline uint32_t getCount() const { return m_Delta.Count; }
+		};
+
+		//! Time series decoder
+		class TimeSeriesDecoderClass
+		{
+		protected:
+			const uint8_t *m_Data;
+			size_t m_Len; //!< Data length, bytes
+			size_t m_Offset; //!< Read offset, bytes
+			OptionsStruct m_Options;
+			DeltaStruct m_Delta;
+			uint32_t m_Block[BlockLength]; //!< Residuals of bit-packed block
+			uint8_t m_BlockCount;
+			uint8_t m_BlockIndex;
+
+			uint32_t value(uint32_t residual);
+			bool readBlock();
+
+		public:
+
+			//! @param data		Encoded data: options byte & values
+			//! @param len		Data length, bytes
+			TimeSeriesDecoderClass(const uint8_t *data, size_t len);
+
+			//! Decodes value
+			//! @return True - success; false - no more data
+			bool Get(uint32_t &value);
+
+			//! Decodes values
+			//! @return Count of decoded values
+			size_t Get(uint32_t *values, size_t count);
+
+			inline OptionsStruct getOptions() const { return m_Options; }
+		};
+	}
+}
+
+#endif /* SRC_LIB_TIMESERIESCODEC_HPP_ */
@@ -0,0 +1,28 @@
+/**
+ * Binary trace: timestamped events ring buffer of fixed size records
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include "Libs/Trace.hpp"
+#include <string.h>
+
+#ifdef TRACE_BUFFER_SIZE
+
+namespace Trace
+{
+	BufferStruct Buffer;
+
+	void Init()
+	{
+		memset(&Buffer, 0, sizeof(Buffer));
+		Buffer.Header.Version = 1;
+		Buffer.Header.RecordSize = sizeof(RecordStruct);
+		Buffer.Header.Capacity = TRACE_BUFFER_SIZE;
+		Buffer.Header.Frequency = TRACE_TIMESTAMP_FREQUENCY;
+		Buffer.Header.Magic = HeaderMagic;
+	}
+}
+
+#endif
@@ -0,0 +1,257 @@
+/**
+ * Binary trace: timestamped events ring buffer of fixed size records
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Trace event is a compile time ID & two 32-bit arguments. Event writes one 16 bytes record:
+ * atomic reservation of ring slot (LDREX/STREX on Cortex-M3+, interrupts masking for a few cycles on Cortex-M0),
+ * timestamp & four stores. So ISRs & message loop write to one ring without locks.
+ * Ring overwrites oldest records (flight recorder). Each record is committed by the last store of lap tag:
+ * decoder skips records torn by dump (debugger halt) or by producer lapped by others.
+ * Trace is disabled by default: all the trace macros compile to nothing. Events can be filtered at compile time.
+ * Dump of @c Trace::Buffer (header & records) is converted by Tools/trace_decode.py to Perfetto (Chrome JSON) trace.
+ */
+
+/**
+ * @page Trace
+ * @par Config
+ * Compiler flag to enable the trace:
+ * @code
+-DTRACE_CONFIG='"TraceConfig.h"'
+ * @endcode
+ * TraceConfig.h file:
+ * @code
+#include "stm32l4xx.h"
+#define TRACE_BUFFER_SIZE 256 // records count: power of 2
+#define TRACE_TIMESTAMP() SystemTime // default: Profile::Cycles() (see Libs/Profile.hpp)
+#define TRACE_TIMESTAMP_FREQUENCY 1000
+TRACE_FILTER(Trace::TimerCallback) // compile out the events
+ * @endcode
+ * @par Usage
+ * @code
+#include "Libs/Trace.hpp"
+enum { MyEvent = Trace::User };
+
+Profile::Init(); // default timestamp: cycles counter
+Trace::Init();
+
+void function(uint32_t arg)
+{
+	TRACE_SCOPE(MyEvent, arg); // begin & end records
+	TRACE_EVENT(MyEvent + 1, arg, 2); // instant record
+	TRACE_COUNTER(MyEvent + 2, level);
+}
+
+usb.send(&Trace::Buffer, sizeof(Trace::Buffer)); // dump
+ * @endcode
+ * Host:
+ * @code
+python3 Tools/trace_decode.py dump.bin -o trace.json # open by ui.perfetto.dev
+ * @endcode
+ */
+
+#ifndef SRC_LIB_TRACE_HPP_
+#define SRC_LIB_TRACE_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Port/Port.h"
+#include "Libs/Atomic.hpp"
+
+namespace Trace
+{
+	//! Trace events of the framework
+	//! @note Values are the part of dump format: append only
+	enum EventEnum : uint16_t
+	{
+		TimerCallback = 1,			//!< Timer callback: table index
+		ServicesStateChanged = 2,	//!< Service state changed: service index, state bits
+		ServicesCallback = 3,		//!< Service callback: callee service index, caller service index
+		ServicesEnable = 4,			//!< Service enabled/disabled: service index, enable
+		ServicesLocalState = 5,		//!< Service local state set (usually from ISR): service index, state bits
+		UsbSetupRequest = 6,		//!< SETUP request: bmRequestType | bRequest << 8 | wValue << 16, wIndex | wLength << 16
+		UsbState = 7,				//!< USB connection state changed: new state, previous state
+		PageCacheFlush = 8,			//!< Page cache flush: page address
+		PageCacheSetData = 9,		//!< Page cache write: address, length
+		PageCacheGetData = 10,		//!< Page cache read: address, length
+		StoragePageCheck = 11,		//!< Page storage check: page address
+		LpTimerCallback = 12,		//!< Low-power timer callback: table index
+		CyclicTask = 13,			//!< Cyclic executive task: task index
+		TimerIsrCallback = 14,		//!< ISR class timer callback: table index
+		AcquisitionBlock = 15,		//!< Acquisition DMA block completed: block sequence, ring half
+		HsmTransition = 16,			//!< State machine transition: transition index, target leaf state
+		User = 0x100,				//!< First event of user: User, User + 1 ...
+		Log = 0x8000,				//!< First event of log messages (see Libs/Log.hpp)
+	};
+
+	//! Record kind
+	enum class KindEnum : uint8_t
+	{
+		Instant,	//!< Instant event
+		Begin,		//!< Begin of slice
+		End,		//!< End of slice
+		Counter,	//!< Counter value: first argument
+		Data,		//!< Continuation of previous record: more arguments
+	};
+
+	//! Trace record
+	//! @note Tag is written last: commit of record
+	struct RecordStruct
+	{
+		uint32_t Timestamp;
+		uint32_t Tag;	//!< Bits 0..15 - event; bits 16..19 - @c KindEnum; bit 23 - written by ISR; bits 24..31 - lap of ring: 1..255 (0 - empty record)
+		uint32_t Arg0;
+		uint32_t Arg1;
+
+		inline uint16_t getEvent() const { return (uint16_t)Tag; }
+		inline KindEnum getKind() const { return (KindEnum)((Tag >> 16) & 0x0F); }
+		inline uint8_t getLap() const { return Tag >> 24; }
+	};
+	static_assert(sizeof(RecordStruct) == 16, "Trace record must be 16 bytes");
+
+	//! ISR flag of record kind
+	static const uint8_t IsrFlag = 0x80;
+
+	//! Dump header
+	struct HeaderStruct
+	{
+		uint32_t Magic;		//!< @c HeaderMagic
+		uint16_t Version;	//!< Dump format version
+		uint16_t RecordSize; //!< Record size, bytes
+		uint32_t Capacity;	//!< Records count of ring
+		uint32_t Frequency;	//!< Timestamp frequency, Hz
+		volatile uint32_t Head; //!< Index of next record (not wrapped): 0..
+		uint32_t Reserved[3];
+	};
+	static_assert(sizeof(HeaderStruct) == 32, "Trace header must be 32 bytes");
+
+	static const uint32_t HeaderMagic = 0x31435254; // "TRC1"
+
+	//! Events filter: not enabled event compiles to nothing
+	template<unsigned EVENT>
+	struct Filter
+	{
+		static const bool Enabled = true;
+	};
+}
+
+//! Disables event at compile time. Used by config file
+#define TRACE_FILTER(event) namespace Trace { template<> struct Filter<event> { static const bool Enabled = false; }; }
+
+#ifdef TRACE_CONFIG
+#	include TRACE_CONFIG
+#endif
+
+#ifdef TRACE_BUFFER_SIZE
+
+static_assert(TRACE_BUFFER_SIZE > 0 && (TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) == 0, "TRACE_BUFFER_SIZE must be power of 2");
+
+#ifndef TRACE_TIMESTAMP
+#	include "Libs/Profile.hpp"
+#	define TRACE_TIMESTAMP() Profile::Cycles()
+#	define TRACE_TIMESTAMP_FREQUENCY Profile::Frequency()
+#endif
+
+namespace Trace
+{
+	//! Ring buffer: dump format
+	struct BufferStruct
+	{
+		HeaderStruct Header;
+		RecordStruct Records[TRACE_BUFFER_SIZE];
+	};
+
+	extern BufferStruct Buffer;
+
+	//! Clears ring & sets dump header
+	void Init();
+
+	//! Reserves consecutive records
+	//! @return Index of first record (not wrapped)
+	inline uint32_t Reserve(uint32_t count)
+	{
+		return System::Atomic::FetchAdd((uint32_t*)&Buffer.Header.Head, count);
+	}
+
+	//! Returns ISR flag of record kind
+	inline uint8_t isrFlag()
+	{
+#if defined(__arm__)
+		uint32_t ipsr;
+		__asm volatile ("mrs %0, ipsr" : "=r" (ipsr));
+		return ipsr != 0 ? IsrFlag : 0;
+#else
+		return 0;
+#endif
+	}
+
+	//! Writes reserved record
+	//! @param index	Record index (not wrapped)
+	inline void Write(uint32_t index, uint16_t event, uint8_t kind, uint32_t timestamp, uint32_t arg0, uint32_t arg1)
+	{
+		auto &record = Buffer.Records[index & (TRACE_BUFFER_SIZE - 1)];
+		record.Timestamp = timestamp;
+		record.Arg0 = arg0;
+		record.Arg1 = arg1;
+		__asm volatile ("" ::: "memory"); // tag is the last store
+		*(volatile uint32_t*)&record.Tag = event | (uint32_t)kind << 16 | (uint32_t)((index / TRACE_BUFFER_SIZE) % 255 + 1) << 24;
+	}
+
+	//! Writes event record
+	template<unsigned EVENT>
+	inline void Event(KindEnum kind, uint32_t arg0 = 0, uint32_t arg1 = 0)
+	{
+		if(Filter<EVENT>::Enabled)
+		{
+			auto timestamp = TRACE_TIMESTAMP();
+			Write(Reserve(1), EVENT, (uint8_t)kind | isrFlag(), timestamp, arg0, arg1);
+		}
+	}
+
+	//! Begin & end records of the scope
+	template<unsigned EVENT>
+	struct Scope
+	{
+		uint32_t m_Arg;
+		inline Scope(uint32_t arg) : m_Arg(arg) { Event<EVENT>(KindEnum::Begin, arg); }
+		inline ~Scope() { Event<EVENT>(KindEnum::End, m_Arg); }
+	};
+}
+
+#define _TRACE_CONCAT2(a, b) a##b
+#define _TRACE_CONCAT(a, b) _TRACE_CONCAT2(a, b)
+
+//! Instant event: up to two arguments
+#define TRACE_EVENT(event, ...) Trace::Event<event>(Trace::KindEnum::Instant, ##__VA_ARGS__)
+
+//! Begin of slice: up to two arguments
+#define TRACE_BEGIN(event, ...) Trace::Event<event>(Trace::KindEnum::Begin, ##__VA_ARGS__)
+
+//! End of slice: up to two arguments
+#define TRACE_END(event, ...) Trace::Event<event>(Trace::KindEnum::End, ##__VA_ARGS__)
+
+//! Counter value
+#define TRACE_COUNTER(event, value) Trace::Event<event>(Trace::KindEnum::Counter, value)
+
+//! Begin & end of slice by scope
+#define TRACE_SCOPE(event, arg) Trace::Scope<event> _TRACE_CONCAT(_TraceScope, __LINE__)(arg)
+
+#else
+
+namespace Trace
+{
+	inline void Init() {}
+}
+
+// trace is disabled: arguments are not evaluated
+
+#define TRACE_EVENT(event, ...) do {} while(0)
+#define TRACE_BEGIN(event, ...) do {} while(0)
+#define TRACE_END(event, ...) do {} while(0)
+#define TRACE_COUNTER(event, value) do {} while(0)
+#define TRACE_SCOPE(event, arg) do {} while(0)
+
+#endif
+
+#endif /* SRC_LIB_TRACE_HPP_ */
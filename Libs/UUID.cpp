@@ -6,7 +6,6 @@
  */
 
 #include "UUID.hpp"
-#include <string.h>
 
 namespace System
 {
@@ -18,11 +17,58 @@ namespace System
 //! @addtogroup UUID_External_Functions
 //! @{
 
-	bool UUID::IsEqual(const UUID * o1, const UUID * o2)
+	UUID UuidDetail::WrongUuidString()
 	{
-		if(o1 == NULL || o2 == NULL)
+		return UUID{{ 0 }};
+	}
+
+	bool UUID::Parse(const char *s, UUID &uuid)
+	{
+		if(s == NULL || strlen(s) != StringLength || !UuidDetail::isDashes(s))
 			return false;
-		return memcmp(o1, o2, sizeof(UUID)) == 0;
+		for(unsigned int i = 0; i < sizeof(uuid.Bytes); i++)
+		{
+			auto p = UuidDetail::position(i);
+			if(!UuidDetail::isHex(s[p]) || !UuidDetail::isHex(s[p + 1]))
+				return false;
+			uuid.Bytes[i] = UuidDetail::byte(s, i);
+		}
+		return true;
+	}
+
+	UUID UUID::V4(const uint32_t *random)
+	{
+		UUID uuid;
+		memcpy(uuid.Bytes, random, sizeof(uuid.Bytes));
+		uuid.Bytes[6] = 0x40 | (uuid.Bytes[6] & 0x0F); // version
+		uuid.Bytes[8] = 0x80 | (uuid.Bytes[8] & 0x3F); // variant
+		return uuid;
+	}
+
+	UUID UUID::V7(uint64_t unixMs, uint16_t counter, const uint32_t *random)
+	{
+		UUID uuid;
+		// 48 bits of time, big-endian: byte order is time order
+		for(unsigned int i = 0; i < 6; i++)
+			uuid.Bytes[i] = (uint8_t)(unixMs >> (40 - i * 8));
+		uuid.Bytes[6] = 0x70 | ((counter >> 8) & 0x0F); // version & counter
+		uuid.Bytes[7] = (uint8_t)counter;
+		memcpy(&uuid.Bytes[8], random, 8);
+		uuid.Bytes[8] = 0x80 | (uuid.Bytes[8] & 0x3F); // variant
+		return uuid;
+	}
+
+	void UUID::ToString(char *str) const
+	{
+		static const char digits[] = "0123456789abcdef";
+		for(unsigned int i = 0; i < sizeof(Bytes); i++)
+		{
+			auto p = UuidDetail::position(i);
+			str[p] = digits[Bytes[i] >> 4];
+			str[p + 1] = digits[Bytes[i] & 0x0F];
+		}
+		str[8] = str[13] = str[18] = str[23] = '-';
+		str[StringLength] = '\0';
 	}
 
 //! @}
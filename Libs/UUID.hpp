@@ -3,12 +3,34 @@
  * @version 1
  * @author Victoria Danchenko
  * @date 15/06/2011
+ *
+ * @note Compare & hash work by machine words (2x64 or 4x32 bits) of any alignment: bytes are loaded by @c memcpy,
+ * so compiler emits word loads (unaligned loads on Cortex-M3+, x86).
+ * Constant UUID is parsed from canonical string at compile time: wrong string of constexpr UUID is compile error.
+ */
+
+/**
+ * @page UUID
+ * @par Usage
+ * @code
+#include "Libs/UUID.hpp"
+
+static constexpr System::UUID DeviceUUID = System::UUID::Parse("b024f2dc-72ea-11e8-858e-2cfda1e1cef5"); // compile time
+
+if(uuid == DeviceUUID)
+	...
+auto hash = uuid.Hash();
+char str[System::UUID::StringLength + 1];
+uuid.ToString(str);
+ * @endcode
  */
 
 #ifndef UUID_HPP_
 #define UUID_HPP_
 
 #include <cstdint>
+#include <cstddef>
+#include <string.h>
 
 namespace System
 {
@@ -20,10 +42,136 @@ namespace System
 //! @addtogroup UUID_Exported_Types
 //! @{
 
+	struct UUID;
+
+	namespace UuidDetail
+	{
+		//! Not constexpr: call of it while parse at compile time is compile error
+		//! @return Nil UUID: wrong string parsed at run time
+		UUID WrongUuidString();
+
+		constexpr bool isHex(char c)
+		{
+			return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+		}
+
+		//! @return Hex digit value: 0..15 (the digit is checked by @c isHex)
+		constexpr uint8_t hexDigit(char c)
+		{
+			return c <= '9' ? c - '0' : c <= 'F' ? c - 'A' + 10 : c - 'a' + 10;
+		}
+
+		//! Position of byte into canonical string: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
+		constexpr unsigned int position(unsigned int i)
+		{
+			return i * 2 + (i >= 4) + (i >= 6) + (i >= 8) + (i >= 10);
+		}
+
+		constexpr bool isDashes(const char *s)
+		{
+			return s[8] == '-' && s[13] == '-' && s[18] == '-' && s[23] == '-';
+		}
+
+		//! Hex digits of bytes i..15
+		constexpr bool isDigits(const char *s, unsigned int i = 0)
+		{
+			return i == 16 || (isHex(s[position(i)]) && isHex(s[position(i) + 1]) && isDigits(s, i + 1));
+		}
+
+		//! Canonical string of @c UUID::StringLength characters at least
+		constexpr bool isValid(const char *s)
+		{
+			return isDashes(s) && isDigits(s);
+		}
+
+		constexpr uint8_t byte(const char *s, unsigned int i)
+		{
+			return (uint8_t)(hexDigit(s[position(i)]) << 4 | hexDigit(s[position(i) + 1]));
+		}
+
+		//! Machine word of compare & hash
+#if UINTPTR_MAX > 0xFFFFFFFFu
+		typedef uint64_t Word;
+#else
+		typedef uint32_t Word;
+#endif
+		static const unsigned int WordsCount = 16 / sizeof(Word);
+	}
+
 	struct UUID
 	{
+		//! Length of canonical string (without null terminator)
+		static const unsigned int StringLength = 36;
+
 		uint8_t Bytes[16];
-		static bool IsEqual(const UUID * UUID1, const UUID * UUID2);
+
+		//! Parses canonical string: "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx"
+		//! @note Compile time for constexpr: wrong string is compile error; at run time wrong string is nil UUID
+		//! (@see Parse(const char *, UUID &) to check the string)
+		template<size_t N>
+		static constexpr UUID Parse(const char (&s)[N])
+		{
+			return N != StringLength + 1 || !UuidDetail::isValid(s) ? UuidDetail::WrongUuidString() : UUID{{
+				UuidDetail::byte(s, 0), UuidDetail::byte(s, 1), UuidDetail::byte(s, 2), UuidDetail::byte(s, 3),
+				UuidDetail::byte(s, 4), UuidDetail::byte(s, 5), UuidDetail::byte(s, 6), UuidDetail::byte(s, 7),
+				UuidDetail::byte(s, 8), UuidDetail::byte(s, 9), UuidDetail::byte(s, 10), UuidDetail::byte(s, 11),
+				UuidDetail::byte(s, 12), UuidDetail::byte(s, 13), UuidDetail::byte(s, 14), UuidDetail::byte(s, 15) }};
+		}
+
+		//! Parses canonical string at run time
+		//! @return True - success; false - wrong string
+		static bool Parse(const char *s, UUID &uuid);
+
+		//! Makes random UUID (version 4)
+		//! @param random		Random words: 4
+		static UUID V4(const uint32_t *random);
+
+		//! Makes time-ordered UUID (version 7)
+		//! @param unixMs		Unix time, mS: 48 bits
+		//! @param counter		12 bits of sub-millisecond counter: monotonic order of UUIDs of the same millisecond
+		//! @param random		Random words: 2
+		static UUID V7(uint64_t unixMs, uint16_t counter, const uint32_t *random);
+
+		//! UUID version: 4 - random, 7 - time-ordered e.t.c.
+		inline unsigned int getVersion() const { return Bytes[6] >> 4; }
+
+		//! Writes canonical string (lower case) & null terminator
+		//! @param str		Buffer of @c StringLength + 1 bytes
+		void ToString(char *str) const;
+
+		inline bool operator==(const UUID &o) const
+		{
+			UuidDetail::Word w1[UuidDetail::WordsCount], w2[UuidDetail::WordsCount];
+			memcpy(w1, Bytes, sizeof(w1));
+			memcpy(w2, o.Bytes, sizeof(w2));
+			UuidDetail::Word diff = 0;
+			for(unsigned int i = 0; i < UuidDetail::WordsCount; i++)
+				diff |= w1[i] ^ w2[i];
+			return diff == 0;
+		}
+
+		inline bool operator!=(const UUID &o) const { return !(*this == o); }
+
+		//! 32-bit hash: words are folded & mixed (MurmurHash3 finalizer)
+		//! @note Time-based UUIDs (v1, v7) differ by few bits: mixing spreads them to all hash bits
+		inline uint32_t Hash() const
+		{
+			uint32_t w[4];
+			memcpy(w, Bytes, sizeof(w));
+			uint32_t h = w[0] ^ ((w[1] << 8) | (w[1] >> 24)) ^ ((w[2] << 16) | (w[2] >> 16)) ^ ((w[3] << 24) | (w[3] >> 8));
+			h ^= h >> 16;
+			h *= 0x85EBCA6B;
+			h ^= h >> 13;
+			h *= 0xC2B2AE35;
+			h ^= h >> 16;
+			return h;
+		}
+
+		//! @return False - any UUID is NULL
+		static inline bool IsEqual(const UUID * UUID1, const UUID * UUID2)
+		{
+			return UUID1 != NULL && UUID2 != NULL && *UUID1 == *UUID2;
+		}
 	} __attribute__((packed));
 
 //! @}
@@ -1,27 +1,34 @@
 #include <string.h>
-#include "Libs/USBbase.hpp"
+#include "Libs/UsbBase.hpp"
+#include "Port/Port.h"
+#include "Libs/Probe.hpp"
+#include "Libs/Trace.hpp"
 
 namespace Usb
 {
-	bool UsbBase::setupRequest(EndpointStatusStruct *ep, const DataPointerStruct *data)
+	PORT_HOT bool UsbBase::setupRequest(EndpointStatusStruct *ep, const DataPointerStruct *data)
 	{
+		PROBE_SCOPE(Probe::UsbSetupRequest);
+
 		// standard SETUP request arrived // check the request
 		if(data->Len < sizeof(DeviceRequestStruct))
 			return false;
 
 		// save the SETUP request
 		memcpy(&ActiveSetupRequest, data->Data, sizeof(ActiveSetupRequest));
+		TRACE_EVENT(Trace::UsbSetupRequest, ActiveSetupRequest.bmRequestType | ActiveSetupRequest.bRequest << 8 | (uint32_t)ActiveSetupRequest.wValue << 16,
+			ActiveSetupRequest.wIndex | (uint32_t)ActiveSetupRequest.wLength << 16);
 
 		// process according to the standard SETUP request
 		// check request code - USB specification, table 9-4
-		switch(ActiveSetupRequest.bRequest)
+		switch((StandardRequestsEnum)ActiveSetupRequest.bRequest)
 		{
 			case StandardRequestsEnum::GET_DESCRIPTOR:
 				// USB specification, chapter 9.4.3
-				if(ActiveSetupRequest.bmRequestType != RequestTypeEnum::DIRECTION_DEVICE_TO_HOST)
+				if(ActiveSetupRequest.bmRequestType != (uint8_t)RequestTypeEnum::DIRECTION_DEVICE_TO_HOST)
 					return false;
 				// check descriptor type - USB specification, table 9-5
-				switch(ActiveSetupRequest.wValue.Bytes[1])
+				switch((DescriptorTypesEnum)ActiveSetupRequest.wValue.Bytes[1])
 				{
 					case DescriptorTypesEnum::DEVICE:
 						if(!getDeviceDescriptor(&_setupData))
@@ -33,13 +40,15 @@ namespace Usb
 						break;
 					case DescriptorTypesEnum::STRING:
 					{
-						if(!getStringDescriptor(ActiveSetupRequest.wValue.Bytes[0], uint16_le_get(&ActiveSetupRequest.wIndex), &_setupData))
+						if(!getStringDescriptor(ActiveSetupRequest.wValue.Bytes[0], ActiveSetupRequest.wIndex, &_setupData))
 							return false;
 						break;
 					}
+					default:
+						return false; // not supported descriptor type
 				}
 				// check for answer length limit
-				_setupData.reduceLen(uint16_le_get(&ActiveSetupRequest.wLength));
+				_setupData.reduceLen(ActiveSetupRequest.wLength);
 				break;
 
 			case StandardRequestsEnum::SET_ADDRESS:
@@ -96,7 +105,7 @@ namespace Usb
 			default:
 				// non-standard request
 
-				_setupData = data + sizeof(DeviceRequestStruct);
+				_setupData = *data + sizeof(DeviceRequestStruct);
 				if(!setupNonStandartRequest(ep, &_setupData))
 				{
 					_setupData.clear();
@@ -104,15 +113,17 @@ namespace Usb
 				}
 
 				// check for answer length limit
-				_setupData.reduceLen(uint16_le_get(&ActiveSetupRequest.wLength));
+				_setupData.reduceLen(ActiveSetupRequest.wLength);
 				break;
 		}
 
 		return true;
 	}
 
-	bool UsbBase::controlEPOutgoingData(EndpointStatusStruct *ep, DataPointerStruct *data)
+	PORT_HOT bool UsbBase::controlEPOutgoingData(EndpointStatusStruct *ep, DataPointerStruct *data)
 	{
+		PROBE_SCOPE(Probe::UsbControlEPOutgoingData);
+
 		if(_setupData.hasData())
 		{
 			// send answer for SETUP request
@@ -146,6 +157,7 @@ namespace Usb
 	{
 		if(_state != state)
 		{
+			TRACE_EVENT(Trace::UsbState, (uint32_t)state, (uint32_t)_state);
 			stateChanged(state);
 			_state = state;
 		}
@@ -157,6 +169,7 @@ namespace Usb
 		{
 			case StateEnum::UNCONNECTED:
 				_setupData.clear();
+				// fall through
 			case StateEnum::ATTACHED:
 				Current_Configuration = Current_Interface = Current_AlternateSetting = DeviceAddress = 0;
 				memset(&ActiveSetupRequest, 0, sizeof(ActiveSetupRequest));
@@ -356,9 +356,9 @@ namespace Usb
 	{
 		uint8_t bmRequestType;
 		uint8_t bRequest;
-		uint16_le_t wValue;
-		uint16_le_t wIndex;
-		uint16_le_t wLength;
+		BytesOrder::le<uint16_t> wValue;
+		BytesOrder::le<uint16_t> wIndex;
+		BytesOrder::le<uint16_t> wLength;
 	};
 
 	struct EndpointStatusStruct
@@ -377,21 +377,18 @@ namespace Usb
 
 		DataPointerStruct(uint8_t *data, uint len) : Data(data), Len(len) {}
 
-		inline const DataPointerStruct& operator=(const DataPointerStruct *data)
+		inline DataPointerStruct& operator=(const DataPointerStruct *data)
 		{
-			DataPointerStruct d(*data);
-			return d;
+			*this = *data;
+			return *this;
 		}
 
-		inline const DataPointerStruct& operator+(const uint offset)
+		//! @return Data piece after offset; empty - offset is out of data
+		inline DataPointerStruct operator+(const uint offset) const
 		{
-			if(this->Len >= offset)
-			{
-				DataPointerStruct data(NULL, 0);
-				return data;
-			}
-			DataPointerStruct data(this->Data + offset, this->Len - offset);
-			return data;
+			if(this->Len < offset)
+				return DataPointerStruct(NULL, 0);
+			return DataPointerStruct(this->Data + offset, this->Len - offset);
 		}
 
 		inline const bool set(const uint8_t *data, const uint len)
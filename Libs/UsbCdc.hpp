@@ -35,7 +35,7 @@ namespace Usb
 		//! USB CDC specification, table 50
 		struct _PACKED LineCodingStruct
 		{
-			uint32_t dwDTERate; //!< Data terminal rate, in bits per second
+			BytesOrder::le<uint32_t> dwDTERate; //!< Data terminal rate, in bits per second
 			uint8_t bCharFormat;//!< Stop bits: 0 - 1 Stop bit; 1 - 1.5 Stop bits; 2 - 2 Stop bits
 			uint8_t bParityType;//!< Parity: 0 - None; 1 - Odd; 2 - Even; 3 - Mark; 4 - Space
 			uint8_t bDataBits; //!< Data bits: 5, 6, 7, 8 or 16
@@ -47,6 +47,9 @@ namespace Usb
 		{
 			// non standard SETUP request arrived // process as CDC request
 
+			if((ActiveSetupRequest.bmRequestType & 0x60) == (uint8_t)RequestTypeEnum::TYPE_VENDOR) // type bits
+				return setupVendorRequest(ep, data);
+
 			if((ActiveSetupRequest.bmRequestType & ~(uint8_t)RequestTypeEnum::DIRECTION_DEVICE_TO_HOST)
 					!= ((uint8_t)RequestTypeEnum::TYPE_CLASS | (uint8_t)RequestTypeEnum::RECIPIENT_INTERFACE))
 				return false;
@@ -58,13 +61,13 @@ namespace Usb
 
 				case (uint8_t)RequestsEnum::SET_LINE_CODING:
 					// check request data
-					if(uint16_le_get(&ActiveSetupRequest.wLength) != sizeof(LineCodingStruct) || data->Len != sizeof(LineCodingStruct))
+					if(ActiveSetupRequest.wLength != sizeof(LineCodingStruct) || data->Len != sizeof(LineCodingStruct))
 						return false;
 					setLineCoding((LineCodingStruct *)data->Data);
 					break;
 
 				case (uint8_t)RequestsEnum::SET_CONTROL_LINE_STATE:
-					setControlLineState(uint16_le_get(&ActiveSetupRequest.wValue));
+					setControlLineState(ActiveSetupRequest.wValue);
 					break;
 
 				default:
@@ -76,6 +79,14 @@ namespace Usb
 
 		// Cdc implementation
 
+		/**
+		 * Vendor request of the device (diagnostics: metrics export e.t.c.)
+		 * @param ep		IN		Endpoint
+		 * @param data		IN, OUT	Request data IN & answer data OUT
+		 * @return True - valid request; false - unsupported request
+		 */
+		virtual bool setupVendorRequest(EndpointStatusStruct* ep, DataPointerStruct *data) { return false; }
+
 		/**
 		 * This request allows the host to specify typical asynchronous line-character formatting properties, which may be required by some applications.
 		 * This request applies to asynchronous byte stream data class interfaces and endpoints; it also applies to data transfers both from the host to the device and from the device to the host.
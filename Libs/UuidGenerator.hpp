@@ -0,0 +1,110 @@
+/**
+ * UUID generator: random (version 4) and time-ordered (version 7)
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Time of version 7 is the Unix time: RTC epoch (Unix time at some system time) plus system time passed since.
+ * System time (32 bits, mS) wraps each 49.7 days: generator extends it to 64 bits, so it must be called at least once per wrap period.
+ * UUIDs of the same millisecond are ordered by 12-bit counter (RFC 9562, method 1): counter starts from random value
+ * of 11 bits for each new millisecond, increments for each UUID; on counter overflow time is advanced by 1 mS.
+ * So UUIDs of the generator are strictly increasing (as bytes) even on burst rate or on RTC time step back.
+ * Generator is not reentrant: don't use the same generator from ISR and message loop.
+ */
+
+/**
+ * @page UuidGenerator
+ * @par Usage
+ * @code
+#include "Libs/UuidGenerator.hpp"
+#include "Services/Timer.h"
+
+static System::UuidGeneratorClass<> UuidGenerator;
+
+UuidGenerator.SetEpoch(rtcUnixMs, Timer::Now()); // after RTC read or time sync
+auto recordId = UuidGenerator.V7(Timer::Now()); // time-ordered: key of log-structured store
+auto objectId = UuidGenerator.V4(); // random
+ * @endcode
+ */
+
+#ifndef SRC_LIB_UUIDGENERATOR_HPP_
+#define SRC_LIB_UUIDGENERATOR_HPP_
+
+#include "Libs/UUID.hpp"
+#include "Libs/Random.hpp"
+
+namespace System
+{
+	//! UUID generator
+	//! @param RANDOM	Random source: returns 32 bits of entropy
+	template<uint32_t (*RANDOM)() = Random::Get>
+	class UuidGeneratorClass
+	{
+	protected:
+		static const uint16_t CounterMask = 0x0FFF;
+
+		uint64_t m_Epoch; //!< Unix time at system time 0, mS
+		uint64_t m_SystemTimeHigh; //!< Wraps of system time, shifted to high 32 bits
+		uint32_t m_SystemTime; //!< Last system time, mS
+		uint64_t m_LastTime; //!< Unix time of last version 7 UUID, mS
+		uint16_t m_Counter; //!< Counter of last version 7 UUID
+
+		//! Extends system time to 64 bits
+		uint64_t systemTime64(uint32_t systemTime)
+		{
+			if(systemTime < m_SystemTime)
+				m_SystemTimeHigh += 0x100000000ULL; // system time wrapped
+			m_SystemTime = systemTime;
+			return m_SystemTimeHigh | systemTime;
+		}
+
+	public:
+
+		UuidGeneratorClass() : m_Epoch(0), m_SystemTimeHigh(0), m_SystemTime(0), m_LastTime(0), m_Counter(0) {}
+
+		//! Sets RTC epoch
+		//! @param unixMs		Unix time, mS
+		//! @param systemTime	System time of @c unixMs, mS
+		void SetEpoch(uint64_t unixMs, uint32_t systemTime)
+		{
+			m_Epoch = unixMs - systemTime64(systemTime);
+		}
+
+		//! Returns Unix time, mS
+		//! @param systemTime	System time, mS
+		inline uint64_t UnixTime(uint32_t systemTime)
+		{
+			return m_Epoch + systemTime64(systemTime);
+		}
+
+		//! Returns random UUID (version 4)
+		UUID V4()
+		{
+			uint32_t random[4] = { RANDOM(), RANDOM(), RANDOM(), RANDOM() };
+			return UUID::V4(random);
+		}
+
+		//! Returns time-ordered UUID (version 7)
+		//! @param systemTime	System time, mS
+		UUID V7(uint32_t systemTime)
+		{
+			auto time = UnixTime(systemTime);
+			uint32_t random[2] = { RANDOM(), RANDOM() };
+			if(time > m_LastTime)
+			{
+				// new millisecond: random counter start with half range margin
+				m_LastTime = time;
+				m_Counter = (uint16_t)(RANDOM() >> 21);
+			}
+			else if(++m_Counter > CounterMask)
+			{
+				// burst: counter overflow // borrow next millisecond
+				m_LastTime++;
+				m_Counter = 0;
+			}
+			return UUID::V7(m_LastTime, m_Counter, random);
+		}
+	};
+}
+
+#endif /* SRC_LIB_UUIDGENERATOR_HPP_ */
@@ -0,0 +1,142 @@
+/**
+ * UUID-keyed hash map of fixed capacity
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Open addressing with linear probing. No heap: entries are the member array.
+ * Each slot has tag byte (7 bits of hash): probing compares tags first, so UUID of another key is rarely loaded.
+ * Removed slot becomes tombstone: probing goes through it; insertion reuses it.
+ */
+
+/**
+ * @page UuidMap
+ * @par Usage
+ * @code
+#include "Libs/UuidMap.hpp"
+
+static System::UuidMapClass<uint16_t, 32> Pages; // UUID -> page index
+
+Pages.Insert(uuid, 3);
+auto page = Pages.Find(uuid);
+if(page != NULL)
+	...
+Pages.Remove(uuid);
+ * @endcode
+ */
+
+#ifndef SRC_LIB_UUIDMAP_HPP_
+#define SRC_LIB_UUIDMAP_HPP_
+
+#include "Libs/UUID.hpp"
+
+namespace System
+{
+	//! UUID-keyed hash map
+	//! @param VALUE		Value type
+	//! @param CAPACITY		Slots count: power of 2
+	template<typename VALUE, unsigned int CAPACITY>
+	class UuidMapClass
+	{
+		static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "UuidMapClass: CAPACITY must be power of 2");
+
+	protected:
+		enum TagEnum : uint8_t
+		{
+			Empty = 0,
+			Removed = 1,
+			Used = 0x80, //!< Used slot flag; bits 0..6 - hash bits
+		};
+
+		struct EntryStruct
+		{
+			UUID Key;
+			VALUE Value;
+		};
+
+		uint8_t m_Tags[CAPACITY];
+		EntryStruct m_Entries[CAPACITY];
+		unsigned int m_Count; //!< Used slots count
+
+		static inline uint8_t tag(uint32_t hash) { return Used | (hash >> 25); }
+
+		//! @return Slot index; CAPACITY - not found
+		unsigned int find(const UUID &key, uint32_t hash) const
+		{
+			auto t = tag(hash);
+			for(unsigned int i = 0, slot = hash & (CAPACITY - 1); i < CAPACITY; i++, slot = (slot + 1) & (CAPACITY - 1))
+			{
+				if(m_Tags[slot] == Empty)
+					break;
+				if(m_Tags[slot] == t && m_Entries[slot].Key == key)
+					return slot;
+			}
+			return CAPACITY;
+		}
+
+	public:
+
+		UuidMapClass() { Clear(); }
+
+		//! Removes all entries
+		void Clear()
+		{
+			for(unsigned int i = 0; i < CAPACITY; i++)
+				m_Tags[i] = Empty;
+			m_Count = 0;
+		}
+
+		//! Inserts entry or replaces value of existing entry
+		//! @return True - success; false - map is full
+		bool Insert(const UUID &key, const VALUE &value)
+		{
+			auto hash = key.Hash();
+			auto slot = find(key, hash);
+			if(slot == CAPACITY)
+			{
+				if(m_Count >= CAPACITY)
+					return false;
+				// first not used slot: empty or removed
+				for(slot = hash & (CAPACITY - 1); m_Tags[slot] & Used; slot = (slot + 1) & (CAPACITY - 1));
+				m_Tags[slot] = tag(hash);
+				m_Entries[slot].Key = key;
+				m_Count++;
+			}
+			m_Entries[slot].Value = value;
+			return true;
+		}
+
+		//! @return Value pointer; NULL - not found
+		inline VALUE * Find(const UUID &key)
+		{
+			auto slot = find(key, key.Hash());
+			return slot == CAPACITY ? NULL : &m_Entries[slot].Value;
+		}
+
+		//! @return Value pointer; NULL - not found
+		inline const VALUE * Find(const UUID &key) const
+		{
+			auto slot = find(key, key.Hash());
+			return slot == CAPACITY ? NULL : &m_Entries[slot].Value;
+		}
+
+		//! @return True - removed; false - not found
+		bool Remove(const UUID &key)
+		{
+			auto slot = find(key, key.Hash());
+			if(slot == CAPACITY)
+				return false;
+			// tombstone is not needed before empty slot: probing stops there anyway
+			m_Tags[slot] = m_Tags[(slot + 1) & (CAPACITY - 1)] == Empty ? Empty : Removed;
+			m_Count--;
+			return true;
+		}
+
+		//! Entries count
+		inline unsigned int getCount() const { return m_Count; }
+
+		static constexpr unsigned int getCapacity() { return CAPACITY; }
+	};
+}
+
+#endif /* SRC_LIB_UUIDMAP_HPP_ */
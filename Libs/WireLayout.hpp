@@ -0,0 +1,222 @@
+/**
+ * Declarative fields layout of packed binary data (wire format)
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Layout is the list of fields. Field maps the member of aligned (native) struct to bytes of the wire format
+ * with bytes order conversion. Field offsets are calculated at compile time.
+ * Wire data (byte span) is alignment insensible: access to field is safe on any address.
+ * Encode & decode of whole struct are unrolled at compile time: no loops, no virtual calls.
+ */
+
+/**
+ * @page WireLayout
+ * @par Usage
+ * @code
+#include "Libs/WireLayout.hpp"
+
+struct MessageStruct // aligned native struct
+{
+	uint32_t Id;
+	uint16_t Len;
+	uint8_t Flags;
+};
+
+typedef WIRE_FIELD_BE(MessageStruct, Id) MessageIdField;
+typedef WIRE_FIELD(MessageStruct, Len) MessageLenField;
+typedef System::Wire::Layout<MessageStruct,
+	System::Wire::Bytes<4>, // magic
+	MessageIdField,
+	MessageLenField,
+	WIRE_FIELD(MessageStruct, Flags)
+> MessageLayout;
+
+uint8_t buffer[MessageLayout::Size];
+MessageStruct msg = { 1, 2, 3 };
+MessageLayout::Encode(buffer, msg); // whole struct to wire
+MessageLayout::Decode(msg, buffer); // whole struct from wire
+auto len = MessageLayout::Get<MessageLenField>(buffer); // one field
+MessageLayout::Set<MessageLenField>(buffer, 10);
+auto offset = MessageLayout::OffsetOf<MessageLenField>(); // compile time offset: 8
+ * @endcode
+ */
+
+#ifndef SRC_LIB_WIRELAYOUT_HPP_
+#define SRC_LIB_WIRELAYOUT_HPP_
+
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+#include "Libs/BytesOrder.h"
+
+namespace System
+{
+	namespace Wire
+	{
+		//! Little-endian bytes order
+		struct LE
+		{
+			template<typename T> struct Value { typedef BytesOrder::le<T> Type; };
+		};
+
+		//! Big-endian bytes order
+		struct BE
+		{
+			template<typename T> struct Value { typedef BytesOrder::be<T> Type; };
+		};
+
+		//! Value conversion to/from wire
+		//! @note Integral & enum types are converted according to bytes order, another types are copied as is
+		template<typename T, class ORDER, bool CONVERT = std::is_integral<T>::value || std::is_enum<T>::value>
+		struct Codec
+		{
+			static inline void Load(T &value, const uint8_t *span) { memcpy(&value, span, sizeof(T)); }
+			static inline void Store(uint8_t *span, const T &value) { memcpy(span, &value, sizeof(T)); }
+		};
+
+		template<typename T, class ORDER>
+		struct Codec<T, ORDER, true>
+		{
+			typedef typename ORDER::template Value<T>::Type WireType;
+			static inline void Load(T &value, const uint8_t *span) { value = ((const WireType*)span)->get(); }
+			static inline void Store(uint8_t *span, const T &value) { ((WireType*)span)->set(value); }
+		};
+
+		//! Field mapped to the member of struct
+		//! @param S		Aligned struct
+		//! @param T		Member type
+		//! @param MEMBER	Member pointer
+		//! @param ORDER	Bytes order: LE, BE
+		template<typename S, typename T, T S::*MEMBER, class ORDER = LE>
+		struct Field
+		{
+			typedef T Type;
+			static const unsigned int Size = sizeof(T);
+
+			//! Gets value from wire
+			static inline T Get(const uint8_t *span) { T value; Codec<T, ORDER>::Load(value, span); return value; }
+
+			//! Sets value to wire
+			static inline void Set(uint8_t *span, const T &value) { Codec<T, ORDER>::Store(span, value); }
+
+			static inline void Decode(S &s, const uint8_t *span) { Codec<T, ORDER>::Load(s.*MEMBER, span); }
+
+			static inline void Encode(uint8_t *span, const S &s) { Codec<T, ORDER>::Store(span, s.*MEMBER); }
+		};
+
+		//! Bytes field not mapped to the struct (magic, reserved, opaque data)
+		//! @param SIZE		Field size, bytes
+		//! @param ID		Used to distinguish fields of the same size
+		//! @note Encode & decode of struct skip this field: bytes of wire are untouched
+		template<unsigned int SIZE, unsigned int ID = 0>
+		struct Bytes
+		{
+			typedef uint8_t Type[SIZE];
+			static const unsigned int Size = SIZE;
+
+			static inline void Get(void *data, const uint8_t *span) { memcpy(data, span, SIZE); }
+
+			static inline void Set(uint8_t *span, const void *data) { memcpy(span, data, SIZE); }
+
+			template<typename S> static inline void Decode(S &, const uint8_t *) {}
+
+			template<typename S> static inline void Encode(uint8_t *, const S &) {}
+		};
+
+		namespace Detail
+		{
+			//! Offset of FIELD into list of fields
+			template<class FIELD, class... FIELDS> struct Offset;
+
+			template<class FIELD, class... FIELDS>
+			struct Offset<FIELD, FIELD, FIELDS...>
+			{
+				static const unsigned int Value = 0;
+			};
+
+			template<class FIELD, class HEAD, class... FIELDS>
+			struct Offset<FIELD, HEAD, FIELDS...>
+			{
+				static const unsigned int Value = HEAD::Size + Offset<FIELD, FIELDS...>::Value;
+			};
+
+			//! Total size of fields
+			template<class... FIELDS> struct Size;
+
+			template<> struct Size<>
+			{
+				static const unsigned int Value = 0;
+			};
+
+			template<class HEAD, class... FIELDS>
+			struct Size<HEAD, FIELDS...>
+			{
+				static const unsigned int Value = HEAD::Size + Size<FIELDS...>::Value;
+			};
+
+			//! Unrolled encode & decode of fields
+			template<class S, class... FIELDS> struct Codec;
+
+			template<class S>
+			struct Codec<S>
+			{
+				static inline void Decode(S &, const uint8_t *) {}
+				static inline void Encode(uint8_t *, const S &) {}
+			};
+
+			template<class S, class HEAD, class... FIELDS>
+			struct Codec<S, HEAD, FIELDS...>
+			{
+				static inline void Decode(S &s, const uint8_t *span)
+				{
+					HEAD::Decode(s, span);
+					Codec<S, FIELDS...>::Decode(s, span + HEAD::Size);
+				}
+				static inline void Encode(uint8_t *span, const S &s)
+				{
+					HEAD::Encode(span, s);
+					Codec<S, FIELDS...>::Encode(span + HEAD::Size, s);
+				}
+			};
+		}
+
+		//! Fields layout of wire data
+		//! @param S		Aligned struct
+		//! @param FIELDS	Fields in wire order: Field, Bytes
+		template<class S, class... FIELDS>
+		struct Layout
+		{
+			typedef S Struct;
+
+			//! Wire data size, bytes
+			static const unsigned int Size = Detail::Size<FIELDS...>::Value;
+
+			//! Returns offset of field into wire data, bytes
+			template<class FIELD>
+			static constexpr unsigned int OffsetOf() { return Detail::Offset<FIELD, FIELDS...>::Value; }
+
+			//! Gets field value from wire data
+			template<class FIELD>
+			static inline typename FIELD::Type Get(const void *span) { return FIELD::Get((const uint8_t*)span + OffsetOf<FIELD>()); }
+
+			//! Sets field value to wire data
+			template<class FIELD>
+			static inline void Set(void *span, const typename FIELD::Type &value) { FIELD::Set((uint8_t*)span + OffsetOf<FIELD>(), value); }
+
+			//! Converts wire data to struct
+			static inline void Decode(S &s, const void *span) { Detail::Codec<S, FIELDS...>::Decode(s, (const uint8_t*)span); }
+
+			//! Converts struct to wire data
+			static inline void Encode(void *span, const S &s) { Detail::Codec<S, FIELDS...>::Encode((uint8_t*)span, s); }
+		};
+	}
+}
+
+//! Little-endian field of the struct member
+#define WIRE_FIELD(s, member) System::Wire::Field<s, decltype(s::member), &s::member, System::Wire::LE>
+
+//! Big-endian field of the struct member
+#define WIRE_FIELD_BE(s, member) System::Wire::Field<s, decltype(s::member), &s::member, System::Wire::BE>
+
+#endif /* SRC_LIB_WIRELAYOUT_HPP_ */
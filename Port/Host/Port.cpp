@@ -0,0 +1,44 @@
+/**
+ * Host (Linux) port: peripherals memory & system time
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include "Port/Port.h"
+#include "stm32l0xx.h"
+#include <sys/mman.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef MAP_FIXED_NOREPLACE
+#	define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+extern "C"
+{
+	//! System time, mS. Host application can define own
+	__attribute__((weak)) volatile uint32_t SystemTime;
+}
+
+namespace Port
+{
+	//! Maps memory region of peripherals at device address: abort on failure
+	static void map(unsigned long address, unsigned long size)
+	{
+		auto p = mmap((void*)address, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+		if(p != (void*)address)
+		{
+			fprintf(stderr, "Port: can't map peripherals memory at 0x%08lX\n", address);
+			abort();
+		}
+	}
+
+	//! Maps memory of peripherals at device addresses before any static constructor
+	__attribute__((constructor(101))) static void mapPeripherals()
+	{
+		map(IOPPERIPH_BASE, IOPPERIPH_SIZE);
+		map(APBPERIPH_BASE, APBPERIPH_SIZE);
+		map(AHBPERIPH_BASE, AHBPERIPH_SIZE);
+	}
+}
@@ -0,0 +1,175 @@
+/**
+ * Host (Linux) mock of device header: peripherals used by libraries
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Peripherals are the plain memory at the device addresses: host port maps it at start (Port/Host/Port.cpp).
+ * So register access code (pin.h, Probe, SoftPwm) works on host as is; tests & simulation read registers back.
+ */
+
+#ifndef SRC_PORT_HOST_STM32L0XX_H_
+#define SRC_PORT_HOST_STM32L0XX_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct
+{
+	volatile uint32_t MODER;
+	volatile uint32_t OTYPER;
+	volatile uint32_t OSPEEDR;
+	volatile uint32_t PUPDR;
+	volatile uint32_t IDR;
+	volatile uint32_t ODR;
+	volatile uint32_t BSRR;
+	volatile uint32_t LCKR;
+	volatile uint32_t AFR[2];
+	volatile uint32_t BRR;
+} GPIO_TypeDef;
+
+#define IOPPERIPH_BASE		0x50000000UL
+#define GPIOA_BASE			(IOPPERIPH_BASE + 0x00000000UL)
+#define GPIOB_BASE			(IOPPERIPH_BASE + 0x00000400UL)
+#define GPIOC_BASE			(IOPPERIPH_BASE + 0x00000800UL)
+#define GPIOD_BASE			(IOPPERIPH_BASE + 0x00000C00UL)
+#define GPIOE_BASE			(IOPPERIPH_BASE + 0x00001000UL)
+#define GPIOH_BASE			(IOPPERIPH_BASE + 0x00001C00UL)
+#define IOPPERIPH_SIZE		0x00002000UL
+
+#define GPIOA				((GPIO_TypeDef *)GPIOA_BASE)
+#define GPIOB				((GPIO_TypeDef *)GPIOB_BASE)
+#define GPIOC				((GPIO_TypeDef *)GPIOC_BASE)
+#define GPIOD				((GPIO_TypeDef *)GPIOD_BASE)
+#define GPIOE				((GPIO_TypeDef *)GPIOE_BASE)
+#define GPIOH				((GPIO_TypeDef *)GPIOH_BASE)
+
+typedef struct
+{
+	volatile uint32_t ISR;
+	volatile uint32_t ICR;
+	volatile uint32_t IER;
+	volatile uint32_t CFGR;
+	volatile uint32_t CR;
+	volatile uint32_t CMP;
+	volatile uint32_t ARR;
+	volatile uint32_t CNT;
+} LPTIM_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t CR1;
+	volatile uint32_t CR2;
+	volatile uint32_t SMCR;
+	volatile uint32_t DIER;
+	volatile uint32_t SR;
+	volatile uint32_t EGR;
+	volatile uint32_t CCMR1;
+	volatile uint32_t CCMR2;
+	volatile uint32_t CCER;
+	volatile uint32_t CNT;
+	volatile uint32_t PSC;
+	volatile uint32_t ARR;
+} TIM_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t ISR;
+	volatile uint32_t IER;
+	volatile uint32_t CR;
+	volatile uint32_t CFGR1;
+	volatile uint32_t CFGR2;
+	volatile uint32_t SMPR;
+	uint32_t RESERVED1[2];
+	volatile uint32_t TR;
+	uint32_t RESERVED2;
+	volatile uint32_t CHSELR;
+	uint32_t RESERVED3[5];
+	volatile uint32_t DR;
+} ADC_TypeDef;
+
+//! Host: address registers are pointer size
+typedef struct
+{
+	volatile uint32_t CCR;
+	volatile uint32_t CNDTR;
+	volatile uintptr_t CPAR;
+	volatile uintptr_t CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+	volatile uint32_t ISR;
+	volatile uint32_t IFCR;
+} DMA_TypeDef;
+
+#define APBPERIPH_BASE		0x40000000UL
+#define TIM6_BASE			(APBPERIPH_BASE + 0x00001000UL)
+#define LPTIM1_BASE			(APBPERIPH_BASE + 0x00007C00UL)
+#define ADC1_BASE			(APBPERIPH_BASE + 0x00012400UL)
+#define APBPERIPH_SIZE		0x00018000UL
+#define AHBPERIPH_BASE		0x40020000UL
+#define DMA1_BASE			(AHBPERIPH_BASE + 0x00000000UL)
+#define DMA1_Channel1_BASE	(AHBPERIPH_BASE + 0x00000008UL)
+#define AHBPERIPH_SIZE		0x00001000UL
+
+#define TIM6				((TIM_TypeDef *)TIM6_BASE)
+#define LPTIM1				((LPTIM_TypeDef *)LPTIM1_BASE)
+#define ADC1				((ADC_TypeDef *)ADC1_BASE)
+#define DMA1				((DMA_TypeDef *)DMA1_BASE)
+#define DMA1_Channel1		((DMA_Channel_TypeDef *)DMA1_Channel1_BASE)
+
+#define LPTIM_ISR_CMPM		0x00000001UL
+#define LPTIM_ISR_ARRM		0x00000002UL
+#define LPTIM_ISR_CMPOK		0x00000008UL
+#define LPTIM_ISR_ARROK		0x00000010UL
+#define LPTIM_ICR_CMPMCF	0x00000001UL
+#define LPTIM_ICR_ARRMCF	0x00000002UL
+#define LPTIM_ICR_CMPOKCF	0x00000008UL
+#define LPTIM_ICR_ARROKCF	0x00000010UL
+#define LPTIM_IER_CMPMIE	0x00000001UL
+#define LPTIM_IER_ARRMIE	0x00000002UL
+#define LPTIM_CFGR_PRESC_Pos	9U
+#define LPTIM_CFGR_PRESC	0x00000E00UL
+#define LPTIM_CR_ENABLE		0x00000001UL
+#define LPTIM_CR_CNTSTRT	0x00000004UL
+
+#define TIM_CR1_CEN			0x00000001UL
+#define TIM_CR2_MMS_1		0x00000020UL
+#define TIM_EGR_UG			0x00000001UL
+
+#define ADC_ISR_ADRDY		0x00000001UL
+#define ADC_ISR_OVR			0x00000010UL
+#define ADC_CR_ADEN			0x00000001UL
+#define ADC_CR_ADDIS		0x00000002UL
+#define ADC_CR_ADSTART		0x00000004UL
+#define ADC_CR_ADSTP		0x00000010UL
+#define ADC_CFGR1_DMAEN		0x00000001UL
+#define ADC_CFGR1_DMACFG	0x00000002UL
+#define ADC_CFGR1_EXTSEL_Pos	6U
+#define ADC_CFGR1_EXTEN_0	0x00000400UL
+#define ADC_SMPR_SMP_Pos	0U
+
+#define DMA_ISR_GIF1		0x00000001UL
+#define DMA_ISR_TCIF1		0x00000002UL
+#define DMA_ISR_HTIF1		0x00000004UL
+#define DMA_ISR_TEIF1		0x00000008UL
+#define DMA_IFCR_CGIF1		0x00000001UL
+#define DMA_CCR_EN			0x00000001UL
+#define DMA_CCR_TCIE		0x00000002UL
+#define DMA_CCR_HTIE		0x00000004UL
+#define DMA_CCR_TEIE		0x00000008UL
+#define DMA_CCR_CIRC		0x00000020UL
+#define DMA_CCR_MINC		0x00000080UL
+#define DMA_CCR_PSIZE_0		0x00000100UL
+#define DMA_CCR_MSIZE_0		0x00000400UL
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SRC_PORT_HOST_STM32L0XX_H_ */
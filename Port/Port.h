@@ -0,0 +1,179 @@
+/**
+ * Port layer: target (Cortex-M, GNU Arm toolchain) or host (Linux, GCC/Clang)
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Linker tables (timers, services e.t.c.) are the sections collected by linker script on target:
+ * @c .timers section & @c _Timers_Table_Begin/End symbols provided by script.
+ * Host has no linker script: section name must be C identifier (no dot), linker provides
+ * @c __start_<section> & @c __stop_<section> symbols. So modules map own table symbols to them on host.
+ * Table entry has natural alignment: compiler can't over-align big entries (x86), so entries are the array.
+ * Entries order into one object file must be the same for paired tables (entries & states):
+ * host build uses @c -fno-toplevel-reorder for code that declares entries (see CMakeLists.txt).
+ * Prioritized entry goes into @c <section>.<priority> subsection: linker script sorts subsections by name.
+ * Host build adds Port/Host/Tables.ld (sorting of prioritized tables) to default linker script.
+ * Tables are accessed by System::LinkerTable (see Libs/LinkerTable.hpp).
+ * Hot code placement: functions of @c PORT_RAMFUNC, @c PORT_ITCM, @c PORT_CCM go into code sections of RAM
+ * (no FLASH wait states & prefetch misses); @c Port::CopyCode() copies them from FLASH at startup.
+ * Framework hot paths (Timer::Tick, Services::ProcessStates, USB control endpoint path) are marked by @c PORT_HOT:
+ * FLASH by default, memory of @c PORT_HOT_SECTION if defined. Calls between FLASH & RAM code are out of BL range:
+ * linker inserts long branch veneers. Host: placement macros are empty.
+ */
+
+/**
+ * @page Port
+ * @par Config
+ * @code
+#define PORT_HOST // host build; defined automatically for Linux
+#define PORT_HOT_SECTION ramfunc // hot paths of framework in RAM: ramfunc, itcm, ccmram
+ * @endcode
+ * Linker script: code sections of RAM, loaded to FLASH (each one is optional)
+ * @code
+SECTIONS
+{
+	.ramfunc :
+	{
+		. = ALIGN(4);
+		_Port_Ramfunc_Begin = .;
+		*(.ramfunc .ramfunc.*)
+		. = ALIGN(4);
+		_Port_Ramfunc_End = .;
+	} >RAM AT>FLASH
+	_Port_Ramfunc_Load = LOADADDR(.ramfunc);
+	.itcm : { ... } >ITCMRAM AT>FLASH // the same: _Port_Itcm_Begin/End/Load
+	.ccmram : { ... } >CCMRAM AT>FLASH // the same: _Port_Ccm_Begin/End/Load
+}
+ * @endcode
+ * @par Usage
+ * Hot code:
+ * @code
+PORT_RAMFUNC void EXTI4_15_IRQHandler() { ... } // ISR from RAM
+PORT_ITCM static void filter(int16_t *samples, unsigned int count); // Cortex-M7 ITCM
+
+int main()
+{
+	Port::CopyCode(); // before any call of RAM code
+	...
+}
+ * @endcode
+ * Module .h file:
+ * @code
+#include "Port/Port.h"
+
+#define EXAMPLE_DECLARE(name) static const ExampleStruct _Example_##name PORT_TABLE_ENTRY(examples, ExampleStruct) = { ... };
+
+extern "C"
+{
+#ifdef PORT_HOST
+#	define _Examples_Table_Begin PORT_SECTION_BEGIN(examples)
+#	define _Examples_Table_End PORT_SECTION_END(examples)
+#endif
+	extern unsigned char _Examples_Table_Begin[] PORT_LINKER_SYMBOL;
+	extern unsigned char _Examples_Table_End[] PORT_LINKER_SYMBOL;
+}
+ * @endcode
+ */
+
+#ifndef SRC_PORT_PORT_H_
+#define SRC_PORT_PORT_H_
+
+#if !defined(PORT_HOST) && defined(__linux__)
+#	define PORT_HOST
+#endif
+
+#ifdef PORT_HOST
+	//! Section name: C identifier
+#	define PORT_SECTION_NAME(name) #name
+	//! First byte of section (linker symbol)
+#	define PORT_SECTION_BEGIN(name) __start_##name
+	//! First byte after section (linker symbol)
+#	define PORT_SECTION_END(name) __stop_##name
+	//! Linker symbol declaration attribute: section without entries has no symbols, so table is empty
+#	define PORT_LINKER_SYMBOL __attribute__((weak))
+#else
+	//! Section name: dot & name
+#	define PORT_SECTION_NAME(name) "." #name
+	//! Linker symbol declaration attribute: symbols are provided by linker script
+#	define PORT_LINKER_SYMBOL
+#endif
+
+//! Entry of linker table
+//! @param name		Section name: C identifier
+//! @param type		Entry type
+#define PORT_TABLE_ENTRY(name, type) __attribute__((section(PORT_SECTION_NAME(name)), used, aligned(alignof(type))))
+
+//! Entry of linker table with priority
+//! @param name		Section name: C identifier
+//! @param type		Entry type
+//! @param priority	Priority: two digits 00..99; 00 - first entry of table
+#define PORT_TABLE_ENTRY_PRIORITY(name, type, priority) __attribute__((section(PORT_SECTION_NAME(name) "." #priority), used, aligned(alignof(type))))
+
+#define _PORT_CODE_SECTION(name) __attribute__((section(PORT_SECTION_NAME(name)), noinline))
+#ifdef PORT_HOST
+	//! Function of code section: host has no code placement
+#	define PORT_CODE_SECTION(name)
+#else
+	//! Function of code section (RAM): section name is macro expanded
+#	define PORT_CODE_SECTION(name) _PORT_CODE_SECTION(name)
+#endif
+
+//! Function in RAM: copied from FLASH at startup
+#define PORT_RAMFUNC PORT_CODE_SECTION(ramfunc)
+
+//! Function in ITCM RAM (Cortex-M7): copied from FLASH at startup
+#define PORT_ITCM PORT_CODE_SECTION(itcm)
+
+//! Function in CCM RAM (STM32F3/F4/G4): copied from FLASH at startup
+#define PORT_CCM PORT_CODE_SECTION(ccmram)
+
+#ifdef PORT_HOT_SECTION
+	//! Hot path of framework: code section of PORT_HOT_SECTION
+#	define PORT_HOT PORT_CODE_SECTION(PORT_HOT_SECTION)
+#else
+	//! Hot path of framework: FLASH
+#	define PORT_HOT
+#endif
+
+#ifndef PORT_HOST
+#include <stdint.h>
+
+extern "C"
+{
+	extern uint32_t _Port_Ramfunc_Begin[] __attribute__((weak)); //!< RAM address, first word of code
+	extern uint32_t _Port_Ramfunc_End[] __attribute__((weak)); //!< RAM address, first word after code
+	extern const uint32_t _Port_Ramfunc_Load[] __attribute__((weak)); //!< FLASH address of code
+	extern uint32_t _Port_Itcm_Begin[] __attribute__((weak));
+	extern uint32_t _Port_Itcm_End[] __attribute__((weak));
+	extern const uint32_t _Port_Itcm_Load[] __attribute__((weak));
+	extern uint32_t _Port_Ccm_Begin[] __attribute__((weak));
+	extern uint32_t _Port_Ccm_End[] __attribute__((weak));
+	extern const uint32_t _Port_Ccm_Load[] __attribute__((weak));
+}
+
+namespace Port
+{
+	//! Copies code section by words: section not defined by linker script (NULL symbols) is skipped
+	inline void copyCode(uint32_t *begin, uint32_t *end, const uint32_t *load)
+	{
+		for(auto p = begin; p != end;)
+			*p++ = *load++;
+	}
+
+	//! Copies code sections of RAM from FLASH: sections not defined by linker script are skipped
+	inline void CopyCode()
+	{
+		copyCode(_Port_Ramfunc_Begin, _Port_Ramfunc_End, _Port_Ramfunc_Load);
+		copyCode(_Port_Itcm_Begin, _Port_Itcm_End, _Port_Itcm_Load);
+		copyCode(_Port_Ccm_Begin, _Port_Ccm_End, _Port_Ccm_Load);
+		__asm volatile ("dsb\n isb" ::: "memory"); // code is written by data bus
+	}
+}
+#else
+namespace Port
+{
+	inline void CopyCode() {}
+}
+#endif
+
+#endif /* SRC_PORT_PORT_H_ */
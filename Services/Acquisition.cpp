@@ -0,0 +1,157 @@
+/**
+ * Acquisition service: timer-triggered ADC scan into DMA ring, blocks of samples for consumer services
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include "Services/Acquisition.h"
+#include "Libs/Trace.hpp"
+#include "stm32l0xx.h"
+
+namespace Services
+{
+	namespace Acquisition
+	{
+		static uint16_t Ring[2 * Frames * Channels] __attribute__((aligned(4)));	//!< DMA ring: two blocks
+		static volatile uint32_t Produced;	//!< Blocks completed by DMA
+		static uint32_t Published;			//!< Blocks count at the last publish
+		static uint32_t Overruns;
+		static BlockStruct Current;
+
+		//! TIM6 update (TRGO) of frame rate: prescaler keeps ARR 16-bit
+		static void startTimer()
+		{
+			const uint32_t ticks = ACQUISITION_TIMER_CLOCK / Rate;
+			const uint32_t prescaler = ticks / 0x10000;
+			TIM6->CR1 = 0;
+			TIM6->PSC = prescaler;
+			TIM6->ARR = ticks / (prescaler + 1) - 1;
+			TIM6->CR2 = TIM_CR2_MMS_1;
+			TIM6->EGR = TIM_EGR_UG; // load prescaler
+			TIM6->CR1 = TIM_CR1_CEN;
+		}
+
+		static void start()
+		{
+			Produced = Published = Overruns = 0;
+			Current = { Ring, Frames, Channels, 0 };
+			// DMA: circular ring of ADC data register, interrupt per half
+			DMA1_Channel1->CCR = 0;
+			DMA1->IFCR = DMA_IFCR_CGIF1;
+			DMA1_Channel1->CPAR = (uintptr_t)&ADC1->DR;
+			DMA1_Channel1->CMAR = (uintptr_t)Ring;
+			DMA1_Channel1->CNDTR = 2 * Frames * Channels;
+			DMA1_Channel1->CCR = DMA_CCR_MINC | DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0 | DMA_CCR_CIRC | DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_EN;
+			// ADC: scan of channels by rising edge of TRG0 (TIM6_TRGO), DMA circular mode
+			ADC1->CFGR1 = ADC_CFGR1_DMAEN | ADC_CFGR1_DMACFG | ADC_CFGR1_EXTEN_0 | (0 << ADC_CFGR1_EXTSEL_Pos);
+			ADC1->SMPR = ACQUISITION_SAMPLING << ADC_SMPR_SMP_Pos;
+			ADC1->CHSELR = ACQUISITION_CHANNELS_SELECT;
+			ADC1->ISR = ADC_ISR_ADRDY;
+			ADC1->CR = ADC_CR_ADEN;
+#ifndef PORT_HOST
+			while(!(ADC1->ISR & ADC_ISR_ADRDY)) {}
+#endif
+			ADC1->CR = ADC_CR_ADEN | ADC_CR_ADSTART; // conversions wait for trigger
+			startTimer();
+		}
+
+		static void stop()
+		{
+			TIM6->CR1 = 0;
+			if(ADC1->CR & ADC_CR_ADSTART)
+			{
+				ADC1->CR |= ADC_CR_ADSTP;
+#ifndef PORT_HOST
+				while(ADC1->CR & ADC_CR_ADSTP) {}
+#else
+				ADC1->CR &= ~(ADC_CR_ADSTART | ADC_CR_ADSTP);
+#endif
+			}
+			ADC1->CR |= ADC_CR_ADDIS;
+#ifdef PORT_HOST
+			ADC1->CR = 0;
+#endif
+			DMA1_Channel1->CCR = 0;
+			DMA1->IFCR = DMA_IFCR_CGIF1;
+		}
+
+		static bool Enable(const char *name, bool enable)
+		{
+			if(name != ServiceName)
+				return true; // another service
+			if(enable)
+				start();
+			else
+				stop();
+			return true;
+		}
+
+		//! Clears pulse of the block: processed by all the consumers
+		static void StateChangedBy(const char *name __attribute__((unused)), StateType &stateBits, StateType changedStateMask)
+		{
+			if(changedStateMask & (StateType)StateEnum::Block)
+				stateBits &= ~(StateType)StateEnum::Block;
+		}
+
+		//! Publishes the last completed block
+		PORT_HOT static void LocalStateChanged(const char *name, StateType &stateBits)
+		{
+			stateBits = 0;
+			auto produced = Produced;
+			if(produced == Published)
+				return;
+			if(produced - Published > 1)
+				Overruns += produced - Published - 1; // older blocks are overwritten already
+			Published = produced;
+			Current.Samples = Ring + ((produced - 1) & 1) * Frames * Channels;
+			Current.Sequence = produced - 1;
+			Services::SetState(name, (StateType)StateEnum::Block);
+		}
+
+		SERVICE_DECLARE(Acquisition, &Enable, NULL, &StateChangedBy, &LocalStateChanged)
+
+		const BlockStruct &Block()
+		{
+			return Current;
+		}
+
+		bool isValid(const BlockStruct &block)
+		{
+			return Produced - block.Sequence <= 1;
+		}
+
+		uint32_t getBlocks()
+		{
+			return Produced;
+		}
+
+		uint32_t getOverruns()
+		{
+			return Overruns;
+		}
+	}
+}
+
+extern "C"
+{
+	PORT_HOT void DMA1_Channel1_IRQHandler()
+	{
+		using namespace Services::Acquisition;
+		auto isr = DMA1->ISR;
+		DMA1->IFCR = isr & (DMA_ISR_GIF1 | DMA_ISR_TCIF1 | DMA_ISR_HTIF1 | DMA_ISR_TEIF1);
+		// half before full: both are pending when the interrupt was late for a block period
+		if(isr & DMA_ISR_HTIF1)
+		{
+			TRACE_EVENT(Trace::AcquisitionBlock, Produced, 0);
+			Produced = Produced + 1;
+			Services::SetLocalState(ServiceName, (Services::StateType)StateLocalEnum::Half);
+		}
+		if(isr & DMA_ISR_TCIF1)
+		{
+			TRACE_EVENT(Trace::AcquisitionBlock, Produced, 1);
+			Produced = Produced + 1;
+			Services::SetLocalState(ServiceName, (Services::StateType)StateLocalEnum::Full);
+		}
+	}
+}
@@ -0,0 +1,131 @@
+/**
+ * Acquisition service: timer-triggered ADC scan into DMA ring, blocks of samples for consumer services
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Sampling by timer callbacks (Services/Timer.h) takes one callback per sample & the jitter of the message loop.
+ * Here TIM6 update (TRGO) triggers ADC scan of @c ACQUISITION_CHANNELS channels at @c ACQUISITION_RATE frames per second,
+ * DMA1 channel 1 writes the frames into the circular ring of two blocks: no CPU per sample.
+ * Half & full transfer interrupts set local state of the service (one interrupt per block), the message loop publishes
+ * the completed block by pulse state @c StateEnum::Block: consumer services process it in @c StateChanged
+ * (@c Block, kernels of Libs/Dsp.hpp). Deadline of consumers is one block period: DMA writes the other half meanwhile.
+ * Blocks missed by the message loop are counted (@c getOverruns), @c isValid checks the block after processing.
+ * ADC calibration & clocks (RCC, ADC clock) are of application: the service is enabled after them.
+ * Host: registers are the memory of the port (Port/Host/stm32l0xx.h); simulation fills the ring (Simulation/Adc.hpp).
+ */
+
+/**
+ * @page Acquisition
+ * @par Config
+ * @code
+#define ACQUISITION_CHANNELS 4				// channels of scan: 1..
+#define ACQUISITION_CHANNELS_SELECT 0x000F	// ADC inputs of scan (CHSELR): ascending order of inputs is the order of channels
+#define ACQUISITION_FRAMES 250				// frames of block: half of DMA ring
+#define ACQUISITION_RATE 25000				// frames per second: trigger rate
+#define ACQUISITION_TIMER_CLOCK 32000000	// TIM6 clock, Hz
+#define ACQUISITION_SAMPLING 1				// ADC sampling time code (SMPR)
+ * @endcode
+ * @par Usage
+ * @code
+#include "Services/Acquisition.h"
+#include "Libs/Dsp.hpp"
+
+namespace Services
+{
+	namespace Meter
+	{
+		static uint16_t Decimated[ACQUISITION_FRAMES / 25 * ACQUISITION_CHANNELS];
+
+		static void StateChanged(const char *name, StateType stateBits, StateType changedStateMask)
+		{
+			if(name == Acquisition::ServiceName && (changedStateMask & stateBits & (StateType)Acquisition::StateEnum::Block))
+			{
+				auto &block = Acquisition::Block();
+				Dsp::Decimate(block.Samples, block.Frames, block.Channels, 25, Decimated); // 1 kHz of 25 kHz
+			}
+		}
+		SERVICE_DECLARE(Meter, NULL, &StateChanged, NULL, NULL)
+	}
+}
+
+int main()
+{
+	... // clocks of TIM6, ADC & DMA1, ADC calibration; NVIC: DMA1_Channel1_IRQn
+	Services::Init();
+	Services::Enable(NULL); // Acquisition starts TIM6, ADC & DMA
+	for(;;)
+		Services::ProcessStates();
+}
+ * @endcode
+ */
+
+#ifndef SRC_ACQUISITION_H_
+#define SRC_ACQUISITION_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Services/IService.h"
+
+#ifndef ACQUISITION_CHANNELS
+#	define ACQUISITION_CHANNELS 4
+#	define ACQUISITION_CHANNELS_SELECT 0x000F
+#endif
+#ifndef ACQUISITION_FRAMES
+#	define ACQUISITION_FRAMES 250
+#endif
+#ifndef ACQUISITION_RATE
+#	define ACQUISITION_RATE 25000
+#endif
+#ifndef ACQUISITION_TIMER_CLOCK
+#	define ACQUISITION_TIMER_CLOCK 32000000
+#endif
+#ifndef ACQUISITION_SAMPLING
+#	define ACQUISITION_SAMPLING 1
+#endif
+
+extern "C"
+{
+	//! DMA1 channel 1 interrupt: half & full transfer of the ring
+	void DMA1_Channel1_IRQHandler();
+}
+
+namespace Services
+{
+	namespace Acquisition
+	{
+		enum class StateEnum { Block = 1 };				//!< Pulse: block of samples is ready, @c Block()
+		enum class StateLocalEnum { Half = 1, Full = 2 };	//!< DMA transfer of the first/second half of the ring is completed
+		extern const char *ServiceName;
+		SERVICE_DEPENDS(Acquisition)
+
+		static const uint32_t Channels = ACQUISITION_CHANNELS;	//!< Channels of frame
+		static const uint32_t Frames = ACQUISITION_FRAMES;		//!< Frames of block
+		static const uint32_t Rate = ACQUISITION_RATE;			//!< Frames per second
+
+		static_assert(Channels * Frames * 2 <= 0xFFFF, "Acquisition: DMA ring exceeds 65535 transfers");
+
+		//! Block of samples
+		struct BlockStruct
+		{
+			const uint16_t *Samples;	//!< Interleaved frames: Frames * Channels samples
+			uint32_t Frames;			//!< Frames count
+			uint32_t Channels;			//!< Samples of frame
+			uint32_t Sequence;			//!< Block number since enable: 0..
+		};
+
+		//! The last completed block: valid in @c StateChanged of @c StateEnum::Block & for one block period
+		const BlockStruct &Block();
+
+		//! Checks the block is not overwritten by DMA yet: call after processing
+		bool isValid(const BlockStruct &block);
+
+		//! Blocks completed by DMA since enable
+		uint32_t getBlocks();
+
+		//! Blocks not published: the message loop was late for more than one block period
+		uint32_t getOverruns();
+	}
+}
+
+#endif /* SRC_ACQUISITION_H_ */
@@ -0,0 +1,234 @@
+/**
+ * Cyclic executive: time-triggered schedule of hard-periodic tasks computed at compile time
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Timers of Services/Timer.h are scanned by the message loop: callback starts when the loop gets to it, so
+ * control loops get jitter of everything else the loop runs. Tasks of cyclic executive are dispatched by one hardware
+ * timer interrupt of minor frame period. Minor frame is GCD of task periods, major frame (schedule cycle) is LCM;
+ * each task gets the release offset (frames) of the minimal peak frame load, so the frame table (tasks mask of each
+ * minor frame) is computed at compile time from periods & worst-case execution times. Dispatch is the table lookup:
+ * no per-tick search. Tasks of the frame run in order of declaration: declare shortest period first (rate monotonic).
+ * Schedulability is @c static_assert: load of each frame (sum of WCETs) fits the minor frame.
+ * Overrun: frame took longer than the minor frame (measured by Libs/Profile.hpp cycles).
+ */
+
+/**
+ * @page Cyclic
+ * @par Config
+ * @code
+#define CYCLIC_MAX_FRAMES 1000	// frames of major frame limit: FLASH of frame table is 4 bytes per frame
+ * @endcode
+ * @par Usage
+ * @code
+#include "Services/Cyclic.h"
+
+CYCLIC_TASK(Current, 1000, 150)		// period 1 mS, WCET 150 uS
+{
+}
+CYCLIC_TASK(Speed, 5000, 300)
+{
+}
+CYCLIC_TASK(Position, 20000, 400)
+{
+}
+typedef Cyclic::ScheduleClass<Current, Speed, Position> Schedule; // compile error: not schedulable
+
+void TIM21_IRQHandler() // hardware timer of Schedule::Minor uS period
+{
+	TIM21->SR = 0;
+	Schedule::Dispatch();
+}
+
+int main()
+{
+	Schedule::Init();
+	... // start TIM21: update interrupt every Schedule::Minor uS
+}
+ * @endcode
+ */
+
+#ifndef SRC_CYCLIC_H_
+#define SRC_CYCLIC_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Port/Port.h"
+#include "Libs/Profile.hpp"
+#include "Libs/Trace.hpp"
+#include "Libs/Sequence.hpp"
+
+#ifndef CYCLIC_MAX_FRAMES
+#	define CYCLIC_MAX_FRAMES 1000
+#endif
+
+//! Declares task of cyclic executive: body follows
+//! @param name		Task type name: C identifier
+//! @param period	Period, uS
+//! @param wcet		Worst-case execution time, uS
+#define CYCLIC_TASK(name, period, wcet)\
+	struct name\
+	{\
+		static constexpr uint32_t Period = period;\
+		static constexpr uint32_t Wcet = wcet;\
+		static void Run();\
+	};\
+	void name::Run()
+
+namespace CyclicDetail
+{
+	constexpr uint32_t gcd(uint32_t a, uint32_t b) { return b == 0 ? a : gcd(b, a % b); }
+	constexpr uint32_t lcm(uint32_t a, uint32_t b) { return a / gcd(a, b) * b; }
+
+	//! Periods & WCETs of tasks
+	template<typename... Tasks> struct TasksTable
+	{
+		static constexpr uint32_t Count = sizeof...(Tasks);
+		static constexpr uint32_t Periods[Count] = { Tasks::Period... };
+		static constexpr uint32_t Wcets[Count] = { Tasks::Wcet... };
+
+		static constexpr uint32_t gcdOf(uint32_t i) { return i + 1 == Count ? Periods[i] : gcd(Periods[i], gcdOf(i + 1)); }
+		static constexpr uint32_t lcmOf(uint32_t i) { return i + 1 == Count ? Periods[i] : lcm(Periods[i], lcmOf(i + 1)); }
+
+		static constexpr uint32_t Minor = gcdOf(0);				//!< Minor frame, uS
+		static constexpr uint32_t Major = lcmOf(0);				//!< Major frame, uS
+		static constexpr uint32_t Frames = Major / Minor;		//!< Minor frames of major frame
+
+		//! Task period, frames
+		static constexpr uint32_t period(uint32_t i) { return Periods[i] / Minor; }
+	};
+	template<typename... Tasks> constexpr uint32_t TasksTable<Tasks...>::Periods[];
+	template<typename... Tasks> constexpr uint32_t TasksTable<Tasks...>::Wcets[];
+
+	//! Placement of the first I tasks: each task gets offset of the minimal peak load of its frames
+	//! @note Offsets are static members: computed once for each task
+	template<typename Table, uint32_t I> struct Placement
+	{
+		typedef Placement<Table, I - 1> Previous;
+		static constexpr uint32_t Task = I - 1;
+
+		//! Peak load of previous tasks in frames of task released at offset: releases first..last
+		static constexpr uint32_t peak(uint32_t offset, uint32_t first, uint32_t last)
+		{
+			return first == last ? Previous::load(offset + first * Table::period(Task))
+				: System::Max(peak(offset, first, (first + last) / 2), peak(offset, (first + last) / 2 + 1, last));
+		}
+		static constexpr uint32_t cost(uint32_t offset) { return peak(offset, 0, Table::Frames / Table::period(Task) - 1); }
+		static constexpr uint32_t better(uint32_t a, uint32_t b) { return cost(b) < cost(a) ? b : a; }
+		//! Offset of minimal cost: offsets first..last, the first of equal
+		static constexpr uint32_t best(uint32_t first, uint32_t last)
+		{
+			return first == last ? first : better(best(first, (first + last) / 2), best((first + last) / 2 + 1, last));
+		}
+
+		static constexpr uint32_t Offset = best(0, Table::period(Task) - 1);	//!< Release offset of task, frames
+
+		static constexpr bool released(uint32_t frame) { return frame % Table::period(Task) == Offset; }
+		//! Sum of WCETs of the first I tasks released in frame, uS
+		static constexpr uint32_t load(uint32_t frame) { return Previous::load(frame) + (released(frame) ? Table::Wcets[Task] : 0); }
+		//! Tasks mask of frame
+		static constexpr uint32_t mask(uint32_t frame) { return Previous::mask(frame) | (released(frame) ? 1u << Task : 0); }
+	};
+	template<typename Table> struct Placement<Table, 0>
+	{
+		static constexpr uint32_t load(uint32_t) { return 0; }
+		static constexpr uint32_t mask(uint32_t) { return 0; }
+	};
+}
+
+namespace Cyclic
+{
+	typedef void (*TaskCallback)();
+
+	//! Cyclic executive of tasks declared by @c CYCLIC_TASK
+	//! @note Not schedulable tasks set is compile error
+	template<typename... Tasks> class ScheduleClass
+	{
+		typedef CyclicDetail::TasksTable<Tasks...> Table;
+		typedef CyclicDetail::Placement<Table, sizeof...(Tasks)> TasksPlacement;
+
+		static_assert(sizeof...(Tasks) >= 1 && sizeof...(Tasks) <= 32, "Cyclic executive: tasks count must be 1..32");
+		static_assert(Table::Frames <= CYCLIC_MAX_FRAMES, "Cyclic executive: major frame has more than CYCLIC_MAX_FRAMES minor frames");
+
+		//! Peak load of frames first..last, uS
+		static constexpr uint32_t peak(uint32_t first, uint32_t last)
+		{
+			return first == last ? TasksPlacement::load(first) : System::Max(peak(first, (first + last) / 2), peak((first + last) / 2 + 1, last));
+		}
+
+		template<typename Sequence> struct FramesTable;
+		template<uint32_t... F> struct FramesTable<System::Sequence<F...>>
+		{
+			static constexpr uint32_t Masks[sizeof...(F)] = { TasksPlacement::mask(F)... };
+		};
+		template<typename Sequence> struct OffsetsTable;
+		template<uint32_t... I> struct OffsetsTable<System::Sequence<I...>>
+		{
+			static constexpr uint32_t Offsets[sizeof...(I)] = { CyclicDetail::Placement<Table, I + 1>::Offset... };
+		};
+		typedef FramesTable<typename System::MakeSequence<Table::Frames <= CYCLIC_MAX_FRAMES ? Table::Frames : 1>::Type> Frames;
+		typedef OffsetsTable<typename System::MakeSequence<sizeof...(Tasks)>::Type> Offsets;
+
+		static constexpr TaskCallback Callbacks[sizeof...(Tasks)] = { &Tasks::Run... };
+
+		static uint32_t m_Frame;		//!< Frame of the next dispatch
+		static uint32_t m_Overruns;
+		static uint32_t m_MinorCycles;	//!< Minor frame, Profile cycles
+
+	public:
+		static constexpr uint32_t Count = sizeof...(Tasks);		//!< Tasks count
+		static constexpr uint32_t Minor = Table::Minor;			//!< Minor frame: period of dispatch interrupt, uS
+		static constexpr uint32_t Major = Table::Major;			//!< Major frame: schedule cycle, uS
+		static constexpr uint32_t FramesCount = Table::Frames;	//!< Minor frames of major frame
+		static constexpr uint32_t PeakLoad = peak(0, FramesCount - 1);	//!< Maximal sum of WCETs of frame, uS
+
+		static_assert(PeakLoad <= Minor, "Cyclic executive: not schedulable, sum of WCETs of frame exceeds minor frame");
+
+		//! Tasks mask of frame: bit of task index
+		static inline uint32_t Frame(uint32_t frame) { return Frames::Masks[frame]; }
+
+		//! Release offset of task, minor frames
+		static inline uint32_t Offset(uint32_t task) { return Offsets::Offsets[task]; }
+
+		//! Starts schedule from frame 0: call before the dispatch interrupt is started
+		static void Init()
+		{
+			m_Frame = 0;
+			m_Overruns = 0;
+			m_MinorCycles = (uint32_t)((uint64_t)Minor * Profile::Frequency() / 1000000);
+		}
+
+		//! Runs tasks of the frame: call from the timer interrupt of minor frame period
+		PORT_HOT static void Dispatch()
+		{
+			auto start = Profile::Cycles();
+			auto tasks = Frames::Masks[m_Frame];
+			m_Frame = m_Frame + 1 == FramesCount ? 0 : m_Frame + 1;
+			for(; tasks != 0; tasks &= tasks - 1)
+			{
+				auto i = (uint32_t)__builtin_ctz(tasks);
+				TRACE_BEGIN(Trace::CyclicTask, i);
+				Callbacks[i]();
+				TRACE_END(Trace::CyclicTask, i);
+			}
+			if(Profile::Cycles() - start > m_MinorCycles)
+				m_Overruns++;
+		}
+
+		//! Frame of the next dispatch
+		static inline uint32_t getFrame() { return m_Frame; }
+
+		//! Frames took longer than minor frame
+		static inline uint32_t getOverruns() { return m_Overruns; }
+	};
+
+	template<typename... Tasks> template<uint32_t... F> constexpr uint32_t ScheduleClass<Tasks...>::FramesTable<System::Sequence<F...>>::Masks[];
+	template<typename... Tasks> template<uint32_t... I> constexpr uint32_t ScheduleClass<Tasks...>::OffsetsTable<System::Sequence<I...>>::Offsets[];
+	template<typename... Tasks> constexpr TaskCallback ScheduleClass<Tasks...>::Callbacks[];
+	template<typename... Tasks> uint32_t ScheduleClass<Tasks...>::m_Frame;
+	template<typename... Tasks> uint32_t ScheduleClass<Tasks...>::m_Overruns;
+	template<typename... Tasks> uint32_t ScheduleClass<Tasks...>::m_MinorCycles;
+}
+
+#endif /* SRC_CYCLIC_H_ */
@@ -0,0 +1,130 @@
+/**
+ * Energy accounting: time of power modes, active time of timer & service callbacks, peripherals power states
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include "Services/Energy.h"
+#include "Services/Timer.h"
+#include "Services/IService.h"
+
+namespace Energy
+{
+	static const uint32_t ModeCurrent[ModesCount] = { ENERGY_RUN_CURRENT, ENERGY_SLEEP_CURRENT, ENERGY_STOP_CURRENT };
+
+	static ModeEnum Mode = ModeEnum::Run;
+	static uint32_t Last;							//!< Timestamp of last accounting
+	static uint64_t Cycles[ModesCount];				//!< Time of modes measured by timestamp
+	static uint64_t Microseconds[ModesCount];		//!< Time of modes given by wakeup timer
+
+	static uint64_t ToMicroseconds(uint64_t cycles)
+	{
+		uint32_t frequency = ENERGY_TIMESTAMP_FREQUENCY;
+		return cycles / frequency * 1000000u + cycles % frequency * 1000000u / frequency;
+	}
+
+	//! Adds time since last accounting to current mode
+	//! @note Call at least once per timestamp counter period: message loop does it by @c Enter & @c Exit
+	static void Account()
+	{
+		uint32_t now = ENERGY_TIMESTAMP();
+		Cycles[(unsigned int)Mode] += now - Last;
+		Last = now;
+	}
+
+	//! Charge of peripherals owned by service, pC
+	//! @param owner	Service name; NULL - board
+	static uint64_t PeripheralsCharge(const char *owner)
+	{
+		uint64_t charge = 0;
+		for(auto &peripheral : PeripheralsTable())
+			if((peripheral.Owner != NULL ? *peripheral.Owner : NULL) == owner)
+				charge += peripheral.getOnTime() * 1000u * peripheral.Current;
+		return charge;
+	}
+
+	void Reset()
+	{
+		for(unsigned int i = 0; i < ModesCount; i++)
+			Cycles[i] = Microseconds[i] = 0;
+#ifdef ENERGY_CONSUMERS
+		for(auto &consumers : consumers())
+			for(auto &consumer : consumers)
+				consumer = ConsumerStruct();
+#endif
+		for(auto &peripheral : PeripheralsTable())
+		{
+			peripheral.OnTime = 0;
+			peripheral.Since = SystemTime;
+		}
+		Last = ENERGY_TIMESTAMP();
+	}
+
+	void Enter(ModeEnum mode)
+	{
+		Account();
+		Mode = mode;
+	}
+
+	void Exit(uint32_t duration)
+	{
+		if(duration == 0)
+			Account();
+		else
+		{
+			// timestamp counter is halted or not reliable in the mode
+			Microseconds[(unsigned int)Mode] += duration;
+			Last = ENERGY_TIMESTAMP();
+		}
+		Mode = ModeEnum::Run;
+	}
+
+	void Report(ReportStruct &report)
+	{
+		Account();
+		report.Window = 0;
+		report.Charge = 0;
+		for(unsigned int i = 0; i < ModesCount; i++)
+		{
+			report.Time[i] = ToMicroseconds(Cycles[i]) + Microseconds[i];
+			report.Window += report.Time[i];
+			report.Charge += report.Time[i] * ModeCurrent[i];
+		}
+		report.ActiveTime = 0;
+		report.BaseCharge = report.Charge + PeripheralsCharge(NULL);
+		report.Overflow = false;
+#ifdef ENERGY_CONSUMERS
+		for(auto &consumers : consumers())
+			for(auto &consumer : consumers)
+				report.ActiveTime += ToMicroseconds(consumer.Cycles);
+		report.BaseCharge -= report.ActiveTime * ENERGY_RUN_CURRENT;
+		report.Overflow = Timer::TimersTable::size() > ENERGY_CONSUMERS || Services::ServicesTable::size() > ENERGY_CONSUMERS;
+#endif
+		for(auto &peripheral : PeripheralsTable())
+			report.Charge += peripheral.getOnTime() * 1000u * peripheral.Current;
+		report.AverageCurrent = report.Window == 0 ? 0 : (uint32_t)(report.Charge / report.Window);
+	}
+
+	bool GetConsumer(unsigned int n, ConsumerReportStruct &report)
+	{
+		size_t timers = Timer::TimersTable::size();
+		report.Service = n >= timers;
+		report.Index = report.Service ? n - timers : n;
+		if(report.Service && report.Index >= Services::ServicesTable::size())
+			return false;
+		report.Name = report.Service ? Services::ServicesTable::At(report.Index).Name : NULL;
+		report.Calls = 0;
+		report.ActiveTime = 0;
+#ifdef ENERGY_CONSUMERS
+		if(report.Index < ENERGY_CONSUMERS)
+		{
+			auto &consumer = consumers()[report.Service][report.Index];
+			report.Calls = consumer.Calls;
+			report.ActiveTime = ToMicroseconds(consumer.Cycles);
+		}
+#endif
+		report.Charge = report.ActiveTime * ENERGY_RUN_CURRENT + (report.Service ? PeripheralsCharge(report.Name) : 0);
+		return true;
+	}
+}
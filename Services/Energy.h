@@ -0,0 +1,248 @@
+/**
+ * Energy accounting: time of power modes, active time of timer & service callbacks, peripherals power states
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Power mode time: message loop marks sleep/stop by @c Enter & @c Exit around WFI; run time is the rest of the window.
+ * Time is measured by @c ENERGY_TIMESTAMP (default: Profile::Cycles()): counter must run in sleep mode;
+ * stop mode time (counter is halted) is given by wakeup timer (RTC, LPTIM) to @c Exit.
+ * Active time: Timer::Tick & Services::ProcessStates measure each callback of timer or service (callee of state change)
+ * when @c ENERGY_CONSUMERS is defined (CMake: -DCORTEXM_ENERGY_CONSUMERS=32): maximum count of timers & of services.
+ * Interrupts preempting the callback are attributed to it.
+ * Peripheral is declared by @c ENERGY_PERIPHERAL_DECLARE with current & owner service: on-time (mS, @c SystemTime)
+ * of peripheral is attributed to the owner. Peripherals are collected by linker into @c .energy_peripherals table (RAM).
+ * Charge is estimated by board currents of power modes (@c ENERGY_RUN_CURRENT e.t.c., uA) & peripherals currents, pC (uA * uS).
+ * Report covers the window since @c Reset: which services & timers spend the battery.
+ */
+
+/**
+ * @page Energy
+ * @par Config
+ * @code
+#define ENERGY_CONSUMERS 32			// attribution of callbacks: maximum count of timers & of services; undefined - off
+#define ENERGY_RUN_CURRENT 3500		// uA: board current of run mode
+#define ENERGY_SLEEP_CURRENT 1000	// uA: sleep mode
+#define ENERGY_STOP_CURRENT 2		// uA: stop mode
+#define ENERGY_TIMESTAMP() Profile::Cycles() // default
+#define ENERGY_TIMESTAMP_FREQUENCY Profile::Frequency()
+ * @endcode
+ * @par Linker script sections:
+ * - Peripherals table (RAM, initialized data)
+ * @code
+SECTIONS
+{
+	.data :
+	{
+		...
+		. = ALIGN(4);
+		PROVIDE(_Energy_PeripheralsTable_Begin = .);
+		KEEP(*(.energy_peripherals .energy_peripherals.*))
+		PROVIDE(_Energy_PeripheralsTable_End = .);
+	} >RAM AT>FLASH
+}
+ * @endcode
+ * @par Usage
+ * @code
+#include "Services/Energy.h"
+
+ENERGY_PERIPHERAL_DECLARE(Radio, 12000, &Services::Radio::ServiceName) // 12 mA while on, charge of Radio service
+
+ENERGY_PERIPHERAL(Radio)->On();
+ENERGY_PERIPHERAL(Radio)->Off();
+
+Energy::Reset(); // window start
+for(;;)
+{
+	Timer::Tick();
+	Services::ProcessStates();
+	Energy::Enter(Energy::ModeEnum::Sleep);
+	__WFI();
+	Energy::Exit();
+}
+
+Energy::ReportStruct report;
+Energy::Report(report);
+Energy::ConsumerReportStruct consumer;
+for(unsigned int i = 0; Energy::GetConsumer(i, consumer); i++)
+	printf("%s %u: %u calls, %llu uS, %llu uAh", consumer.Service ? consumer.Name : "timer", consumer.Index, consumer.Calls,
+		consumer.ActiveTime, consumer.Charge / Energy::PicocoulombsPerMicroampereHour);
+ * @endcode
+ */
+
+#ifndef SRC_ENERGY_H_
+#define SRC_ENERGY_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Port/Port.h"
+#include "Libs/LinkerTable.hpp"
+#include "Libs/Profile.hpp"
+
+#ifndef ENERGY_TIMESTAMP
+#	define ENERGY_TIMESTAMP() Profile::Cycles()
+#	define ENERGY_TIMESTAMP_FREQUENCY Profile::Frequency()
+#endif
+#ifndef ENERGY_RUN_CURRENT
+#	define ENERGY_RUN_CURRENT 3500
+#endif
+#ifndef ENERGY_SLEEP_CURRENT
+#	define ENERGY_SLEEP_CURRENT 1000
+#endif
+#ifndef ENERGY_STOP_CURRENT
+#	define ENERGY_STOP_CURRENT 2
+#endif
+
+//! Declares peripheral
+//! @param name		Peripheral name: C identifier
+//! @param current	Current while on, uA
+//! @param owner	Service name pointer (&Services::<service_name>::ServiceName) to attribute the charge; NULL - board
+#define ENERGY_PERIPHERAL_DECLARE(name, current, owner)\
+	static Energy::PeripheralStruct PORT_TABLE_ENTRY(energy_peripherals, Energy::PeripheralStruct) _EnergyPeripheral_##name = { #name, current, owner, false, 0, 0 };
+
+//! Peripheral pointer
+#define ENERGY_PERIPHERAL(name) (&_EnergyPeripheral_##name)
+
+extern "C"
+{
+#ifdef PORT_HOST
+#	define _Energy_PeripheralsTable_Begin PORT_SECTION_BEGIN(energy_peripherals)
+#	define _Energy_PeripheralsTable_End PORT_SECTION_END(energy_peripherals)
+#endif
+	extern unsigned char _Energy_PeripheralsTable_Begin[] PORT_LINKER_SYMBOL; //!< RAM address, first byte of array
+	extern unsigned char _Energy_PeripheralsTable_End[] PORT_LINKER_SYMBOL; //!< RAM address, first byte after array
+	extern volatile uint32_t SystemTime; //!< System time, mS
+}
+
+namespace Energy
+{
+	//! Power mode
+	enum class ModeEnum : uint8_t { Run, Sleep, Stop };
+	static const unsigned int ModesCount = 3;
+
+	//! Charge units: pC (uA * uS) in uAh
+	static const uint64_t PicocoulombsPerMicroampereHour = 3600000000ULL;
+
+	//! Peripheral power state
+	struct PeripheralStruct
+	{
+		const char *Name;
+		uint32_t Current;			//!< Current while on, uA
+		const char *const *Owner;	//!< Service name variable; NULL - board
+		bool Enabled;
+		uint32_t Since;				//!< Time of last on, mS
+		uint64_t OnTime;			//!< On-time of window (without current period), mS
+
+		inline void On()
+		{
+			if(!Enabled)
+			{
+				Since = SystemTime;
+				Enabled = true;
+			}
+		}
+
+		inline void Off()
+		{
+			if(Enabled)
+			{
+				OnTime += SystemTime - Since;
+				Enabled = false;
+			}
+		}
+
+		//! On-time of window, mS
+		inline uint64_t getOnTime() const { return OnTime + (Enabled ? SystemTime - Since : 0); }
+	};
+
+	//! Peripherals declared by @c ENERGY_PERIPHERAL_DECLARE
+	typedef System::LinkerTable<PeripheralStruct, _Energy_PeripheralsTable_Begin, _Energy_PeripheralsTable_End> PeripheralsTable;
+
+	//! Active time of timer or service
+	struct ConsumerStruct
+	{
+		uint64_t Cycles;	//!< Timestamp ticks of callbacks
+		uint32_t Calls;
+	};
+
+#ifdef ENERGY_CONSUMERS
+	//! Consumers: [0] - timers, [1] - services, table index
+	inline ConsumerStruct (&consumers())[2][ENERGY_CONSUMERS]
+	{
+		static ConsumerStruct table[2][ENERGY_CONSUMERS];
+		return table;
+	}
+
+	//! Timestamp of callback start
+	inline uint32_t &start()
+	{
+		static uint32_t timestamp;
+		return timestamp;
+	}
+
+	inline void Begin() { start() = ENERGY_TIMESTAMP(); }
+
+	//! Attributes callback time
+	//! @param service	False - timer, true - service
+	//! @param index	Table index
+	inline void End(bool service, size_t index)
+	{
+		auto cycles = ENERGY_TIMESTAMP() - start();
+		if(index < ENERGY_CONSUMERS)
+		{
+			auto &consumer = consumers()[service][index];
+			consumer.Cycles += cycles;
+			consumer.Calls++;
+		}
+	}
+
+#	define ENERGY_BEGIN() Energy::Begin()
+#	define ENERGY_END(service, index) Energy::End(service, index)
+#else
+#	define ENERGY_BEGIN() do {} while(0)
+#	define ENERGY_END(service, index) do {} while(0)
+#endif
+
+	//! Report of window
+	struct ReportStruct
+	{
+		uint64_t Time[ModesCount];	//!< Time of power modes, uS
+		uint64_t Window;			//!< Window duration, uS
+		uint64_t ActiveTime;		//!< Time of callbacks, uS
+		uint64_t Charge;			//!< Total charge, pC
+		uint64_t BaseCharge;		//!< Not attributed charge (framework, idle loop, sleep & stop, board peripherals), pC
+		uint32_t AverageCurrent;	//!< uA
+		bool Overflow;				//!< Timers or services count exceeds ENERGY_CONSUMERS: not attributed
+	};
+
+	//! Report of timer or service
+	struct ConsumerReportStruct
+	{
+		bool Service;		//!< False - timer, true - service
+		size_t Index;		//!< Table index
+		const char *Name;	//!< Service name; NULL - timer
+		uint32_t Calls;
+		uint64_t ActiveTime;	//!< uS
+		uint64_t Charge;		//!< Active time & owned peripherals, pC
+	};
+
+	//! Starts window: clears times, consumers & peripherals on-time
+	void Reset();
+
+	//! Enters low power mode: call before WFI/WFE
+	void Enter(ModeEnum mode);
+
+	//! Exits low power mode: call after wakeup
+	//! @param duration		Time of low power mode, uS (stop mode: by wakeup timer); 0 - by timestamp
+	void Exit(uint32_t duration = 0);
+
+	//! Report of window up to now
+	void Report(ReportStruct &report);
+
+	//! Report of timer or service: timers first, then services
+	//! @param n	Consumer number: 0..
+	//! @return False - no more consumers
+	bool GetConsumer(unsigned int n, ConsumerReportStruct &report);
+}
+
+#endif /* SRC_ENERGY_H_ */
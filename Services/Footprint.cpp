@@ -0,0 +1,146 @@
+/**
+ * Memory footprint self-report: linker tables of the framework & stack high-water marks
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include "Services/Footprint.h"
+#include "Services/Timer.h"
+#include "Services/IService.h"
+#include "Services/Energy.h"
+#include "Services/LpTimer.h"
+#include "Libs/Pool.hpp"
+#include "Libs/Metrics.hpp"
+#include "Libs/Profile.hpp"
+
+namespace Footprint
+{
+	//! Main stack of linker script symbols: Size == 0 - not provided
+	static StackStruct mainStack()
+	{
+		uint8_t *begin = _Footprint_MainStack_Begin, *end = _Footprint_MainStack_End;
+		StackStruct stack = { "main", begin, 0 };
+		if(begin != NULL && end > begin)
+			stack.Size = end - begin;
+		return stack;
+	}
+
+	//! Stack pointer register of the caller
+	static inline __attribute__((always_inline)) uint8_t *stackPointer()
+	{
+		uint8_t *sp;
+#if defined(__x86_64__)
+		__asm volatile ("mov %%rsp, %0" : "=r"(sp));
+#elif defined(__i386__)
+		__asm volatile ("mov %%esp, %0" : "=r"(sp));
+#else
+		__asm volatile ("mov %0, sp" : "=r"(sp)); // Cortex-M, AArch64
+#endif
+		return sp;
+	}
+
+	//! Paints stack up to the stack pointer (minus margin) of running stack or whole stack of not running context
+	//! @note Leaf function: the deepest frame of painting is this one
+	static __attribute__((noinline)) void paint(const StackStruct &stack)
+	{
+		auto sp = stackPointer();
+		auto end = stack.Begin + stack.Size;
+		if(sp > stack.Begin && sp <= end)
+			end = sp - StackMargin > stack.Begin ? sp - StackMargin : stack.Begin;
+		for(auto p = (volatile uint32_t*)stack.Begin; (uint8_t*)(p + 1) <= end; p++)
+			*p = StackPattern; // volatile: not a call of memset
+	}
+
+	bool GetTable(unsigned int n, TableStruct &table)
+	{
+		switch(n)
+		{
+		case 0:
+			table = { "timers", MemoryEnum::Flash, sizeof(Timer::TimerTableStruct), Timer::TimersTable::size(), 0 };
+			break;
+		case 1:
+			table = { "timers_states", MemoryEnum::Ram, sizeof(Timer::TimerStateStruct), Timer::StatesTable::size(), 0 };
+			break;
+		case 2:
+			table = { "services", MemoryEnum::Flash, sizeof(Services::IServiceTableEntryStruct), Services::ServicesTable::size(), 0 };
+			break;
+		case 3:
+			table = { "services_states", MemoryEnum::Ram, sizeof(Services::IServiceStateStruct), Services::StatesTable::size(), 0 };
+			break;
+		case 4:
+			table = { "pools", MemoryEnum::Ram, sizeof(System::PoolClass), System::PoolsTable::size(), 0 };
+			for(auto &pool : System::PoolsTable())
+				table.StorageBytes += (size_t)pool.getBlockSize() * pool.getCount();
+			break;
+		case 5:
+			table = { "metrics", MemoryEnum::Flash, sizeof(Metrics::MetricStruct), Metrics::MetricsTable::size(), 0 };
+			for(auto &metric : Metrics::MetricsTable())
+				table.StorageBytes += metric.size() * sizeof(Metrics::ValueStruct);
+			break;
+		case 6:
+			table = { "profile_sites", MemoryEnum::Ram, sizeof(Profile::SiteStruct), Profile::SitesTable::size(), 0 };
+			break;
+		case 7:
+			table = { "energy_peripherals", MemoryEnum::Ram, sizeof(Energy::PeripheralStruct), Energy::PeripheralsTable::size(), 0 };
+			break;
+		case 8:
+			table = { "footprint_stacks", MemoryEnum::Flash, sizeof(StackStruct), StacksTable::size(), 0 };
+			for(auto &stack : StacksTable())
+				table.StorageBytes += stack.Size;
+			break;
+		case 9:
+			table = { "lptimers", MemoryEnum::Flash, sizeof(Timer::TimerTableStruct), LpTimer::TimersTable::size(), 0 };
+			break;
+		case 10:
+			table = { "lptimers_states", MemoryEnum::Ram, sizeof(Timer::TimerStateStruct), LpTimer::StatesTable::size(), 0 };
+			break;
+		case 11:
+			table = { "timers_isr", MemoryEnum::Flash, sizeof(Timer::IsrTimerTableStruct), Timer::IsrTimersTable::size(), 0 };
+			break;
+		case 12:
+			table = { "timers_isr_states", MemoryEnum::Ram, sizeof(Timer::IsrTimerStateStruct), Timer::IsrStatesTable::size(), 0 };
+			break;
+		default:
+			return false;
+		}
+		return true;
+	}
+
+	void Paint()
+	{
+		auto main = mainStack();
+		if(main.Size != 0)
+			paint(main);
+		for(auto &stack : StacksTable())
+			paint(stack);
+	}
+
+	size_t HighWater(const StackStruct &stack)
+	{
+		auto p = (const uint32_t*)stack.Begin;
+		auto end = (const uint32_t*)(stack.Begin + stack.Size);
+		while(p < end && *p == StackPattern)
+			p++;
+		return (const uint8_t*)end - (const uint8_t*)p;
+	}
+
+	bool GetStack(unsigned int n, StackReportStruct &report)
+	{
+		auto main = mainStack();
+		if(main.Size != 0)
+		{
+			if(n == 0)
+			{
+				report = { main.Name, main.Size, HighWater(main) };
+				return true;
+			}
+			n--;
+		}
+		if(n >= StacksTable::size())
+			return false;
+		auto &stack = StacksTable::At(n);
+		report = { stack.Name, stack.Size, HighWater(stack) };
+		return true;
+	}
+}
@@ -0,0 +1,147 @@
+/**
+ * Memory footprint self-report: linker tables of the framework & stack high-water marks
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Each registry entry costs the table entry (FLASH or RAM) & the state or storage it refers to (RAM):
+ * timer - @c .timers & @c .timers_states entries, service - @c .services & @c .services_states entries,
+ * pool - @c .pools entry & blocks storage, metric - @c .metrics entry & values. Report enumerates the tables
+ * with entry sizes, counts & bytes: growth of which registry costs the most memory.
+ * Stacks: contexts (main stack, RTOS tasks, host threads) declared by @c FOOTPRINT_STACK_DECLARE are collected by linker
+ * into @c .footprint_stacks table (FLASH); main stack is given by linker script symbols. @c Paint fills the free part of stacks
+ * by pattern at startup (before interrupts are enabled); high-water mark is the deepest word changed since.
+ * Static footprint of the image: Tools/footprint.py (build step, see CMake @c cortexm_footprint).
+ */
+
+/**
+ * @page Footprint
+ * @par Linker script sections:
+ * - Stacks table (ROM, FLASH) & main stack bounds
+ * @code
+SECTIONS
+{
+	.footprint_stacks :
+	{
+		. = ALIGN(4);
+		PROVIDE(_Footprint_StacksTable_Begin = .);
+		KEEP(*(.footprint_stacks .footprint_stacks.*))
+		PROVIDE(_Footprint_StacksTable_End = .);
+	} >FLASH
+}
+PROVIDE(_Footprint_MainStack_Begin = _estack - _Min_Stack_Size);
+PROVIDE(_Footprint_MainStack_End = _estack);
+ * @endcode
+ * Host (Linux) build: main stack is not reported, threads stacks are declared.
+ * @par Usage
+ * @code
+#include "Services/Footprint.h"
+
+static uint8_t RadioTaskStack[1024] __attribute__((aligned(8)));
+FOOTPRINT_STACK_DECLARE(RadioTask, RadioTaskStack)
+
+int main()
+{
+	Footprint::Paint(); // first, before interrupts are enabled
+	...
+}
+
+Footprint::TableStruct table;
+for(unsigned int i = 0; Footprint::GetTable(i, table); i++)
+	printf("%s: %u x %u + %u bytes\n", table.Name, table.Count, table.EntrySize, table.StorageBytes);
+Footprint::StackReportStruct stack;
+for(unsigned int i = 0; Footprint::GetStack(i, stack); i++)
+	printf("stack %s: %u/%u bytes\n", stack.Name, stack.Used, stack.Size);
+ * @endcode
+ * Build step:
+ * @code
+python3 Tools/footprint.py firmware.elf --objdump arm-none-eabi-objdump --ram-limit 20480
+ * @endcode
+ */
+
+#ifndef SRC_FOOTPRINT_H_
+#define SRC_FOOTPRINT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Port/Port.h"
+#include "Libs/LinkerTable.hpp"
+
+//! Declares stack of context
+//! @param name		Context name: C identifier
+//! @param buffer	Stack array (static)
+#define FOOTPRINT_STACK_DECLARE(name, buffer)\
+	static const Footprint::StackStruct PORT_TABLE_ENTRY(footprint_stacks, Footprint::StackStruct) _FootprintStack_##name = { #name, (uint8_t*)(buffer), sizeof(buffer) };
+
+extern "C"
+{
+#ifdef PORT_HOST
+#	define _Footprint_StacksTable_Begin PORT_SECTION_BEGIN(footprint_stacks)
+#	define _Footprint_StacksTable_End PORT_SECTION_END(footprint_stacks)
+#endif
+	extern unsigned char _Footprint_StacksTable_Begin[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte of array
+	extern unsigned char _Footprint_StacksTable_End[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte after array
+	extern unsigned char _Footprint_MainStack_Begin[] __attribute__((weak)); //!< RAM address, lowest byte of main stack
+	extern unsigned char _Footprint_MainStack_End[] __attribute__((weak)); //!< RAM address, first byte after main stack
+}
+
+namespace Footprint
+{
+	//! Memory of table
+	enum class MemoryEnum : uint8_t { Flash, Ram };
+
+	static const uint32_t StackPattern = 0xA5A5A5A5;	//!< Paint of free stack
+	//! Not painted bytes under the stack pointer of paint loop (leaf function): red zone of host ABI (x86-64: 128 bytes)
+	static const size_t StackMargin = 128;
+
+	//! Stack of context
+	struct StackStruct
+	{
+		const char *Name;
+		uint8_t *Begin;	//!< Lowest address: stack grows down
+		size_t Size;	//!< Bytes
+	};
+
+	//! Stacks declared by @c FOOTPRINT_STACK_DECLARE
+	typedef System::LinkerTable<const StackStruct, _Footprint_StacksTable_Begin, _Footprint_StacksTable_End> StacksTable;
+
+	//! Linker table of the framework
+	struct TableStruct
+	{
+		const char *Name;		//!< Section name
+		MemoryEnum Memory;		//!< Memory of entries
+		size_t EntrySize;		//!< Bytes
+		size_t Count;			//!< Entries count
+		size_t StorageBytes;	//!< RAM referred by entries: pools blocks, metrics values
+
+		//! Bytes of entries
+		inline size_t Bytes() const { return EntrySize * Count; }
+	};
+
+	//! Stack report
+	struct StackReportStruct
+	{
+		const char *Name;
+		size_t Size;	//!< Bytes
+		size_t Used;	//!< High-water mark, bytes
+	};
+
+	//! Report of linker table
+	//! @param n	Table number: 0..
+	//! @return False - no more tables
+	bool GetTable(unsigned int n, TableStruct &table);
+
+	//! Paints free part of main stack & declared stacks: running stack is painted below the stack pointer of paint loop
+	//! @note Call at startup before interrupts are enabled
+	void Paint();
+
+	//! High-water mark of stack, bytes: not painted part
+	size_t HighWater(const StackStruct &stack);
+
+	//! Report of stack: main stack (when linker script provides its bounds) first, then declared stacks
+	//! @param n	Stack number: 0..
+	//! @return False - no more stacks
+	bool GetStack(unsigned int n, StackReportStruct &report);
+}
+
+#endif /* SRC_FOOTPRINT_H_ */
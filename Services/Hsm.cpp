@@ -0,0 +1,74 @@
+/**
+ * Hierarchical state machine: states & transitions tables compiled to flat dispatch tables
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include "Services/Hsm.h"
+#include "Libs/Trace.hpp"
+
+namespace Hsm
+{
+	//! Entry actions from boundary (not entered) down to leaf
+	static void enter(const MachineStruct &machine, StateId boundary, StateId leaf)
+	{
+		StateId path[HSM_MAX_DEPTH];
+		uint32_t n = 0;
+		for(auto s = leaf; s != boundary; s = machine.States[s].Parent)
+			path[n++] = s;
+		while(n > 0)
+		{
+			auto entry = machine.States[path[--n]].Entry;
+			if(entry != NULL)
+				entry();
+		}
+	}
+
+	void Enter(const MachineStruct &machine, StateId &state)
+	{
+		StateId leaf = 0;
+		while(machine.States[leaf].Initial != None)
+			leaf = machine.States[leaf].Initial;
+		state = leaf;
+		enter(machine, None, leaf);
+	}
+
+	PORT_HOT bool Dispatch(const MachineStruct &machine, StateId &state, EventId event)
+	{
+		if(state == None || event >= machine.Events)
+			return false;
+		for(auto t = machine.Handlers[state * machine.Events + event]; t != None; t = machine.Routes[t].Next)
+		{
+			auto &transition = machine.Transitions[t];
+			if(transition.Guard != NULL && !transition.Guard())
+				continue;
+			auto &route = machine.Routes[t];
+			if(route.Leaf == None)
+			{
+				// internal transition
+				if(transition.Action != NULL)
+					transition.Action();
+				return true;
+			}
+			for(auto s = state; s != route.Boundary; s = machine.States[s].Parent)
+				if(machine.States[s].Exit != NULL)
+					machine.States[s].Exit();
+			if(transition.Action != NULL)
+				transition.Action();
+			TRACE_EVENT(Trace::HsmTransition, t, route.Leaf);
+			state = route.Leaf; // entry actions see the new state
+			enter(machine, route.Boundary, route.Leaf);
+			return true;
+		}
+		return false;
+	}
+
+	bool isIn(const MachineStruct &machine, StateId current, StateId state)
+	{
+		for(auto s = current; s != None; s = machine.States[s].Parent)
+			if(s == state)
+				return true;
+		return false;
+	}
+}
@@ -0,0 +1,338 @@
+/**
+ * Hierarchical state machine: states & transitions tables compiled to flat dispatch tables
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note State logic of service as bit tests of @c StateChanged grows into nested if-chains. Here the machine is declared
+ * by two constant tables: states (parent, initial child, entry & exit actions) & transitions (source, event, target,
+ * guard, action). At compile time they are checked (@c static_assert) & flattened: handler of each state & event
+ * (transition of the state or of the nearest ancestor), fallback of guarded transition (next candidate of the same
+ * event), exit boundary & target leaf (initial children of target) of each transition. So dispatch is one table lookup:
+ * no search of ancestors; exit & entry actions run from the current leaf up to the boundary & down to the target leaf.
+ * Dispatch code is shared by all the machines (Services/Hsm.cpp): the machine costs its tables only.
+ * Transitions are external (source is exited & entered again); target @c None - internal transition: action only.
+ * Current state is always the leaf: state with children must have the initial child.
+ * Run to completion: actions don't dispatch events of the same machine (set service state bits: the next round does).
+ * Events of service state bits: @c BitsClass maps set/cleared bits to events (table of bit index), @c Hsm::StateChanged
+ * & @c Hsm::LocalStateChanged are the callbacks of @c SERVICE_DECLARE.
+ */
+
+/**
+ * @page Hsm
+ * @par Config
+ * @code
+#define HSM_MAX_DEPTH 8		// nesting levels of states limit: stack of entry actions path
+ * @endcode
+ * @par Usage
+ * @code
+#include "Services/Hsm.h"
+
+namespace Services
+{
+	namespace Pump
+	{
+		enum StateEnum : Hsm::StateId { Top, Off, On, Idle, Running, StatesCount };
+		enum EventEnum : Hsm::EventId { Power, Start, Stop, EventsCount };
+
+		static void motorOn() {}
+		static void motorOff() {}
+		static bool isPrimed() { return true; }
+
+		static constexpr Hsm::StateStruct States[StatesCount] = {
+			// parent, initial child, entry, exit: parent is declared before the child
+			{ Hsm::None, Off, NULL, NULL },			// Top
+			{ Top, Hsm::None, NULL, NULL },			// Off
+			{ Top, Idle, NULL, NULL },				// On
+			{ On, Hsm::None, NULL, NULL },			// Idle
+			{ On, Hsm::None, &motorOn, &motorOff },	// Running
+		};
+		static constexpr Hsm::TransitionStruct Transitions[] = {
+			// source, event, target, guard, action
+			{ Off, Power, On, NULL, NULL },
+			{ On, Power, Off, NULL, NULL },
+			{ Idle, Start, Running, &isPrimed, NULL },
+			{ Running, Stop, Idle, NULL, NULL },
+		};
+		HSM_MACHINE(Machine, States, Transitions, EventsCount)
+
+		// bit 0 of Button service set - Power, own local state bits 0 & 1 - Start & Stop
+		static constexpr Hsm::BitEventStruct ButtonBits[] = { { 0, true, Power } };
+		static constexpr Hsm::BitEventStruct LocalBits[] = { { 0, true, Start }, { 1, true, Stop } };
+		HSM_BITS(ButtonEvents, ButtonBits)
+		HSM_BITS(LocalEvents, LocalBits)
+
+		static bool Enable(const char *name, bool enable)
+		{
+			if(name == ServiceName && enable)
+				Machine::Init(); // entry actions of Top & Off
+			return true;
+		}
+		SERVICE_DECLARE(Pump, &Enable, (&Hsm::StateChanged<Machine, &Button::ServiceName, ButtonEvents>), NULL,
+			(&Hsm::LocalStateChanged<Machine, LocalEvents>))
+	}
+}
+auto running = Services::Pump::Machine::isIn(Services::Pump::Running);
+ * @endcode
+ */
+
+#ifndef SRC_HSM_H_
+#define SRC_HSM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Services/IService.h"
+#include "Libs/Sequence.hpp"
+
+#ifndef HSM_MAX_DEPTH
+#	define HSM_MAX_DEPTH 8
+#endif
+
+//! Declares state machine type of tables
+//! @param name			Type name
+//! @param states		Constant array of @c Hsm::StateStruct: index is the state
+//! @param transitions	Constant array of @c Hsm::TransitionStruct
+//! @param events		Events count
+#define HSM_MACHINE(name, states, transitions, events)\
+	typedef Hsm::MachineClass<sizeof(states) / sizeof(*(states)), states, sizeof(transitions) / sizeof(*(transitions)), transitions, events> name;
+
+//! Declares events type of service state bits
+//! @param name			Type name
+//! @param map			Constant array of @c Hsm::BitEventStruct
+#define HSM_BITS(name, map)\
+	typedef Hsm::BitsClass<sizeof(map) / sizeof(*(map)), map> name;
+
+namespace Hsm
+{
+	typedef uint8_t StateId;	//!< State: index of states table
+	typedef uint8_t EventId;	//!< Event: 0..events count - 1
+
+	static const uint8_t None = 0xFF;	//!< No state, no event, no transition
+
+	typedef void (*ActionCallback)();
+	typedef bool (*GuardCallback)();
+
+	//! State of states table
+	struct StateStruct
+	{
+		StateId Parent;			//!< Parent state: declared before; @c None - top state (the first)
+		StateId Initial;		//!< Initial child: entered with the state; @c None - leaf state
+		ActionCallback Entry;	//!< NULL - none
+		ActionCallback Exit;	//!< NULL - none
+	};
+
+	//! Transition of transitions table: transitions of the same source & event are tried in order of declaration
+	struct TransitionStruct
+	{
+		StateId Source;			//!< State handling the event: the current state or its ancestor
+		EventId Event;
+		StateId Target;			//!< @c None - internal transition: action only, no exit & entry
+		GuardCallback Guard;	//!< False - transition is not taken, the next candidate is tried; NULL - none
+		ActionCallback Action;	//!< Called after exit actions, before entry actions; NULL - none
+	};
+
+	//! Event of service state bit
+	struct BitEventStruct
+	{
+		uint8_t Bit;			//!< Bit index of service state
+		bool Set;				//!< True - bit is set; false - bit is cleared
+		EventId Event;
+	};
+
+	//! Flattened transition
+	struct RouteStruct
+	{
+		StateId Next;			//!< Next candidate of the event when guard is false: transition index; @c None - not handled
+		StateId Boundary;		//!< The deepest proper ancestor of source & target: not exited, not entered; @c None - above top
+		StateId Leaf;			//!< Target leaf: target & its initial children; @c None - internal transition
+	};
+
+	//! Tables of machine (FLASH): dispatch code is shared by all the machines
+	struct MachineStruct
+	{
+		const StateStruct *States;
+		const TransitionStruct *Transitions;
+		const StateId *Handlers;	//!< Transition of state & event: index state * Events + event; @c None - not handled
+		const RouteStruct *Routes;	//!< Routes of transitions
+		uint8_t Events;				//!< Events count
+	};
+
+	//! Enters top state & its initial children
+	//! @param state	Current state: set to the leaf
+	void Enter(const MachineStruct &machine, StateId &state);
+
+	//! Processes event: transition of the current state or of its ancestor, then exit, action & entry actions
+	//! @param state	Current state: set to the target leaf
+	//! @return True - event is handled; false - no transition (or guards are false)
+	bool Dispatch(const MachineStruct &machine, StateId &state, EventId event);
+
+	//! Checks the current state is the state or its descendant
+	bool isIn(const MachineStruct &machine, StateId current, StateId state);
+}
+
+namespace HsmDetail
+{
+	//! Tree of states & transitions: checks & flattening
+	template<size_t S, const Hsm::StateStruct (&States)[S], size_t T, const Hsm::TransitionStruct (&Transitions)[T], uint32_t E> struct Tree
+	{
+		static constexpr Hsm::StateId parent(uint32_t s) { return States[s].Parent; }
+		static constexpr uint32_t depth(uint32_t s) { return parent(s) == Hsm::None ? 1 : 1 + depth(parent(s)); }
+		static constexpr uint32_t maxDepth(uint32_t s) { return s == S ? 0 : System::Max(depth(s), maxDepth(s + 1)); }
+
+		//! Initial children of state down to the leaf
+		static constexpr Hsm::StateId leaf(uint32_t s) { return States[s].Initial == Hsm::None ? s : leaf(States[s].Initial); }
+
+		//! a is the proper ancestor of s; @c None is the ancestor of all
+		static constexpr bool above(uint32_t a, uint32_t s) { return a == Hsm::None || (parent(s) != Hsm::None && (parent(s) == a || above(a, parent(s)))); }
+		//! The deepest proper ancestor of s & t: a is parent of s, then its ancestors
+		static constexpr Hsm::StateId boundary(uint32_t a, uint32_t t) { return above(a, t) ? a : boundary(parent(a), t); }
+
+		//! Transition of state & event since index i
+		static constexpr Hsm::StateId find(uint32_t s, uint32_t e, uint32_t i)
+		{
+			return i == T ? Hsm::None : Transitions[i].Source == s && Transitions[i].Event == e ? i : find(s, e, i + 1);
+		}
+		//! Handler of state & event: transition of the state or of the nearest ancestor
+		static constexpr Hsm::StateId handler(uint32_t s, uint32_t e) { return s == Hsm::None ? Hsm::None : found(find(s, e, 0), s, e); }
+		static constexpr Hsm::StateId found(Hsm::StateId t, uint32_t s, uint32_t e) { return t != Hsm::None ? t : handler(parent(s), e); }
+
+		static constexpr Hsm::RouteStruct route(uint32_t t)
+		{
+			return {
+				found(find(Transitions[t].Source, Transitions[t].Event, t + 1), Transitions[t].Source, Transitions[t].Event),
+				Transitions[t].Target == Hsm::None ? Hsm::None : boundary(parent(Transitions[t].Source), Transitions[t].Target),
+				Transitions[t].Target == Hsm::None ? Hsm::None : leaf(Transitions[t].Target)
+			};
+		}
+
+		//! State has children
+		static constexpr bool composite(uint32_t s, uint32_t i) { return i < S && (parent(i) == s || composite(s, i + 1)); }
+		//! States of index i..: the first is top, parent is declared before, state with children has the initial child
+		static constexpr bool validStates(uint32_t i)
+		{
+			return i == S || ((i == 0 ? parent(i) == Hsm::None : parent(i) < i)
+				&& (States[i].Initial == Hsm::None ? !composite(i, i + 1) : States[i].Initial < S && parent(States[i].Initial) == i)
+				&& validStates(i + 1));
+		}
+		//! Transitions of index i..: states & events are declared
+		static constexpr bool validTransitions(uint32_t i)
+		{
+			return i == T || (Transitions[i].Source < S && Transitions[i].Event < E && (Transitions[i].Target == Hsm::None || Transitions[i].Target < S)
+				&& validTransitions(i + 1));
+		}
+	};
+}
+
+namespace Hsm
+{
+	//! State machine of tables: declared by @c HSM_MACHINE
+	//! @note Static: one instance of tables. Not valid tables are compile errors
+	template<size_t S, const StateStruct (&States)[S], size_t T, const TransitionStruct (&Transitions)[T], uint32_t E> class MachineClass
+	{
+		typedef HsmDetail::Tree<S, States, T, Transitions, E> Tree;
+
+		static_assert(S >= 1 && S < None && T < None && E >= 1 && E < None, "State machine: 1..254 states, 0..254 transitions, 1..254 events");
+		static_assert(Tree::validStates(0), "State machine: the first state must be top, parent is declared before the child, state with children has the initial child");
+		static_assert(Tree::validTransitions(0), "State machine: transition of not declared state or event");
+		static_assert(Tree::maxDepth(0) <= HSM_MAX_DEPTH, "State machine: nesting of states exceeds HSM_MAX_DEPTH");
+
+		template<typename Sequence> struct HandlersTable;
+		template<uint32_t... I> struct HandlersTable<System::Sequence<I...>>
+		{
+			static constexpr StateId Table[sizeof...(I)] = { Tree::handler(I / E, I % E)... };
+		};
+		template<typename Sequence> struct RoutesTable;
+		template<uint32_t... I> struct RoutesTable<System::Sequence<I...>>
+		{
+			static constexpr RouteStruct Table[sizeof...(I) != 0 ? sizeof...(I) : 1] = { Tree::route(I)... };
+		};
+		typedef HandlersTable<typename System::MakeSequence<S * E>::Type> Handlers;
+		typedef RoutesTable<typename System::MakeSequence<T>::Type> Routes;
+
+		static constexpr MachineStruct Machine = { States, Transitions, Handlers::Table, Routes::Table, E };
+
+		static StateId m_State;	//!< Current leaf state; @c None - not initialized
+
+	public:
+		static constexpr uint32_t StatesCount = S;
+		static constexpr uint32_t EventsCount = E;
+		//! Bytes of flat tables (FLASH): handlers & routes
+		static constexpr size_t TablesSize = sizeof(Handlers::Table) + sizeof(Routes::Table) + sizeof(MachineStruct);
+
+		//! Enters top state & initial children
+		static inline void Init() { Hsm::Enter(Machine, m_State); }
+
+		//! Processes event: @see Hsm::Dispatch
+		static inline bool Dispatch(EventId event) { return Hsm::Dispatch(Machine, m_State, event); }
+
+		//! Current leaf state
+		static inline StateId getState() { return m_State; }
+
+		//! Checks the current state is the state or its descendant
+		static inline bool isIn(StateId state) { return Hsm::isIn(Machine, m_State, state); }
+	};
+
+	template<size_t S, const StateStruct (&States)[S], size_t T, const TransitionStruct (&Transitions)[T], uint32_t E>
+		template<uint32_t... I> constexpr StateId MachineClass<S, States, T, Transitions, E>::HandlersTable<System::Sequence<I...>>::Table[];
+	template<size_t S, const StateStruct (&States)[S], size_t T, const TransitionStruct (&Transitions)[T], uint32_t E>
+		template<uint32_t... I> constexpr RouteStruct MachineClass<S, States, T, Transitions, E>::RoutesTable<System::Sequence<I...>>::Table[];
+	template<size_t S, const StateStruct (&States)[S], size_t T, const TransitionStruct (&Transitions)[T], uint32_t E>
+		constexpr MachineStruct MachineClass<S, States, T, Transitions, E>::Machine;
+	template<size_t S, const StateStruct (&States)[S], size_t T, const TransitionStruct (&Transitions)[T], uint32_t E>
+		StateId MachineClass<S, States, T, Transitions, E>::m_State = None;
+
+	//! Events of service state bits: declared by @c HSM_BITS
+	template<size_t N, const BitEventStruct (&Map)[N]> class BitsClass
+	{
+		static constexpr uint32_t Bits = sizeof(Services::StateType) * 8;
+
+		static constexpr EventId event(uint32_t bit, bool set, uint32_t i)
+		{
+			return i == N ? None : Map[i].Bit == bit && Map[i].Set == set ? Map[i].Event : event(bit, set, i + 1);
+		}
+		static constexpr bool valid(uint32_t i) { return i == N || (Map[i].Bit < Bits && valid(i + 1)); }
+		static_assert(valid(0), "State machine: bit index exceeds service state bits");
+
+		template<typename Sequence> struct EventsTable;
+		template<uint32_t... I> struct EventsTable<System::Sequence<I...>>
+		{
+			static constexpr EventId Events[2][sizeof...(I)] = { { event(I, false, 0)... }, { event(I, true, 0)... } };
+		};
+		typedef EventsTable<typename System::MakeSequence<Bits>::Type> Table;
+
+	public:
+		//! Dispatches events of changed bits: in order of bit index
+		template<typename Machine> static void Dispatch(Services::StateType stateBits, Services::StateType changedStateMask)
+		{
+			for(; changedStateMask != 0; changedStateMask &= changedStateMask - 1)
+			{
+				auto bit = (uint32_t)__builtin_ctzll(changedStateMask);
+				auto event = Table::Events[(stateBits >> bit) & 1][bit];
+				if(event != None)
+					Machine::Dispatch(event);
+			}
+		}
+	};
+
+	template<size_t N, const BitEventStruct (&Map)[N]>
+		template<uint32_t... I> constexpr EventId BitsClass<N, Map>::EventsTable<System::Sequence<I...>>::Events[2][sizeof...(I)];
+
+	//! @c StateChanged callback of service: events of state bits of another service
+	//! @param Service	Name of the service: &Services::<service_name>::ServiceName
+	template<typename Machine, const char *const *Service, typename Events>
+	void StateChanged(const char *name, Services::StateType stateBits, Services::StateType changedStateMask)
+	{
+		if(name == *Service)
+			Events::template Dispatch<Machine>(stateBits, changedStateMask);
+	}
+
+	//! @c LocalStateChanged callback of service: events of local state bits (set by ISR), bits are cleared
+	template<typename Machine, typename Events>
+	void LocalStateChanged(const char *name __attribute__((unused)), Services::StateType &stateBits)
+	{
+		Events::template Dispatch<Machine>(stateBits, stateBits);
+		stateBits = 0;
+	}
+}
+
+#endif /* SRC_HSM_H_ */
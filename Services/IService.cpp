@@ -1,5 +1,9 @@
 
 #include "IService.h"
+#include "Libs/Probe.hpp"
+#include "Libs/Trace.hpp"
+#include "Services/Energy.h"
+#include "Libs/Profile.hpp"
 #include <cstring>
 
 namespace Services
@@ -9,7 +13,7 @@ namespace Services
 	static int findIndex(const char *name)
 	{
 		auto i = 0;
-		for(auto table = (IServiceTableEntryStruct *)&_Services_Table_Begin; (unsigned char *)table < &_Services_Table_End; table++, i++)
+		for(auto table = ServicesTable::begin(); table < ServicesTable::end(); table++, i++)
 			if(table->Name == name)
 				return i;
 		return -1;
@@ -17,11 +21,11 @@ namespace Services
 
 	void Init()
 	{
-		memset(&_Services_StatesTable_Begin, 0, &_Services_StatesTable_End - &_Services_StatesTable_Begin);
+		memset(StatesTable::begin(), 0, StatesTable::size() * sizeof(IServiceStateStruct));
 
 #ifdef SEGGER_SYSVIEW_H
 		auto i = 0;
-		for(auto table = (IServiceTableEntryStruct *)&_Services_Table_Begin; (unsigned char *)table < &_Services_Table_End; table++, i++)
+		for(auto table = ServicesTable::begin(); table < ServicesTable::end(); table++, i++)
 		{
 			SEGGER_SYSVIEW_OnTaskCreate(SEGGER_SYSVIEW_TaskBase + i);
 			{
@@ -36,48 +40,104 @@ namespace Services
 	{
 		auto i = findIndex(name);
 		if(i >= 0)
-			return ((IServiceStateStruct*)&_Services_StatesTable_Begin)[i].Enabled;
+			return StatesTable::At(i).Enabled;
 		return false;
 	}
 
-	bool Enable(const char *name, bool enable)
+	namespace ServicesDetail
 	{
-		auto i = 0;
-		for(auto table = (IServiceTableEntryStruct *)&_Services_Table_Begin; (unsigned char *)table < &_Services_Table_End; table++, i++)
+		uint32_t ReadyCycles;
+
+		bool isReady(const IServiceTableEntryStruct *table, bool enable)
 		{
-			if(name == NULL || table->Name == name)
+			if(enable)
 			{
-				auto state = &((IServiceStateStruct*)&_Services_StatesTable_Begin)[i];
-//				if(table->Enable != NULL && state->Enabled != enable && table->Enable(enable))
-//					state->Enabled = enable;
-				if(table->Enable != NULL && state->Enabled != enable)
-				{
-#ifdef SEGGER_SYSVIEW_H
-					if(enable)
-						SEGGER_SYSVIEW_OnTaskStartExec(SEGGER_SYSVIEW_TaskBase + i);
-#endif
-					if(table->Enable(table->Name, enable))
-					{
-						// success
-						state->Enabled = enable;
-						// callback another services
-						if(name != NULL)
-						{
-							for(auto table2 = (IServiceTableEntryStruct *)&_Services_Table_Begin; (unsigned char *)table2 < &_Services_Table_End; table2++)
-								if(table2->Name != name && table2->Enable != NULL)
-									table2->Enable(name, enable);
-						}
-					}
+				for(auto dependency = table->Dependencies; dependency != NULL && *dependency != NULL; dependency++)
+					if(!isEnabled(**dependency))
+						return false;
+				return true;
+			}
+			auto i = 0;
+			for(auto table2 = ServicesTable::begin(); table2 < ServicesTable::end(); table2++, i++)
+				if(StatesTable::At(i).Enabled)
+					for(auto dependency = table2->Dependencies; dependency != NULL && *dependency != NULL; dependency++)
+						if(**dependency == table->Name)
+							return false;
+			return true;
+		}
+
+		uint8_t maxLevel()
+		{
+			uint8_t level = 0;
+			for(auto &table : ServicesTable())
+				if(table.Level > level)
+					level = table.Level;
+			return level;
+		}
+	}
+
+	//! Enables/disables service of table
+	//! @param notify	Callback another services
+	static bool enableService(unsigned int i, bool enable, bool notify)
+	{
+		auto table = &ServicesTable::At(i);
+		auto state = &StatesTable::At(i);
+//		if(table->Enable != NULL && state->Enabled != enable && table->Enable(enable))
+//			state->Enabled = enable;
+		if(table->Enable != NULL && state->Enabled != enable && ServicesDetail::isReady(table, enable))
+		{
 #ifdef SEGGER_SYSVIEW_H
-					if((state->Enabled == enable && !enable) || (state->Enabled != enable && enable))
-						SEGGER_SYSVIEW_OnTaskStopReady(SEGGER_SYSVIEW_TaskBase + i, 0);
+			if(enable)
+				SEGGER_SYSVIEW_OnTaskStartExec(SEGGER_SYSVIEW_TaskBase + i);
 #endif
+			if(table->Enable(table->Name, enable))
+			{
+				// success
+				state->Enabled = enable;
+				TRACE_EVENT(Trace::ServicesEnable, i, enable);
+				// callback another services
+				if(notify)
+				{
+					for(auto &table2 : ServicesTable())
+						if(table2.Name != table->Name && table2.Enable != NULL)
+							table2.Enable(table->Name, enable);
 				}
-				if(name != NULL)
-					return state->Enabled == enable;
 			}
+#ifdef SEGGER_SYSVIEW_H
+			if((state->Enabled == enable && !enable) || (state->Enabled != enable && enable))
+				SEGGER_SYSVIEW_OnTaskStopReady(SEGGER_SYSVIEW_TaskBase + i, 0);
+#endif
+		}
+		return state->Enabled == enable || table->Enable == NULL;
+	}
+
+	bool Enable(const char *name, bool enable)
+	{
+		if(name != NULL)
+		{
+			auto i = findIndex(name);
+			return i >= 0 && enableService(i, enable, true) && StatesTable::At(i).Enabled == enable;
+		}
+		// all the services: topological order
+		auto start = Profile::Cycles();
+		auto max = ServicesDetail::maxLevel();
+		auto result = true;
+		for(unsigned int step = 0; step <= max; step++)
+		{
+			auto level = ServicesDetail::levelOf(step, max, enable);
+			auto i = 0;
+			for(auto table = ServicesTable::begin(); table < ServicesTable::end(); table++, i++)
+				if(table->Level == level && !enableService(i, enable, false))
+					result = false;
 		}
-		return name == NULL;
+		if(enable)
+			ServicesDetail::ReadyCycles = Profile::Cycles() - start;
+		return result;
+	}
+
+	uint32_t ReadyTime()
+	{
+		return Profile::ToMicroseconds(ServicesDetail::ReadyCycles);
 	}
 
 	StateType State(const char *name)
@@ -85,7 +145,7 @@ namespace Services
 		auto i = findIndex(name);
 		if(i < 0)
 			return (StateType)0;
-		return ((IServiceStateStruct*)&_Services_StatesTable_Begin)[i].State;
+		return StatesTable::At(i).State;
 	}
 
 	bool SetState(const char *name, StateType stateBits, StateType stateMask)
@@ -93,7 +153,7 @@ namespace Services
 		auto i = findIndex(name);
 		if(i < 0)
 			return false;
-		return ((IServiceStateStruct*)&_Services_StatesTable_Begin)[i].SetState(stateBits, stateMask);
+		return StatesTable::At(i).SetState(stateBits, stateMask);
 	}
 
 	bool SetLocalState(const char *name, StateType stateBits)
@@ -101,32 +161,62 @@ namespace Services
 		auto i = findIndex(name);
 		if(i < 0)
 			return false;
-		return ((IServiceStateStruct*)&_Services_StatesTable_Begin)[i].SetLocalState(stateBits);
+		TRACE_EVENT(Trace::ServicesLocalState, i, stateBits);
+		return StatesTable::At(i).SetLocalState(stateBits);
 	}
 
-	void ProcessStates()
+	PORT_HOT void ProcessStates()
 	{
+		PROBE_SCOPE(Probe::ServicesProcessStates);
 		auto i = 0;
-		for(auto table = (IServiceTableEntryStruct *)&_Services_Table_Begin; (unsigned char *)table < &_Services_Table_End; table++, i++)
+		for(auto table = ServicesTable::begin(); table < ServicesTable::end(); table++, i++)
 		{
-			auto state = &((IServiceStateStruct*)&_Services_StatesTable_Begin)[i];
+			auto state = &StatesTable::At(i);
 			if(state->Enabled)
 			{
 				// state bits processing
 				if(state->ChangedState != 0)
 				{
+					TRACE_EVENT(Trace::ServicesStateChanged, i, state->State);
 					// some state bits was changed since previous process // run callback for all another services
-					for(auto table2 = (IServiceTableEntryStruct *)&_Services_Table_Begin; (unsigned char *)table2 < &_Services_Table_End; table2++)
+					auto i2 = 0;
+					for(auto table2 = ServicesTable::begin(); table2 < ServicesTable::end(); table2++, i2++)
 						if(table2->Name != table->Name && table2->StateChanged != NULL)
-							table2->StateChanged(table->Name, state->State, state->ChangedState); // is another service & callback is defined
+						{
+							// is another service & callback is defined
+							PROBE_ENTER(Probe::ServicesCallback);
+							TRACE_BEGIN(Trace::ServicesCallback, i2, i);
+							ENERGY_BEGIN();
+							table2->StateChanged(table->Name, state->State, state->ChangedState);
+							ENERGY_END(true, i2);
+							TRACE_END(Trace::ServicesCallback, i2, i);
+							PROBE_EXIT(Probe::ServicesCallback);
+						}
 					// run callback for own service
 					if(table->StateChangedBy != NULL)
-						table->StateChangedBy(table->Name, state->State, state->ChangedState); // own callback is defined
+					{
+						// own callback is defined
+						PROBE_ENTER(Probe::ServicesCallback);
+						TRACE_BEGIN(Trace::ServicesCallback, i, i);
+						ENERGY_BEGIN();
+						table->StateChangedBy(table->Name, state->State, state->ChangedState);
+						ENERGY_END(true, i);
+						TRACE_END(Trace::ServicesCallback, i, i);
+						PROBE_EXIT(Probe::ServicesCallback);
+					}
 					state->ChangedState = 0;
 				}
 				// local state bits processing
 				if(table->LocalStateChanged != NULL && state->LocalChangedState != 0)
+				{
+					PROBE_ENTER(Probe::ServicesCallback);
+					TRACE_BEGIN(Trace::ServicesCallback, i, i);
+					ENERGY_BEGIN();
 					table->LocalStateChanged(table->Name, state->LocalChangedState);
+					ENERGY_END(true, i);
+					TRACE_END(Trace::ServicesCallback, i, i);
+					PROBE_EXIT(Probe::ServicesCallback);
+				}
 			}
 		}
 	}
@@ -4,6 +4,7 @@
  * @par Config
  * @code
 #define SERVICES_STATETYPE
+#define SERVICES_ENABLE_WORKERS 4	// host: threads of Services::EnableParallel (the caller is one of them)
  * @endcode
  * @par Linker script sections:
  * - Services table (ROM, FLASH)
@@ -16,18 +17,22 @@ SECTIONS
 	{
 		. = ALIGN(4);
 		PROVIDE(_Services_Table_Begin = .);
-		KEEP(*(.services .services.*))
+		KEEP(*(SORT_BY_NAME(.services.*)))
+		KEEP(*(.services))
 		PROVIDE(_Services_Table_End = .);
 	} >FLASH
 	.bss (NOLOAD) :
 	{
 		. = ALIGN(4);
 		PROVIDE(_Services_StatesTable_Begin = .);
-		KEEP(*(.services_states .services_states.*))
+		KEEP(*(SORT_BY_NAME(.services_states.*)))
+		KEEP(*(.services_states))
 		PROVIDE(_Services_StatesTable_End = .);
 	} >RAM
 }
  * @endcode
+ * Services table & states table must be sorted the same way: entry & state are paired by index.
+ * Host (Linux) build: sections are @c services & @c services_states (see Port/Port.h, Port/Host/Tables.ld).
  * @par Usage
  * Main .cpp file:
  * @code
@@ -35,6 +40,8 @@ SECTIONS
 int main(int argc, char* argv[])
 {
 	Services::Init();
+	Services::Enable(NULL); // topological order; host: Services::EnableParallel()
+	auto uS = Services::ReadyTime(); // boot-to-ready
 	for(;;)
 	{
 		Services::ProcessStates();
@@ -43,6 +50,8 @@ int main(int argc, char* argv[])
  * @endcode
  * Example service .h file:
  * @code
+#include "Services/Main.h"
+#include "Services/Storage.h"
 namespace Services
 {
 	namespace Example
@@ -50,9 +59,15 @@ namespace Services
 		enum class StateEnum { Start = 1, USB_Power = 2, S1_Pressed = 4 , S1_LongPressed = 8 };
 		enum class StateLocalEnum { S1 = 1 };
 		extern const char *ServiceName;
+		// dependencies: enabled before & disabled after this service; Main.h & Storage.h declare SERVICE_DEPENDS(Main) e.t.c.
+		SERVICE_DEPENDS(Example, Main, Storage)
 	}
 }
  * @endcode
+ * Dependencies define the level of service at compile time: 0 - no dependencies, else maximum level of dependencies + 1.
+ * Service of dependency must declare its level (@c SERVICE_DEPENDS(Main) without dependencies), so headers include
+ * each other in dependency order & a cycle is the compile error (level of dependency is not declared yet).
+ * @c Enable(NULL) enables services level by level (disables in reverse order): no dependency on link order & no retries.
  * Example service .cpp file:
  * @code
 #include "Services/IService.h"
@@ -85,6 +100,9 @@ namespace Services
 			stateBits = 0;
 		}
 		SERVICE_DECLARE(Example, &Enable, &StateChanged, &StateChangedBy, &LocalStateChanged)
+		// callback of hot path can be placed into RAM: SERVICE_STATE_CHANGED_HOT(StateChanged, PORT_RAMFUNC) { ... }
+		// or callbacks order: 00 - first; services without priority are the last
+		// SERVICE_DECLARE_PRIORITY(Example, 10, &Enable, &StateChanged, &StateChangedBy, &LocalStateChanged)
 	}
 }
 extern "C"
@@ -107,15 +125,39 @@ extern "C"
 
 #include <stddef.h>
 #include <stdint.h>
+#include "Port/Port.h"
+#include "Libs/LinkerTable.hpp"
+
+#define _SERVICE_CONCAT2(a, b) a##b
+#define _SERVICE_CONCAT(a, b) _SERVICE_CONCAT2(a, b)
+#define _SERVICE_NTH(_0, _1, _2, _3, _4, _5, _6, _7, _8, n, rest...) n
+#define _SERVICE_MAP(m, name, dependencies...) _SERVICE_CONCAT(_SERVICE_MAP_, _SERVICE_NTH(name, ##dependencies, 8, 7, 6, 5, 4, 3, 2, 1, 0))(m, name, ##dependencies)
+#define _SERVICE_MAP_0(m, name)
+#define _SERVICE_MAP_1(m, name, a) m(a)
+#define _SERVICE_MAP_2(m, name, a, b) m(a) m(b)
+#define _SERVICE_MAP_3(m, name, a, b, c) m(a) m(b) m(c)
+#define _SERVICE_MAP_4(m, name, a, b, c, d) m(a) m(b) m(c) m(d)
+#define _SERVICE_MAP_5(m, name, a, b, c, d, e) m(a) m(b) m(c) m(d) m(e)
+#define _SERVICE_MAP_6(m, name, a, b, c, d, e, f) m(a) m(b) m(c) m(d) m(e) m(f)
+#define _SERVICE_MAP_7(m, name, a, b, c, d, e, f, g) m(a) m(b) m(c) m(d) m(e) m(f) m(g)
+#define _SERVICE_MAP_8(m, name, a, b, c, d, e, f, g, h) m(a) m(b) m(c) m(d) m(e) m(f) m(g) m(h)
+#define _SERVICE_DEPENDENCY_LEVEL(dependency) dependency::Level + 1,
+#define _SERVICE_DEPENDENCY_NAME(dependency) &dependency::ServiceName,
 
 //! @addtogroup groupLinker
 //! @{
 extern "C"
 {
-	extern unsigned char _Services_Table_Begin; //!< ROM/Flash address, first byte of array
-	extern unsigned char _Services_Table_End; //!< ROM/Flash address, first byte after array
-	extern unsigned char _Services_StatesTable_Begin; //!< RAM address, first byte of array
-	extern unsigned char _Services_StatesTable_End; //!< RAM address, first byte after array
+#ifdef PORT_HOST
+#	define _Services_Table_Begin PORT_SECTION_BEGIN(services)
+#	define _Services_Table_End PORT_SECTION_END(services)
+#	define _Services_StatesTable_Begin PORT_SECTION_BEGIN(services_states)
+#	define _Services_StatesTable_End PORT_SECTION_END(services_states)
+#endif
+	extern unsigned char _Services_Table_Begin[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte of array
+	extern unsigned char _Services_Table_End[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte after array
+	extern unsigned char _Services_StatesTable_Begin[] PORT_LINKER_SYMBOL; //!< RAM address, first byte of array
+	extern unsigned char _Services_StatesTable_End[] PORT_LINKER_SYMBOL; //!< RAM address, first byte after array
 }
 //! @}
 
@@ -196,16 +238,60 @@ namespace Services
 		const StateChangedCallback StateChanged;
 		const StateChangedByCallback StateChangedBy;
 		const LocalStateChangedCallback LocalStateChanged;
+		const uint8_t Level; //!< Dependency level: 0 - no dependencies
+		const char *const *const *Dependencies; //!< Service names of dependencies: NULL terminated
 //		IServiceTableEntryStruct(const char *name, EnableCallback enableCallback, StateChangedCallback stateChanged, StateChangedByCallback stateChangedBy) :
 //			Name(name), Enable(enableCallback), StateChanged(stateChanged), StateChangedBy(stateChangedBy) {}
 	};
 
+	typedef System::LinkerTable<const IServiceTableEntryStruct, _Services_Table_Begin, _Services_Table_End> ServicesTable;
+	typedef System::LinkerTable<IServiceStateStruct, _Services_StatesTable_Begin, _Services_StatesTable_End> StatesTable;
+
+	//! Level & dependencies of service without @c SERVICE_DEPENDS
+	static constexpr uint8_t Level = 0;
+	static const char *const *const Dependencies[] = { NULL };
+
+	//! Maximum of levels
+	constexpr uint8_t DependencyLevel(uint8_t level) { return level; }
+	template<typename... T>
+	constexpr uint8_t DependencyLevel(uint8_t level, T... levels) { return level > DependencyLevel(levels...) ? level : DependencyLevel(levels...); }
+
 	//! Enables/disables the service
 	//! @param name		Service name. Usually Services::<service_name>::ServiceName. Can be NULL to action thru all services
 	//! @param enable	True - enable; false - disable
 	//! @return True - success; false - service not found or it can't be enabled/disabled
+	//! @note Service is enabled when its dependencies are enabled & disabled when its dependents are disabled.
+	//! All the services (NULL) are enabled in levels order, disabled in reverse order.
 	bool Enable(const char *name, bool enable = true);
 
+#ifdef PORT_HOST
+	//! Enables/disables all the services: services of one level (no mutual dependencies) by @c SERVICES_ENABLE_WORKERS
+	//! threads (the caller & pool threads started once); level of one service runs in the caller thread
+	//! @return True - success; false - some service can't be enabled/disabled
+	//! @note Enable callbacks of one level must be thread safe. Wakeup of workers costs tens of uS per level:
+	//! parallel enable pays off when enable callbacks block (I/O, device waits) longer than that, else use @c Enable(NULL)
+	//! (see BM_ServicesEnable). Separate object file (Services/IServiceParallel.cpp): threads are linked if it is called.
+	bool EnableParallel(bool enable = true);
+#endif
+
+	//! Internals shared by @c Enable & @c EnableParallel
+	namespace ServicesDetail
+	{
+		extern uint32_t ReadyCycles; //!< Duration of the last enable of all the services
+
+		//! Checks are dependencies enabled (enable) or dependents disabled (disable)
+		bool isReady(const IServiceTableEntryStruct *table, bool enable);
+
+		//! Maximum level of services
+		uint8_t maxLevel();
+
+		//! Level of services processing order: enable - ascending, disable - descending
+		inline uint8_t levelOf(unsigned int step, uint8_t max, bool enable) { return enable ? step : max - step; }
+	}
+
+	//! Boot-to-ready time: duration of the last enable of all the services, uS
+	uint32_t ReadyTime();
+
 	//! Checks is service enabled
 	//! @param name		Service name. Usually Services::<service_name>::ServiceName
 	//! @return True - enabled; false - service not enabled or it can't be found
@@ -243,13 +329,39 @@ namespace Services
 
 }  // namespace Services
 
+//! Declares dependencies of service: place it into service .h file after @c ServiceName declaration
+//! @param name				Service name: C identifier
+//! @param dependencies		Service names of dependencies (0..8): the services declare their dependencies (levels) before
+#define SERVICE_DEPENDS(name, dependencies...)\
+	static constexpr uint8_t Level = Services::DependencyLevel(_SERVICE_MAP(_SERVICE_DEPENDENCY_LEVEL, name, ##dependencies) 0);\
+	static const char *const *const Dependencies[] = { _SERVICE_MAP(_SERVICE_DEPENDENCY_NAME, name, ##dependencies) NULL };
+
 #define SERVICE_DECLARE(name, enableCallback, stateChangedCallback, stateChangedByCallback, localStateChangedCallback)\
-	const IServiceTableEntryStruct _ServiceTable_##name __attribute__((section(".services"),used)) {#name, enableCallback, stateChangedCallback, stateChangedByCallback, localStateChangedCallback};\
+	const IServiceTableEntryStruct _ServiceTable_##name PORT_TABLE_ENTRY(services, IServiceTableEntryStruct) {#name, enableCallback, stateChangedCallback, stateChangedByCallback, localStateChangedCallback, Level, Dependencies};\
 	const char *ServiceName = _ServiceTable_##name.Name;\
-	static IServiceStateStruct _ServiceState_##name __attribute__((section(".services_states"),used));
+	static IServiceStateStruct _ServiceState_##name PORT_TABLE_ENTRY(services_states, IServiceStateStruct);
+
+//! Declares service with callbacks order
+//! @param priority		Two digits: 00..99; 00 - first
+#define SERVICE_DECLARE_PRIORITY(name, priority, enableCallback, stateChangedCallback, stateChangedByCallback, localStateChangedCallback)\
+	const IServiceTableEntryStruct _ServiceTable_##name PORT_TABLE_ENTRY_PRIORITY(services, IServiceTableEntryStruct, priority) {#name, enableCallback, stateChangedCallback, stateChangedByCallback, localStateChangedCallback, Level, Dependencies};\
+	const char *ServiceName = _ServiceTable_##name.Name;\
+	static IServiceStateStruct _ServiceState_##name PORT_TABLE_ENTRY_PRIORITY(services_states, IServiceStateStruct, priority);
 
 #define SERVICE_STATE(name) _ServiceState_##name
 
+//! Callbacks of hot path: placed into code memory of RAM (the same as @c TIMER_CALLBACK_HOT)
+//! @param function		Callback name
+//! @param placement	PORT_RAMFUNC, PORT_ITCM or PORT_CCM (see Port/Port.h); PORT_HOT - with the framework hot paths
+#define SERVICE_STATE_CHANGED_HOT(function, placement)\
+	placement static void function(const char *name, Services::StateType stateBits, Services::StateType changedStateMask)
+
+#define SERVICE_STATE_CHANGED_BY_HOT(function, placement)\
+	placement static void function(const char *name, Services::StateType &stateBits, Services::StateType changedStateMask)
+
+#define SERVICE_LOCAL_STATE_CHANGED_HOT(function, placement)\
+	placement static void function(const char *name, Services::StateType &stateBits)
+
 //! @}
 
 #endif /* SRC_ISERVICE_H_ */
@@ -0,0 +1,153 @@
+/**
+ * Host: parallel enable of services by the pool of worker threads
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Separate object file of the library: images which don't call @c Services::EnableParallel don't link threads.
+ */
+
+#include "Services/IService.h"
+#include "Libs/Trace.hpp"
+#include "Libs/Profile.hpp"
+
+#ifdef PORT_HOST
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef SERVICES_ENABLE_WORKERS
+#	define SERVICES_ENABLE_WORKERS 4
+#endif
+
+namespace Services
+{
+	static_assert(SERVICES_ENABLE_WORKERS >= 1, "Services: SERVICES_ENABLE_WORKERS must be 1..");
+
+	//! Workers of enable callbacks: threads are started by the first parallel level & live until exit
+	class EnableWorkersClass
+	{
+	protected:
+		std::mutex m_Mutex;
+		std::condition_variable m_Start;
+		std::condition_variable m_Done;
+		std::vector<std::thread> m_Threads;
+		uint32_t m_Round;	//!< Round of level: workers wait for the next one
+		uint32_t m_Busy;	//!< Workers of the current round
+		bool m_Stop;
+
+		const std::vector<unsigned int> *m_Services;	//!< Services of level: indexes of table
+		std::vector<char> *m_Success;
+		bool m_Enable;
+		std::atomic<unsigned int> m_Next;	//!< Next service of level
+
+		//! Calls enable callbacks of level services until none is left
+		void run()
+		{
+			for(unsigned int n; (n = m_Next.fetch_add(1)) < m_Services->size();)
+			{
+				auto table = &ServicesTable::At((*m_Services)[n]);
+				(*m_Success)[n] = table->Enable(table->Name, m_Enable);
+			}
+		}
+
+		void worker()
+		{
+			uint32_t round = 0;
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			for(;;)
+			{
+				m_Start.wait(lock, [this, round]() { return m_Stop || m_Round != round; });
+				if(m_Stop)
+					return;
+				round = m_Round;
+				lock.unlock();
+				run();
+				lock.lock();
+				if(--m_Busy == 0)
+					m_Done.notify_one();
+			}
+		}
+
+	public:
+		EnableWorkersClass() : m_Round(0), m_Busy(0), m_Stop(false), m_Services(NULL), m_Success(NULL), m_Enable(false), m_Next(0) {}
+
+		~EnableWorkersClass()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_Stop = true;
+			}
+			m_Start.notify_all();
+			for(auto &thread : m_Threads)
+				thread.join();
+		}
+
+		//! Calls enable callbacks of services by the caller & the workers
+		void Run(const std::vector<unsigned int> &services, std::vector<char> &success, bool enable)
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			while(m_Threads.size() < SERVICES_ENABLE_WORKERS - 1)
+				m_Threads.emplace_back(&EnableWorkersClass::worker, this);
+			m_Services = &services;
+			m_Success = &success;
+			m_Enable = enable;
+			m_Next = 0;
+			m_Busy = m_Threads.size();
+			m_Round++;
+			lock.unlock();
+			m_Start.notify_all();
+			run();
+			lock.lock();
+			m_Done.wait(lock, [this]() { return m_Busy == 0; });
+		}
+	};
+
+	bool EnableParallel(bool enable)
+	{
+		static EnableWorkersClass workers;
+		auto start = Profile::Cycles();
+		auto max = ServicesDetail::maxLevel();
+		auto result = true;
+		std::vector<unsigned int> services;
+		std::vector<char> success;
+		for(unsigned int step = 0; step <= max; step++)
+		{
+			auto level = ServicesDetail::levelOf(step, max, enable);
+			// services of the level: callbacks in parallel, states are changed after all the callbacks
+			services.clear();
+			for(unsigned int i = 0; i < ServicesTable::size(); i++)
+			{
+				auto table = &ServicesTable::At(i);
+				if(table->Level != level || table->Enable == NULL || StatesTable::At(i).Enabled == enable)
+					continue;
+				if(ServicesDetail::isReady(table, enable))
+					services.push_back(i);
+				else
+					result = false;
+			}
+			success.assign(services.size(), 0);
+			if(services.size() == 1)
+			{
+				auto table = &ServicesTable::At(services[0]);
+				success[0] = table->Enable(table->Name, enable);
+			}
+			else if(services.size() > 1)
+				workers.Run(services, success, enable);
+			for(unsigned int n = 0; n < services.size(); n++)
+				if(success[n])
+				{
+					StatesTable::At(services[n]).Enabled = enable;
+					TRACE_EVENT(Trace::ServicesEnable, services[n], enable);
+				}
+				else
+					result = false;
+		}
+		if(enable)
+			ServicesDetail::ReadyCycles = Profile::Cycles() - start;
+		return result;
+	}
+}
+#endif
@@ -0,0 +1,169 @@
+/**
+ * Low-power timer domain: timers clocked by LPTIM, running in STOP mode
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include "Services/LpTimer.h"
+#include "Libs/Probe.hpp"
+#include "Libs/Trace.hpp"
+#include "stm32l0xx.h"
+#include <string.h>
+
+namespace LpTimer
+{
+	static volatile uint32_t Overflows;	//!< Counter overflows: high part of extended counter
+	static uint64_t Suspended;			//!< Ticks at @c Suspend
+	static uint32_t Offset;				//!< SystemTime at Init: SystemTime of the domain time
+	static uint32_t Compare;			//!< Value of CMP register; > 0xFFFF - not written
+
+	void Init()
+	{
+		memset(StatesTable::begin(), 0, StatesTable::size() * sizeof(Timer::TimerStateStruct));
+		Overflows = 0;
+		Offset = SystemTime;
+		Compare = UINT32_MAX;
+		LPTIM1->CR = 0;
+		LPTIM1->CFGR = (uint32_t)LPTIMER_PRESCALER << LPTIM_CFGR_PRESC_Pos;
+		LPTIM1->IER = LPTIM_IER_ARRMIE | LPTIM_IER_CMPMIE; // IER & CFGR are written while LPTIM is disabled
+		LPTIM1->CR = LPTIM_CR_ENABLE;
+		LPTIM1->ARR = 0xFFFF;
+		LPTIM1->CNT = 0; // host: counter of the port memory; target: counter is cleared by reset & read only
+		LPTIM1->CR = LPTIM_CR_ENABLE | LPTIM_CR_CNTSTRT;
+	}
+
+	uint64_t Ticks()
+	{
+		uint32_t overflows, counter, pending;
+		do
+		{
+			overflows = Overflows;
+			// counter of asynchronous clock: two equal reads
+			do
+				counter = LPTIM1->CNT & 0xFFFF;
+			while(counter != (LPTIM1->CNT & 0xFFFF));
+			pending = LPTIM1->ISR & LPTIM_ISR_ARRM;
+		}
+		while(overflows != Overflows);
+		// overflow interrupt is raised by ARR match: the last tick of the period
+		if(counter == 0xFFFF)
+		{
+			if(!pending)
+				overflows--; // overflow of the period is counted already
+		}
+		else if(pending && counter < 0x8000)
+			overflows++; // interrupt is pending: caller masks interrupts or runs at higher priority
+		return (uint64_t)overflows << 16 | counter;
+	}
+
+	uint32_t Now()
+	{
+		return (uint32_t)(Ticks() * 1000 / Frequency);
+	}
+
+	void Start(uint32_t interval, Timer::TimerStateStruct *state, bool restart)
+	{
+		if(state != NULL && (restart || !state->Enabled))
+		{
+			state->Interval = interval;
+			state->TimeStamp = Now() + interval;
+			state->Enabled = true;
+		}
+	}
+
+	PORT_HOT void Tick()
+	{
+		auto now = Now();
+		for(auto &table : TimersTable())
+		{
+			auto state = table.State;
+			if(state->Enabled && (int32_t)(state->TimeStamp - now) <= 0)
+			{
+				state->TimeStamp = now + state->Interval;
+				PROBE_ENTER(Probe::TimerCallback);
+				TRACE_BEGIN(Trace::LpTimerCallback, TimersTable::IndexOf(&table));
+				table.Callback();
+				TRACE_END(Trace::LpTimerCallback, TimersTable::IndexOf(&table));
+				PROBE_EXIT(Probe::TimerCallback);
+			}
+		}
+	}
+
+	//! Nearest deadline of timers, mS from now
+	static uint32_t nearest(const Timer::TimerStateStruct *begin, const Timer::TimerStateStruct *end, uint32_t now, uint32_t delay)
+	{
+		for(auto state = begin; state < end; state++)
+			if(state->Enabled)
+			{
+				auto left = (int32_t)(state->TimeStamp - now);
+				if(left <= 0)
+					return 0;
+				if((uint32_t)left < delay)
+					delay = left;
+			}
+		return delay;
+	}
+
+	uint32_t Next()
+	{
+		auto delay = nearest(StatesTable::begin(), StatesTable::end(), Now(), UINT32_MAX);
+		delay = nearest(Timer::StatesTable::begin(), Timer::StatesTable::end(), SystemTime, delay);
+		// ISR class timers: SysTick is stopped in STOP mode too
+		for(auto &state : Timer::IsrStatesTable())
+			if(state.Enabled)
+			{
+				auto left = (int32_t)(state.TimeStamp - SystemTime);
+				if(left <= 0)
+					return 0;
+				if((uint32_t)left < delay)
+					delay = left;
+			}
+		return delay;
+	}
+
+	bool Suspend()
+	{
+		auto delay = Next();
+		if(delay == 0)
+			return false;
+		Suspended = Ticks();
+		uint64_t ticks = ((uint64_t)delay * Frequency + 999) / 1000;
+		// compare match wakes at deadline; far deadline: overflow wakes first, compare just before the same counter value
+		uint32_t compare = (uint32_t)(Suspended + (ticks < 0xFFFF ? ticks : 0xFFFF)) & 0xFFFF;
+		if(compare != Compare)
+		{
+#ifndef PORT_HOST
+			// CMP is written by LPTIM clock: previous write is completed
+			if(Compare <= 0xFFFF)
+				while(!(LPTIM1->ISR & LPTIM_ISR_CMPOK)) {}
+#endif
+			LPTIM1->ICR = LPTIM_ICR_CMPOKCF;
+			LPTIM1->CMP = compare;
+			Compare = compare;
+		}
+		LPTIM1->ICR = LPTIM_ICR_CMPMCF;
+		return true;
+	}
+
+	uint32_t Resume()
+	{
+		auto ticks = Ticks();
+		// SysTick is stopped: SystemTime of the domain time, not the sum of stop periods - rounding errors don't accumulate
+		auto time = (uint32_t)(ticks * 1000 / Frequency) + Offset;
+		if((int32_t)(time - SystemTime) > 0)
+			SystemTime = time;
+		return (uint32_t)((ticks - Suspended) * 1000000 / Frequency);
+	}
+}
+
+extern "C"
+{
+	void LPTIM1_IRQHandler()
+	{
+		auto isr = LPTIM1->ISR;
+		if(isr & LPTIM_ISR_ARRM)
+			LpTimer::Overflows = LpTimer::Overflows + 1;
+		LPTIM1->ICR = isr & (LPTIM_ISR_ARRM | LPTIM_ISR_CMPM); // compare: wakeup only
+	}
+}
@@ -0,0 +1,154 @@
+/**
+ * Low-power timer domain: timers clocked by LPTIM, running in STOP mode
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note SysTick (@c SystemTime) stops in STOP mode, so timers of Services/Timer.h keep the device in SLEEP mode.
+ * Timers of this domain are clocked by LPTIM1 (LSE) which runs in STOP mode: 16-bit counter is extended by
+ * overflow interrupt, time is mS of the counter (@c LpTimer::Now). Timers are collected by linker into own tables
+ * (@c .lptimers, @c .lptimers_states) & processed by own @c Tick.
+ * @c Suspend before STOP programs LPTIM compare to the nearest deadline of both domains (LP timers & mS timers),
+ * so the device wakes only for due deadlines (or counter overflow: period 65536 ticks). @c Resume after wakeup sets
+ * @c SystemTime by the domain time (never backwards): mS timers stay accurate, rounding of stop periods doesn't accumulate.
+ * Resolution is one counter tick (@c LPTIMER_FREQUENCY).
+ * Host: LPTIM registers are the memory of the port (Port/Host/stm32l0xx.h); simulation drives the counter (Simulation/LpTim.hpp).
+ */
+
+/**
+ * @page LpTimer
+ * @par Config
+ * @code
+#define LPTIMER_FREQUENCY 1024		// counter clock, Hz: LSE 32768 Hz / prescaler
+#define LPTIMER_PRESCALER 5			// LPTIM prescaler: 32768 >> 5 = 1024 Hz
+ * @endcode
+ * @par Linker script sections:
+ * - Timers table (ROM, FLASH)
+ * - Timers states table (RAM)
+ * @code
+SECTIONS
+{
+	.lptimers :
+	{
+		. = ALIGN(4);
+		PROVIDE(_LpTimers_Table_Begin = .);
+		KEEP(*(.lptimers .lptimers.*))
+		PROVIDE(_LpTimers_Table_End = .);
+	} >FLASH
+	.bss (NOLOAD) :
+	{
+		. = ALIGN(4);
+		PROVIDE(_LpTimers_StatesTable_Begin = .);
+		KEEP(*(.lptimers_states .lptimers_states.*))
+		PROVIDE(_LpTimers_StatesTable_End = .);
+	} >RAM
+}
+ * @endcode
+ * @par Usage
+ * @code
+#include "Services/LpTimer.h"
+
+LPTIMER_DECLARE(Sample)
+TIMER_CALLBACK(Sample) // callback & state macros of Services/Timer.h
+{
+}
+
+int main()
+{
+	Timer::Init();
+	LpTimer::Init(); // LSE & LPTIM1 clock are enabled by RCC
+	LpTimer::Start(10000, TIMER_STATE(Sample));
+	for(;;)
+	{
+		Timer::Tick();
+		LpTimer::Tick();
+		Services::ProcessStates();
+		if(LpTimer::Suspend())
+		{
+			Energy::Enter(Energy::ModeEnum::Stop);
+			HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+			Energy::Exit(LpTimer::Resume());
+		}
+	}
+}
+ * @endcode
+ */
+
+#ifndef SRC_LPTIMER_H_
+#define SRC_LPTIMER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Port/Port.h"
+#include "Libs/LinkerTable.hpp"
+#include "Services/Timer.h"
+
+#ifndef LPTIMER_FREQUENCY
+#	define LPTIMER_FREQUENCY 1024
+#	define LPTIMER_PRESCALER 5
+#endif
+
+//! Declares timer of low-power domain: callback is @c TIMER_CALLBACK(name), state is @c TIMER_STATE(name)
+#define LPTIMER_DECLARE(name)\
+	static void _Timer_##name();\
+	static Timer::TimerStateStruct _TimerState_##name PORT_TABLE_ENTRY(lptimers_states, Timer::TimerStateStruct);\
+	static const Timer::TimerTableStruct PORT_TABLE_ENTRY(lptimers, Timer::TimerTableStruct) _LpTimerTable_##name = { &_TimerState_##name, &_Timer_##name };
+
+extern "C"
+{
+#ifdef PORT_HOST
+#	define _LpTimers_Table_Begin PORT_SECTION_BEGIN(lptimers)
+#	define _LpTimers_Table_End PORT_SECTION_END(lptimers)
+#	define _LpTimers_StatesTable_Begin PORT_SECTION_BEGIN(lptimers_states)
+#	define _LpTimers_StatesTable_End PORT_SECTION_END(lptimers_states)
+#endif
+	extern unsigned char _LpTimers_Table_Begin[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte of array
+	extern unsigned char _LpTimers_Table_End[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte after array
+	extern unsigned char _LpTimers_StatesTable_Begin[] PORT_LINKER_SYMBOL; //!< RAM address, first byte of array
+	extern unsigned char _LpTimers_StatesTable_End[] PORT_LINKER_SYMBOL; //!< RAM address, first byte after array
+
+	//! LPTIM1 interrupt: counter overflow & compare (wakeup)
+	void LPTIM1_IRQHandler();
+}
+
+namespace LpTimer
+{
+	static const uint32_t Frequency = LPTIMER_FREQUENCY;	//!< Counter clock, Hz
+
+	typedef System::LinkerTable<const Timer::TimerTableStruct, _LpTimers_Table_Begin, _LpTimers_Table_End> TimersTable;
+	typedef System::LinkerTable<Timer::TimerStateStruct, _LpTimers_StatesTable_Begin, _LpTimers_StatesTable_End> StatesTable;
+
+	//! Clears timers, starts LPTIM1: free running counter with overflow interrupt
+	void Init();
+
+	//! Extended counter: ticks since @c Init
+	uint64_t Ticks();
+
+	//! Time of the domain, mS
+	uint32_t Now();
+
+	//! Starts timer
+	//! @param interval		Interval, mS: 0..
+	//! @param state		Timer state struct: @b TIMER_STATE(@a<TimerName>)
+	//! @param restart		True - restart from now; false - don't restart if timer is enabled
+	void Start(uint32_t interval, Timer::TimerStateStruct *state, bool restart = false);
+
+	//! Ends timer: @c Timer::Stop, @c Timer::isStarted, @c Timer::Interval work with timers of the domain too
+	inline void Stop(Timer::TimerStateStruct *state) { Timer::Stop(state); }
+
+	//! Processes timers table: call from the message loop
+	void Tick();
+
+	//! Delay of the nearest deadline of both domains (mS timers of both classes), mS; UINT32_MAX - no timers are running
+	uint32_t Next();
+
+	//! Programs wakeup at the nearest deadline: call before STOP mode
+	//! @return False - deadline is due, don't enter STOP mode
+	bool Suspend();
+
+	//! Corrects @c SystemTime by time of STOP mode: call after wakeup from STOP mode only
+	//! @return Time since @c Suspend, uS (@see Energy::Exit)
+	uint32_t Resume();
+}
+
+#endif /* SRC_LPTIMER_H_ */
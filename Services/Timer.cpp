@@ -1,12 +1,21 @@
 
 #include "Services/Timer.h"
+#include "Libs/Probe.hpp"
+#include "Libs/Trace.hpp"
+#include "Services/Energy.h"
 #include <cstring>
 
 namespace Timer
 {
+	static volatile uint32_t IsrNext;	//!< Nearest time stamp of ISR class timers
+	static volatile bool IsrRescan;		//!< ISR class timer is started: nearest time stamp is changed
+
 	void Init()
 	{
-		memset(&_Timers_StatesTable_Begin, 0, &_Timers_StatesTable_End - &_Timers_StatesTable_Begin);
+		memset(StatesTable::begin(), 0, StatesTable::size() * sizeof(TimerStateStruct));
+		memset((void*)IsrStatesTable::begin(), 0, IsrStatesTable::size() * sizeof(IsrTimerStateStruct));
+		IsrNext = SystemTime;
+		IsrRescan = false;
 	}
 
 	void Start(uint interval, TimerStateStruct *state, bool restart)
@@ -19,16 +28,75 @@ namespace Timer
 		}
 	}
 
-	void Tick()
+	void Start(uint interval, IsrTimerStateStruct *state, bool restart)
 	{
-		for(auto table = (TimerTableStruct*)&_Timers_Table_Begin; table < (TimerTableStruct*)&_Timers_Table_End; table++)
+		if(state != NULL && (restart || !state->Enabled))
 		{
-			auto state = table->State;
-			if(state->Enabled && state->TimeStamp <= SystemTime)
-			{
+			// SysTick interrupt sees disabled timer or complete state
+			state->Enabled = false;
+			__atomic_signal_fence(__ATOMIC_SEQ_CST);
+			state->Interval = interval == 0 ? 1 : interval;
+			state->TimeStamp = SystemTime + state->Interval;
+			__atomic_signal_fence(__ATOMIC_SEQ_CST);
+			state->Enabled = true;
+			IsrRescan = true;
+		}
+	}
+
+	PORT_HOT void Tick()
+	{
+		PROBE_SCOPE(Probe::TimerTick);
+		for(auto &table : TimersTable())
+		{
+			auto state = table.State;
+			auto due = state->Enabled && state->TimeStamp <= SystemTime;
+			// deferred by ISR class callback: taken by exchange, so defer of ISR preempting the tick isn't lost
+			auto deferred = state->Deferred != 0 && System::Atomic::Exchange(&state->Deferred, 0) != 0;
+			if(due)
 				state->TimeStamp = SystemTime + state->Interval;
-				table->Callback();
+			if(due || deferred)
+			{
+				PROBE_ENTER(Probe::TimerCallback);
+				TRACE_BEGIN(Trace::TimerCallback, TimersTable::IndexOf(&table));
+				ENERGY_BEGIN();
+				table.Callback();
+				ENERGY_END(false, TimersTable::IndexOf(&table));
+				TRACE_END(Trace::TimerCallback, TimersTable::IndexOf(&table));
+				PROBE_EXIT(Probe::TimerCallback);
+			}
+		}
+	}
+
+	PORT_HOT void IsrTick()
+	{
+		auto now = SystemTime;
+		if(!IsrRescan && (int32_t)(IsrNext - now) > 0)
+			return;
+		IsrRescan = false;
+		auto next = now + INT32_MAX;
+		for(auto &table : IsrTimersTable())
+		{
+			auto state = table.State;
+			if(!state->Enabled)
+				continue;
+			if((int32_t)(state->TimeStamp - now) <= 0)
+			{
+				// period of time stamps: interrupt of each tick doesn't drift
+				state->TimeStamp = state->TimeStamp + state->Interval;
+				if((int32_t)(state->TimeStamp - now) <= 0)
+					state->TimeStamp = now + state->Interval;
+				IsrContextClass context(state);
+				PROBE_ENTER(Probe::TimerIsrCallback);
+				TRACE_BEGIN(Trace::TimerIsrCallback, IsrTimersTable::IndexOf(&table));
+				table.Callback(context);
+				TRACE_END(Trace::TimerIsrCallback, IsrTimersTable::IndexOf(&table));
+				PROBE_EXIT(Probe::TimerIsrCallback);
+				if(!state->Enabled)
+					continue;
 			}
+			if((int32_t)(state->TimeStamp - next) < 0)
+				next = state->TimeStamp;
 		}
+		IsrNext = next;
 	}
 }
@@ -20,7 +20,8 @@ SECTIONS
 	{
 		. = ALIGN(4);
 		PROVIDE(_Timers_Table_Begin = .);
-		KEEP(*(.timers .timers.*))
+		KEEP(*(SORT_BY_NAME(.timers.*)))
+		KEEP(*(.timers))
 		PROVIDE(_Timers_Table_End = .);
 	} >FLASH
 	.bss (NOLOAD) :
@@ -32,6 +33,9 @@ SECTIONS
 	} >RAM
 }
  * @endcode
+ * Host (Linux) build: sections are @c timers & @c timers_states (see Port/Port.h, Port/Host/Tables.ld).
+ * ISR class timers (@c TIMER_ISR_DECLARE): callbacks run from SysTick interrupt (@c Timer::IsrTick), tables are
+ * @c .timers_isr (FLASH) & @c .timers_isr_states (RAM) of the same layout as above.
  * @par Usage
  * Main .cpp file:
  * @code
@@ -49,6 +53,7 @@ int main(int argc, char* argv[])
  * @code
 #include "Services/Timer.h"
 TIMER_DECLARE(ExampleTimer)
+TIMER_DECLARE_PRIORITY(WatchdogTimer, 00) // callbacks order of the same tick: 00 - first; timers without priority are the last
 void some_function()
 {
 	auto timestamp = Timer::Now(); // system time, mS
@@ -60,6 +65,24 @@ void some_function()
 TIMER_CALLBACK(ExampleTimer)
 {
 	Timer::Stop(TIMER_STATE(ExampleTimer));
+}
+TIMER_CALLBACK_HOT(WatchdogTimer, PORT_RAMFUNC) // callback in RAM regardless of PORT_HOT_SECTION (see Port/Port.h)
+{
+}
+ * @endcode
+ * ISR class: latency doesn't depend on the message loop; callback gets interrupt context only
+ * @code
+TIMER_ISR_DECLARE(Adc)
+TIMER_ISR_CALLBACK(Adc) // SysTick interrupt: short, no blocking calls, no deferred timers API
+{
+	ADC1->CR |= ADC_CR_ADSTART;
+	context.Defer(TIMER_STATE(ExampleTimer)); // the rest of work: callback of ExampleTimer at the next Timer::Tick
+}
+Timer::Start(10, TIMER_ISR_STATE(Adc));
+void SysTick_Handler()
+{
+	SystemTime++;
+	Timer::IsrTick();
 }
  * @endcode
  */
@@ -67,29 +90,74 @@ TIMER_CALLBACK(ExampleTimer)
 #ifndef SRC_TIMER_H_
 #define SRC_TIMER_H_
 
+#include <stdint.h>
+#include <stddef.h>
 #include <sys/types.h>
+#include "Port/Port.h"
+#include "Libs/LinkerTable.hpp"
+#include "Libs/Atomic.hpp"
 
 #define TIMER_DECLARE(name)\
 	static void _Timer_##name();\
-	static Timer::TimerStateStruct _TimerState_##name __attribute__((section(".timers_states"),used));\
-	static const Timer::TimerTableStruct __attribute__((section(".timers"),used)) _TimerTable_##name = { &_TimerState_##name, &_Timer_##name }; \
+	static Timer::TimerStateStruct _TimerState_##name PORT_TABLE_ENTRY(timers_states, Timer::TimerStateStruct);\
+	static const Timer::TimerTableStruct PORT_TABLE_ENTRY(timers, Timer::TimerTableStruct) _TimerTable_##name = { &_TimerState_##name, &_Timer_##name }; \
+
+//! Declares timer with callbacks order
+//! @param priority		Two digits: 00..99; 00 - first
+#define TIMER_DECLARE_PRIORITY(name, priority)\
+	static void _Timer_##name();\
+	static Timer::TimerStateStruct _TimerState_##name PORT_TABLE_ENTRY(timers_states, Timer::TimerStateStruct);\
+	static const Timer::TimerTableStruct PORT_TABLE_ENTRY_PRIORITY(timers, Timer::TimerTableStruct, priority) _TimerTable_##name = { &_TimerState_##name, &_Timer_##name }; \
 
 #define TIMER_CALLBACK(name)\
 	static void _Timer_##name()
 
+//! Timer callback of hot path: placed into code memory of RAM
+//! @param placement	PORT_RAMFUNC, PORT_ITCM or PORT_CCM (see Port/Port.h); PORT_HOT - with the framework hot paths
+#define TIMER_CALLBACK_HOT(name, placement)\
+	placement static void _Timer_##name()
+
 #define TIMER_CALLBACK_CALL(name)\
 	_Timer_##name()
 
 #define TIMER_STATE(name) &_TimerState_##name
 
+//! Declares timer of ISR class: callback runs from SysTick interrupt (@c Timer::IsrTick), not from the message loop
+#define TIMER_ISR_DECLARE(name)\
+	static void _TimerIsr_##name(Timer::IsrContextClass &context);\
+	static Timer::IsrTimerStateStruct _TimerIsrState_##name PORT_TABLE_ENTRY(timers_isr_states, Timer::IsrTimerStateStruct);\
+	static const Timer::IsrTimerTableStruct PORT_TABLE_ENTRY(timers_isr, Timer::IsrTimerTableStruct) _TimerIsrTable_##name = { &_TimerIsrState_##name, &_TimerIsr_##name };
+
+//! Callback of ISR class timer: hot path, interrupt context is @c context
+#define TIMER_ISR_CALLBACK(name)\
+	PORT_HOT static void _TimerIsr_##name(__attribute__((unused)) Timer::IsrContextClass &context)
+
+#define TIMER_ISR_STATE(name) &_TimerIsrState_##name
+
 extern "C"
 {
 //! @addtogroup groupLinker
 //! @{
-	extern unsigned char _Timers_Table_Begin; //!< ROM/Flash address, first byte of array
-	extern unsigned char _Timers_Table_End; //!< ROM/Flash address, first byte after array
-	extern unsigned char _Timers_StatesTable_Begin; //!< RAM address, first byte of array
-	extern unsigned char _Timers_StatesTable_End; //!< RAM address, first byte after array
+#ifdef PORT_HOST
+#	define _Timers_Table_Begin PORT_SECTION_BEGIN(timers)
+#	define _Timers_Table_End PORT_SECTION_END(timers)
+#	define _Timers_StatesTable_Begin PORT_SECTION_BEGIN(timers_states)
+#	define _Timers_StatesTable_End PORT_SECTION_END(timers_states)
+#endif
+	extern unsigned char _Timers_Table_Begin[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte of array
+	extern unsigned char _Timers_Table_End[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte after array
+	extern unsigned char _Timers_StatesTable_Begin[] PORT_LINKER_SYMBOL; //!< RAM address, first byte of array
+	extern unsigned char _Timers_StatesTable_End[] PORT_LINKER_SYMBOL; //!< RAM address, first byte after array
+#ifdef PORT_HOST
+#	define _Timers_IsrTable_Begin PORT_SECTION_BEGIN(timers_isr)
+#	define _Timers_IsrTable_End PORT_SECTION_END(timers_isr)
+#	define _Timers_IsrStatesTable_Begin PORT_SECTION_BEGIN(timers_isr_states)
+#	define _Timers_IsrStatesTable_End PORT_SECTION_END(timers_isr_states)
+#endif
+	extern unsigned char _Timers_IsrTable_Begin[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte of array
+	extern unsigned char _Timers_IsrTable_End[] PORT_LINKER_SYMBOL; //!< ROM/Flash address, first byte after array
+	extern unsigned char _Timers_IsrStatesTable_Begin[] PORT_LINKER_SYMBOL; //!< RAM address, first byte of array
+	extern unsigned char _Timers_IsrStatesTable_End[] PORT_LINKER_SYMBOL; //!< RAM address, first byte after array
 //! @}
 //! @defgroup groupTimer Timer
 //! @{
@@ -106,6 +174,7 @@ namespace Timer
 		uint32_t Interval;   //!< Callback interval, mS
 		uint32_t TimeStamp;  //!< Time of next callback
 		bool Enabled;        //!< True - timer is enabled to produce callback; false - timer is disabled
+		volatile uint8_t Deferred; //!< 1 - one callback at the next tick: set by ISR class callback, taken by @c Tick
 	};
 
 	struct TimerTableStruct
@@ -114,19 +183,86 @@ namespace Timer
 		TimerCallback Callback;
 	};
 
+	typedef System::LinkerTable<const TimerTableStruct, _Timers_Table_Begin, _Timers_Table_End> TimersTable;
+	typedef System::LinkerTable<TimerStateStruct, _Timers_StatesTable_Begin, _Timers_StatesTable_End> StatesTable;
+
+	//! State of ISR class timer: shared by interrupt & message loop
+	//! @note Own type: deferred timers API doesn't take it & vice versa
+	struct IsrTimerStateStruct
+	{
+		volatile uint32_t Interval;		//!< Callback interval, mS: 1..
+		volatile uint32_t TimeStamp;	//!< Time of next callback
+		volatile bool Enabled;			//!< True - timer is enabled to produce callback; false - timer is disabled
+	};
+
+	//! Interrupt context of ISR class callback: operations allowed in interrupt
+	class IsrContextClass
+	{
+		IsrTimerStateStruct *m_State;
+
+	public:
+		inline IsrContextClass(IsrTimerStateStruct *state) : m_State(state) {}
+
+		//! Time of interrupt, mS
+		inline uint32_t Now() const { return SystemTime; }
+
+		//! Ends the timer: one shot callback
+		inline void Stop() { m_State->Enabled = false; }
+
+		//! Next callback after interval from now
+		//! @param interval		Interval, mS: 1..; 0 - 1 mS
+		inline void Restart(uint32_t interval)
+		{
+			m_State->Interval = interval == 0 ? 1 : interval;
+			m_State->TimeStamp = SystemTime + m_State->Interval;
+		}
+
+		//! Passes the rest of work to the message loop: one callback of deferred timer at the next @c Timer::Tick
+		//! @param state		Timer state struct: @b TIMER_STATE(@a<TimerName>); interval & enabled state are not changed
+		//! @note Defers of the same tick are one callback; callback of due running timer at the same tick is the same one
+		inline void Defer(TimerStateStruct *state)
+		{
+			state->Deferred = 1;
+		}
+	};
+
+	typedef void (*IsrTimerCallback)(IsrContextClass &context);
+
+	struct IsrTimerTableStruct
+	{
+		IsrTimerStateStruct* State;
+		IsrTimerCallback Callback;
+	};
+
+	typedef System::LinkerTable<const IsrTimerTableStruct, _Timers_IsrTable_Begin, _Timers_IsrTable_End> IsrTimersTable;
+	typedef System::LinkerTable<IsrTimerStateStruct, _Timers_IsrStatesTable_Begin, _Timers_IsrStatesTable_End> IsrStatesTable;
+
 	//! Starts timer
 	//! @param interval		Interval, mS: 0..
 	//! @param state		Timer state struct: @b TIMER_STATE(@a<TimerName>)
 	//! @param restart		True - restart from now; false - don't restart if timer is enabled
 	void Start(uint interval, TimerStateStruct *state, bool restart = false);
 
+	//! Starts timer of ISR class: call from the message loop or from ISR class callback
+	//! @param interval		Interval, mS: 1..; 0 - 1 mS (callback of each SysTick)
+	//! @param state		Timer state struct: @b TIMER_ISR_STATE(@a<TimerName>)
+	//! @param restart		True - restart from now; false - don't restart if timer is enabled
+	void Start(uint interval, IsrTimerStateStruct *state, bool restart = false);
+
 	//! Ends timer
 	//! @param state		Timer state struct: @b TIMER_STATE(@a<TimerName>)
 	inline void Stop(TimerStateStruct *state) { if(state != NULL) state->Enabled = false; }
 
+	//! Ends timer of ISR class
+	//! @param state		Timer state struct: @b TIMER_ISR_STATE(@a<TimerName>)
+	inline void Stop(IsrTimerStateStruct *state) { if(state != NULL) state->Enabled = false; }
+
 	//! @param state		Timer state struct: @b TIMER_STATE(@a<TimerName>)
 	inline bool isStarted(TimerStateStruct *state) { return state->Enabled; }
 
+	//! @param state		Timer state struct: @b TIMER_ISR_STATE(@a<TimerName>)
+	inline bool isStarted(IsrTimerStateStruct *state) { return state->Enabled; }
+
 	//! @param state		Timer state struct: @b TIMER_STATE(@a<TimerName>)
 	inline decltype(TimerStateStruct::Interval) Interval(TimerStateStruct *state) { return state->Interval; }
 
@@ -137,6 +273,10 @@ namespace Timer
 	//! @note Timers callback notification function. Call this usually from the message loop
 	void Tick();
 
+	//! Process ISR class timers table: call from SysTick interrupt after the system time increment
+	//! @note Nearest time stamp is cached: interrupt without due timers doesn't scan the table
+	void IsrTick();
+
 	void Init();
 
 } /* namespace Timer */
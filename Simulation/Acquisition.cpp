@@ -0,0 +1,125 @@
+/**
+ * Simulation of acquisition device: 4 channels of 25 kHz (100 kHz of samples) by TIM6-triggered ADC & DMA ring
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Meter service decimates each block of Services/Acquisition.h by 25 (1 kHz of each channel, Libs/Dsp.hpp).
+ * Input of channel is the constant level of channel with +-7 alternating noise of frames: decimated values are the levels.
+ * CPU load is the host time of block processing (Libs/Profile.hpp) of the simulated time; interrupts per second are
+ * compared with the conversion interrupt of each frame. The second run has the late consumer (message loop work of
+ * 2.5 block periods every 10th block): overruns are counted & late blocks are invalid.
+ * Expected behaviour is checked after the runs: exit code 1 - regression.
+ * Usage: CortexM_AcquisitionExample [seconds]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Services/Acquisition.h"
+#include "Libs/Dsp.hpp"
+#include "Libs/Profile.hpp"
+#include "Simulation/Simulation.hpp"
+#include "Simulation/Adc.hpp"
+
+static const uint32_t Factor = 25;			//!< Decimation factor
+static const uint32_t LateEvery = 10;		//!< Blocks of late consumer run: one late block of
+
+static Simulation::SimulationClass Sim;
+static uint32_t Late;						//!< Blocks of late work; 0 - consumer is in time
+static uint32_t Blocks, Errors, Mismatches, Invalid;
+static uint64_t ProcessCycles;
+
+//! Level of channel
+static inline uint16_t level(uint32_t channel) { return (uint16_t)(1000 + channel * 500); }
+
+static Simulation::AdcClass Adc(&Sim, [](uint32_t channel, uint64_t time)
+{
+	auto frame = time * Services::Acquisition::Rate / Simulation::Second;
+	return (uint16_t)(level(channel) + (frame & 1 ? 7 : -7));
+});
+
+namespace Services
+{
+	namespace Meter
+	{
+		extern const char *ServiceName;
+		SERVICE_DEPENDS(Meter, Acquisition)
+
+		static uint16_t Decimated[Acquisition::Frames / Factor * Acquisition::Channels];
+		static uint16_t Reference[Acquisition::Frames / Factor * Acquisition::Channels];
+
+		static bool Enable(const char *, bool) { return true; }
+
+		static void StateChanged(const char *name, StateType stateBits, StateType changedStateMask)
+		{
+			if(name == Acquisition::ServiceName && (changedStateMask & stateBits & (StateType)Acquisition::StateEnum::Block))
+			{
+				auto &block = Acquisition::Block();
+				auto start = Profile::Cycles();
+				auto frames = Dsp::Decimate(block.Samples, block.Frames, block.Channels, Factor, Decimated);
+				ProcessCycles += Profile::Cycles() - start;
+				Blocks++;
+				Dsp::DecimateScalar(block.Samples, block.Frames, block.Channels, Factor, Reference);
+				for(uint32_t i = 0; i < frames * block.Channels; i++)
+				{
+					if(Decimated[i] != level(i % block.Channels))
+						Errors++;
+					if(Decimated[i] != Reference[i])
+						Mismatches++;
+				}
+				if(Late != 0 && Blocks % Late == 0)
+					Sim.Work(Acquisition::Frames * Simulation::Second / Acquisition::Rate * 5 / 2);
+				if(!Acquisition::isValid(block))
+					Invalid++;
+			}
+		}
+
+		SERVICE_DECLARE(Meter, &Enable, &StateChanged, NULL, NULL)
+	}
+}
+
+//! Runs acquisition
+static void run(uint64_t duration, uint32_t late)
+{
+	Sim.Reset();
+	Services::Init();
+	Late = late;
+	Blocks = Errors = Mismatches = Invalid = 0;
+	ProcessCycles = 0;
+	Services::Enable(NULL);
+	Adc.Start();
+	Sim.Run(duration);
+	Adc.Stop();
+	Services::Enable(NULL, false);
+}
+
+int main(int argc, char *argv[])
+{
+	const uint64_t seconds = argc > 1 ? strtoul(argv[1], NULL, 10) : 60;
+	using namespace Services;
+
+	bool ok = true;
+	auto check = [&ok](bool condition, const char *message) { if(!condition) { printf("FAILED: %s\n", message); ok = false; } };
+
+	run(seconds * Simulation::Second, 0);
+	auto samples = Adc.getFrames() * Acquisition::Channels;
+	auto cpu = seconds == 0 ? 0 : (double)ProcessCycles * 100 / Profile::Frequency() / seconds;
+	auto dmaRate = seconds == 0 ? 0 : Adc.getInterrupts() / seconds;
+	printf("%u channels x %u Hz: %llu samples, %u blocks of %u frames, decimation by %u\n", (unsigned int)Acquisition::Channels,
+		(unsigned int)Acquisition::Rate, (unsigned long long)samples, Blocks, (unsigned int)Acquisition::Frames, Factor);
+	printf("interrupts: DMA %llu per second, conversion of each frame %u per second\n", (unsigned long long)dmaRate, (unsigned int)Acquisition::Rate);
+	printf("processing: %.1f nS per sample, CPU %.3f%% (host)\n", samples == 0 ? 0 : (double)ProcessCycles * 1e9 / Profile::Frequency() / samples, cpu);
+	check(Adc.getFrames() + Acquisition::Frames >= seconds * Acquisition::Rate, "frames of the rate");
+	check(Blocks + 1 >= seconds * Acquisition::Rate / Acquisition::Frames, "block of each DMA half");
+	check(Acquisition::getOverruns() == 0 && Invalid == 0, "no overruns of consumer in time");
+	check(Errors == 0, "decimated values are the levels of channels");
+	check(Mismatches == 0, "SIMD kernel equals scalar kernel");
+	check(dmaRate * Acquisition::Frames <= Acquisition::Rate, "one interrupt per block");
+	check(cpu < 10, "CPU load under 10%");
+
+	run(seconds * Simulation::Second, LateEvery);
+	printf("late consumer: %u blocks, %u overruns, %u invalid blocks\n", Blocks, Acquisition::getOverruns(), Invalid);
+	check(seconds == 0 || (Acquisition::getOverruns() != 0 && Invalid != 0), "overruns of late consumer are detected");
+	check(Errors == 0 && Mismatches == 0, "late consumer: values of published blocks");
+	return ok ? 0 : 1;
+}
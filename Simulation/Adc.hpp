@@ -0,0 +1,129 @@
+/**
+ * Simulation: ADC scan triggered by TIM6 & DMA1 channel 1 ring on the virtual clock
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Registers programmed by firmware (Services/Acquisition.h) define the mock: TIM6 update period (PSC, ARR) of
+ * @c clock, channels of scan (CHSELR), ring of DMA (CMAR, CNDTR). Frame n is converted at n update periods since @c Start:
+ * sample of channel is the value of signal at that time. Ring half is written at once when its last frame is converted,
+ * then DMA flags are set & DMA1_Channel1_IRQHandler is called like hardware does, IFCR writes of the handler clear the flags.
+ */
+
+/**
+ * @page SimulationAdc
+ * @par Usage
+ * @code
+#include "Simulation/Adc.hpp"
+
+static Simulation::AdcClass Adc(&Sim, [](uint32_t channel, uint64_t time) { return (uint16_t)(2048 + channel * 100); });
+Services::Enable(NULL);	// Acquisition programs TIM6, ADC & DMA
+Adc.Start();
+Sim.Run(Simulation::Second);
+auto frames = Adc.getFrames();
+ * @endcode
+ */
+
+#ifndef SRC_SIMULATION_ADC_HPP_
+#define SRC_SIMULATION_ADC_HPP_
+
+#include <stdint.h>
+#include <functional>
+#include "stm32l0xx.h"
+#include "Services/Acquisition.h"
+#include "Simulation/Simulation.hpp"
+
+namespace Simulation
+{
+	//! ADC & DMA of acquisition
+	class AdcClass
+	{
+	public:
+		//! Value of input at virtual time
+		typedef std::function<uint16_t(uint32_t channel, uint64_t time)> SignalType;
+
+	protected:
+		SimulationClass *m_Sim;
+		SignalType m_Signal;
+		uint32_t m_Clock;			//!< TIM6 clock, Hz
+		uint64_t m_Start;			//!< Time of Start, uS
+		uint64_t m_Frames;			//!< Frames converted since Start
+		uint32_t m_Generation;		//!< Transfers scheduled by the previous Start are ignored
+		uint64_t m_Interrupts;		//!< DMA interrupts
+
+		//! Time of frame conversion: trigger of TIM6 update
+		inline uint64_t frameTime(uint64_t frame) const
+		{
+			auto ticks = (uint64_t)(TIM6->PSC + 1) * (TIM6->ARR + 1);
+			return m_Start + frame * ticks * Second / m_Clock;
+		}
+
+		//! Frames of ring half
+		static inline uint32_t halfFrames()
+		{
+			auto channels = (uint32_t)__builtin_popcount(ADC1->CHSELR);
+			return channels == 0 ? 0 : DMA1_Channel1->CNDTR / 2 / channels;
+		}
+
+		//! Writes the ring half of converted frames & raises its DMA interrupt
+		void transfer(uint32_t generation)
+		{
+			if(generation != m_Generation || !isRunning())
+				return;
+			auto channels = (uint32_t)__builtin_popcount(ADC1->CHSELR);
+			auto frames = halfFrames();
+			auto half = (uint32_t)(m_Frames / frames) & 1;
+			auto ring = (uint16_t*)DMA1_Channel1->CMAR + half * frames * channels;
+			for(uint32_t f = 0; f < frames; f++)
+			{
+				auto time = frameTime(m_Frames + f + 1);
+				for(uint32_t c = 0; c < channels; c++)
+					ring[f * channels + c] = m_Signal(c, time);
+			}
+			m_Frames += frames;
+			DMA1->ISR |= DMA_ISR_GIF1 | (half == 0 ? DMA_ISR_HTIF1 : DMA_ISR_TCIF1);
+			if(DMA1_Channel1->CCR & (half == 0 ? DMA_CCR_HTIE : DMA_CCR_TCIE))
+			{
+				m_Interrupts++;
+				DMA1_Channel1_IRQHandler();
+			}
+			DMA1->ISR &= ~DMA1->IFCR;
+			DMA1->IFCR = 0;
+			m_Sim->At(frameTime(m_Frames + frames), [this, generation]() { transfer(generation); });
+		}
+
+	public:
+		//! @param clock	TIM6 clock, Hz
+		AdcClass(SimulationClass *sim, SignalType signal, uint32_t clock = ACQUISITION_TIMER_CLOCK) :
+			m_Sim(sim), m_Signal(signal), m_Clock(clock), m_Start(0), m_Frames(0), m_Generation(0), m_Interrupts(0) {}
+
+		//! TIM6, ADC & DMA are started
+		static inline bool isRunning()
+		{
+			return (TIM6->CR1 & TIM_CR1_CEN) && (ADC1->CR & ADC_CR_ADSTART) && (DMA1_Channel1->CCR & DMA_CCR_EN) && halfFrames() != 0;
+		}
+
+		//! Starts conversions from now: call after the firmware has started TIM6, ADC & DMA
+		//! @return False - not started by firmware
+		bool Start()
+		{
+			m_Generation++;
+			if(!isRunning())
+				return false;
+			m_Start = m_Sim->getTime();
+			m_Frames = 0;
+			m_Interrupts = 0;
+			auto generation = m_Generation;
+			m_Sim->At(frameTime(halfFrames()), [this, generation]() { transfer(generation); });
+			return true;
+		}
+
+		//! Stops conversions: scheduled transfers are ignored
+		inline void Stop() { m_Generation++; }
+
+		inline uint64_t getFrames() const { return m_Frames; }
+		inline uint64_t getInterrupts() const { return m_Interrupts; }
+	};
+}
+
+#endif /* SRC_SIMULATION_ADC_HPP_ */
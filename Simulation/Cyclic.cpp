@@ -0,0 +1,132 @@
+/**
+ * Simulation of motor controller: jitter of control loops as timers of the message loop & as cyclic executive tasks
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Control loops: current (1 mS), speed (5 mS), position (20 mS); execution time varies up to WCET.
+ * Message loop also runs telemetry (3 mS of work every 50 mS). The same loops run twice: as timers of Services/Timer.h
+ * & as tasks of Services/Cyclic.h dispatched by the timer interrupt of minor frame (preempts the message loop work).
+ * Jitter: maximal deviation of the interval between task starts from the period.
+ * Expected behaviour is checked after the runs: exit code 1 - regression.
+ * Usage: CortexM_CyclicExample [minutes]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Services/Timer.h"
+#include "Services/Cyclic.h"
+#include "Simulation/Simulation.hpp"
+
+static const uint64_t TelemetryWork = 3 * Simulation::Millisecond;
+
+static Simulation::SimulationClass Sim;
+
+//! Starts of control loop
+struct LoopStruct
+{
+	const char *Name;
+	uint64_t Period;	//!< uS
+	uint64_t Wcet;		//!< uS
+	uint64_t Last;		//!< Time of the last start, uS
+	uint64_t Runs;
+	uint64_t Jitter;	//!< uS
+};
+
+static LoopStruct Loops[] = {
+	{ "current", 1000, 150, 0, 0, 0 },
+	{ "speed", 5000, 300, 0, 0, 0 },
+	{ "position", 20000, 400, 0, 0, 0 },
+};
+static uint32_t Random = 1;
+
+//! Control loop: execution time of 3/4..1 WCET
+static void control(unsigned int i)
+{
+	auto &loop = Loops[i];
+	auto now = Sim.getTime();
+	if(loop.Runs != 0)
+	{
+		auto interval = now - loop.Last;
+		auto jitter = interval > loop.Period ? interval - loop.Period : loop.Period - interval;
+		if(jitter > loop.Jitter)
+			loop.Jitter = jitter;
+	}
+	loop.Last = now;
+	loop.Runs++;
+	Random = Random * 1664525u + 1013904223u;
+	Sim.Busy(loop.Wcet * 3 / 4 + (Random >> 8) % (loop.Wcet / 4 + 1));
+}
+
+TIMER_DECLARE(Current)
+TIMER_DECLARE(Speed)
+TIMER_DECLARE(Position)
+TIMER_DECLARE(Telemetry)
+
+TIMER_CALLBACK(Current) { control(0); }
+TIMER_CALLBACK(Speed) { control(1); }
+TIMER_CALLBACK(Position) { control(2); }
+TIMER_CALLBACK(Telemetry) { Sim.Work(TelemetryWork); }
+
+CYCLIC_TASK(CurrentTask, 1000, 150) { control(0); }
+CYCLIC_TASK(SpeedTask, 5000, 300) { control(1); }
+CYCLIC_TASK(PositionTask, 20000, 400) { control(2); }
+typedef Cyclic::ScheduleClass<CurrentTask, SpeedTask, PositionTask> Schedule;
+
+//! Runs the loops
+//! @param cyclic	True - cyclic executive; false - timers
+//! @return Maximal jitter of loops, uS
+static uint64_t run(uint64_t duration, bool cyclic)
+{
+	Sim.Reset();
+	Timer::Init();
+	for(auto &loop : Loops)
+		loop.Last = loop.Runs = loop.Jitter = 0;
+	Timer::Start(50, TIMER_STATE(Telemetry));
+	if(cyclic)
+	{
+		Schedule::Init();
+		Sim.Every(Schedule::Minor, []() { Schedule::Dispatch(); });
+	}
+	else
+	{
+		Timer::Start(Loops[0].Period / Simulation::Millisecond, TIMER_STATE(Current));
+		Timer::Start(Loops[1].Period / Simulation::Millisecond, TIMER_STATE(Speed));
+		Timer::Start(Loops[2].Period / Simulation::Millisecond, TIMER_STATE(Position));
+	}
+	Sim.Run(duration);
+
+	uint64_t jitter = 0;
+	printf("%s:\n", cyclic ? "cyclic executive" : "timers");
+	for(auto &loop : Loops)
+	{
+		printf("  %-8s period %5llu uS: runs %llu of %llu, jitter %llu uS\n", loop.Name, (unsigned long long)loop.Period,
+			(unsigned long long)loop.Runs, (unsigned long long)(duration / loop.Period), (unsigned long long)loop.Jitter);
+		if(loop.Jitter > jitter)
+			jitter = loop.Jitter;
+	}
+	return jitter;
+}
+
+int main(int argc, char *argv[])
+{
+	const uint64_t minutes = argc > 1 ? strtoul(argv[1], NULL, 10) : 10;
+	const uint64_t duration = minutes * Simulation::Minute;
+
+	printf("schedule: minor frame %u uS, major frame %u uS, peak load %u uS\n", Schedule::Minor, Schedule::Major, Schedule::PeakLoad);
+	for(unsigned int i = 0; i < Schedule::Count; i++)
+		printf("  %-8s offset %u frames\n", Loops[i].Name, Schedule::Offset(i));
+
+	auto timers = run(duration, false);
+	auto cyclic = run(duration, true);
+
+	// expected behaviour
+	bool ok = true;
+	auto check = [&ok](bool condition, const char *message) { if(!condition) { printf("FAILED: %s\n", message); ok = false; } };
+	for(auto &loop : Loops)
+		check(loop.Runs >= duration / loop.Period, "cyclic executive runs each task every period");
+	check(Loops[0].Jitter == 0, "first task of frame starts at frame");
+	check(cyclic <= Schedule::PeakLoad, "jitter of cyclic executive is within frame load");
+	check(minutes == 0 || timers > cyclic, "jitter of timers includes message loop work");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,241 @@
+/**
+ * Simulation of data logger device: timers, services, page cache & persistent storage on FLASH, USB
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Device: LED blinks (500 mS), sensor samples (100 mS) are appended to the log on FLASH by page cache,
+ * button press (EXTI interrupt) flushes the log & saves settings to persistent storage, USB host reads samples count.
+ * Expected behaviour is checked after the run: exit code 1 - regression.
+ * Usage: CortexM_SimulationExample [hours]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "stm32l0xx.h"
+#include "pin.h"
+#include "Services/Timer.h"
+#include "Services/IService.h"
+#include "Libs/PageCacheClass.hpp"
+#include "Libs/PersistentStorage.hpp"
+#include "Simulation/Simulation.hpp"
+#include "Simulation/Gpio.hpp"
+#include "Simulation/Flash.hpp"
+#include "Simulation/UsbHost.hpp"
+
+typedef Pin<'A', 5> Led;
+
+static const unsigned int PageSize = 256;
+static const uint32_t SectorSize = 1024;
+static const uint32_t LogSize = 60 * 1024;		//!< Log: ring of sectors
+static const uint32_t SettingsAddress = LogSize;	//!< Settings: persistent storage of one sector
+static const uint8_t VendorSamples = 0x01;		//!< Vendor request: samples count
+
+static Simulation::SimulationClass Sim;
+static Simulation::FlashClass Flash(&Sim, 64 * 1024, SectorSize);
+
+//! CRC-16/CCITT
+static uint16_t crc(const uint8_t *p, unsigned int len)
+{
+	uint16_t crc = 0xFFFF;
+	for(; len > 0; len--, p++)
+	{
+		crc ^= (uint16_t)*p << 8;
+		for(unsigned int i = 0; i < 8; i++)
+			crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+	}
+	return crc;
+}
+
+//! Log of samples: sector is erased when the first page of it is written
+class LogCacheClass : public System::Cache::PageCacheClass<uint32_t, PageSize>
+{
+protected:
+	bool Write(const void *buffer, uint32_t address, unsigned int len) override
+	{
+		if(address % SectorSize == 0 && !Flash.Erase(address))
+			return false;
+		return Flash.Program(address, buffer, len);
+	}
+	bool Read(void *buffer, uint32_t address, unsigned int len) override { return Flash.Read(address, buffer, len); }
+};
+
+class SettingsWriterClass : public System::PersistentStorage::StorageWriterClass<uint32_t, uint16_t>
+{
+protected:
+	bool Write(const void *data, unsigned int len, uint32_t address) const override { return Flash.Program(address, data, len); }
+
+public:
+	SettingsWriterClass(const System::UUID &uuid) : StorageWriterClass(SettingsAddress, uuid) {}
+};
+
+class SettingsReaderClass : public System::PersistentStorage::StorageReaderClass<uint32_t, uint16_t>
+{
+protected:
+	bool Compare(const void *pattern, uint32_t address, unsigned int len) const override { return memcmp(pattern, Flash.getData(address), len) == 0; }
+	uint16_t CalculateCRC(uint32_t address, unsigned int len) const override { return crc(Flash.getData(address), len); }
+	bool Read(void *data, uint32_t address, unsigned int len) const override
+	{
+		memcpy(data, Flash.getData(address), len);
+		return true;
+	}
+
+public:
+	SettingsReaderClass() : StorageReaderClass(SettingsAddress) {}
+};
+
+static constexpr System::UUID SettingsUUID = System::UUID::Parse("5b0c7e1a-3f6d-4e2b-9c8a-1d2e3f4a5b6c");
+
+struct SettingsStruct
+{
+	uint32_t Samples;	//!< Samples count at the save time
+	uint32_t Presses;	//!< Button presses count
+};
+
+class DeviceUsbClass : public Usb::UsbBase
+{
+	const uint8_t m_DeviceDescriptor[18] = { USB_DEVICE_DESCRIPTOR_Declare(0x0200, 0xFF, 0, 0, 8, 0x0483, 0x5740, 0x0100, 0, 0, 0, 1) };
+	const uint8_t m_ConfigDescriptor[18] = { USB_CONFIGURATION_DESCRIPTOR_Declare(1, 1, 0, 0x80, 50, USB_INTERFACE_DESCRIPTOR_Declare(0, 0, 0, 0xFF, 0, 0, 0)) };
+	uint8_t m_Answer[4];
+
+public:
+	uint32_t Samples;
+
+	DeviceUsbClass() : Samples(0)
+	{
+		_state = Usb::StateEnum::UNCONNECTED;
+	}
+
+	void sof() override {}
+	uint16_t getMaxPacketSize(uint8_t) override { return 8; }
+	bool setupNonStandartRequest(Usb::EndpointStatusStruct *, Usb::DataPointerStruct *data) override
+	{
+		if(ActiveSetupRequest.bRequest != VendorSamples)
+			return false;
+		memcpy(m_Answer, &Samples, sizeof(m_Answer));
+		return data->set(m_Answer, sizeof(m_Answer));
+	}
+	bool getDeviceDescriptor(Usb::DataPointerStruct *data) override { return data->set(m_DeviceDescriptor, sizeof(m_DeviceDescriptor)); }
+	bool getConfigDescriptor(Usb::DataPointerStruct *data) override { return data->set(m_ConfigDescriptor, sizeof(m_ConfigDescriptor)); }
+	bool getStringDescriptor(const uint8_t, const uint16_t, Usb::DataPointerStruct *) override { return false; }
+	bool setConfiguration(uint8_t value) override { return value == 1; }
+};
+
+static LogCacheClass Log;
+static uint32_t LogAddress;
+static DeviceUsbClass UsbDevice;
+static Simulation::UsbHostClass Host(&Sim, &UsbDevice);
+static uint32_t Presses, Saves;
+
+namespace Services
+{
+	namespace Button
+	{
+		enum class StateEnum { Pressed = 1 };
+		enum class StateLocalEnum { Exti = 1 };
+		extern const char *ServiceName;
+		SERVICE_DEPENDS(Button)
+
+		static bool Enable(const char *, bool) { return true; }
+
+		//! Pressed is the pulse: cleared after processing by all the services
+		static void StateChangedBy(const char *, StateType &stateBits, StateType changedStateMask)
+		{
+			if(changedStateMask & (StateType)StateEnum::Pressed)
+				stateBits &= ~(StateType)StateEnum::Pressed;
+		}
+
+		static void LocalStateChanged(const char *, StateType &stateBits)
+		{
+			if(stateBits & (StateType)StateLocalEnum::Exti)
+				SetState(ServiceName, (StateType)StateEnum::Pressed);
+			stateBits = 0;
+		}
+
+		SERVICE_DECLARE(Button, &Enable, NULL, &StateChangedBy, &LocalStateChanged)
+	}
+
+	namespace Logger
+	{
+		extern const char *ServiceName;
+		SERVICE_DEPENDS(Logger, Button) // enabled after Button
+
+		static bool Enable(const char *, bool) { return true; }
+
+		static void StateChanged(const char *name, StateType stateBits, StateType changedStateMask)
+		{
+			if(name == Button::ServiceName && (changedStateMask & stateBits & (StateType)Button::StateEnum::Pressed))
+			{
+				Presses++;
+				Log.Flush();
+				SettingsStruct settings = { UsbDevice.Samples, Presses };
+				SettingsWriterClass writer(SettingsUUID);
+				if(Flash.Erase(SettingsAddress) && writer.SetData(&settings, sizeof(settings), crc((const uint8_t*)&settings, sizeof(settings))))
+					Saves++;
+			}
+		}
+
+		SERVICE_DECLARE(Logger, &Enable, &StateChanged, NULL, NULL)
+	}
+}
+
+TIMER_DECLARE(Blink)
+TIMER_DECLARE(Sample)
+
+TIMER_CALLBACK(Blink)
+{
+	Led::Cpl();
+}
+
+TIMER_CALLBACK(Sample)
+{
+	uint32_t record[2] = { Timer::Now(), UsbDevice.Samples * 2654435761u }; // time, sensor value
+	Log.SetData(record, LogAddress, sizeof(record));
+	LogAddress = (LogAddress + sizeof(record)) % LogSize;
+	UsbDevice.Samples++;
+}
+
+int main(int argc, char *argv[])
+{
+	const uint64_t hours = argc > 1 ? strtoul(argv[1], NULL, 10) : 24;
+
+	Timer::Init();
+	Services::Init();
+	Services::Enable(NULL);
+	Led::Config(GPIO::Output_PP_Low, 0);
+	Timer::Start(500, TIMER_STATE(Blink));
+	Timer::Start(100, TIMER_STATE(Sample));
+
+	// scripted interrupts
+	Sim.Every(7 * Simulation::Second, []() { Services::SetLocalState(Services::Button::ServiceName, (Services::StateType)Services::Button::StateLocalEnum::Exti); });
+	Host.Attach(2 * Simulation::Second);
+	Sim.Every(Simulation::Minute, []() { Host.Control(0xC0, VendorSamples, 0, 0, 4); });
+
+	auto start = std::chrono::steady_clock::now();
+	Sim.Run(hours * Simulation::Hour);
+	auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	auto &metrics = Sim.getMetrics();
+	printf("simulated %.1f h in %.3f s: %.0f h/s\n", metrics.Time / (double)Simulation::Hour, elapsed, metrics.Time / (double)Simulation::Hour / elapsed);
+	printf("loop iterations %llu, interrupts %llu, sleep %.1f%%\n", (unsigned long long)metrics.Iterations, (unsigned long long)metrics.Interrupts, 100.0 * metrics.SleepTime / metrics.Time);
+	printf("timer callbacks %llu, service callbacks %llu, GPIO edges %llu\n", (unsigned long long)metrics.TimerCallbacks, (unsigned long long)metrics.ServiceCallbacks, (unsigned long long)metrics.GpioEdges);
+	printf("FLASH programmed %llu bytes, erased %llu sectors, wear %u, errors %u\n", (unsigned long long)Flash.getBytesProgrammed(), (unsigned long long)Flash.getSectorsErased(), Flash.getWear(), Flash.getErrors());
+	printf("services ready in %u uS\n", Services::ReadyTime());
+	printf("USB requests %llu, stalls %llu, IN %llu bytes\n", (unsigned long long)Host.getRequests(), (unsigned long long)Host.getStalls(), (unsigned long long)Host.getBytesIn());
+
+	// expected behaviour
+	const uint64_t seconds = hours * 3600;
+	uint32_t samples = 0;
+	SettingsReaderClass reader;
+	bool ok = true;
+	auto check = [&ok](bool condition, const char *message) { if(!condition) { printf("FAILED: %s\n", message); ok = false; } };
+	check(metrics.GpioEdges >= seconds * 2 - 1, "LED blinks");
+	check(UsbDevice.Samples >= seconds * 10 - 1, "samples count");
+	check(Flash.getErrors() == 0, "FLASH program errors");
+	check(Host.getState() == Usb::StateEnum::CONFIGURED, "USB is configured");
+	check(hours == 0 || (Host.getAnswer().size() == 4 && memcpy(&samples, Host.getAnswer().data(), 4) && samples > 0), "USB vendor request");
+	check(Presses == seconds / 7 && Saves == Presses, "button presses saved");
+	check(Presses == 0 || reader.IsStorageCorrect(SettingsAddress, SettingsUUID) == SettingsReaderClass::StorageCheckEnum::Ok, "settings storage");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/**
+ * Simulation: NOR FLASH device
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Erase sets the sector to 0xFF, program clears bits only: program of non-erased bits fails like on the device
+ * (write without erase is the bug of storage algorithm). Operations take virtual time of simulation (CPU stall of internal FLASH).
+ * Counters: bytes programmed & read, sectors erased, wear (maximum erases of one sector), errors.
+ */
+
+/**
+ * @page SimulationFlash
+ * @par Usage
+ * @code
+#include "Simulation/Flash.hpp"
+
+static Simulation::FlashClass Flash(&Sim, 64 * 1024, 1024); // 64 KB, 1 KB sectors
+
+class LogCacheClass : public System::Cache::PageCacheClass<uint32_t, 256>
+{
+protected:
+	bool Write(const void *buffer, uint32_t address, unsigned int len) override
+	{
+		if(address % Flash.getSectorSize() == 0 && !Flash.Erase(address))
+			return false;
+		return Flash.Program(address, buffer, len);
+	}
+	bool Read(void *buffer, uint32_t address, unsigned int len) override { return Flash.Read(address, buffer, len); }
+};
+auto programmed = Flash.getBytesProgrammed();
+ * @endcode
+ */
+
+#ifndef SRC_SIMULATION_FLASH_HPP_
+#define SRC_SIMULATION_FLASH_HPP_
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "Simulation/Simulation.hpp"
+
+namespace Simulation
+{
+	//! NOR FLASH device
+	class FlashClass
+	{
+	protected:
+		SimulationClass *m_Simulation;
+		std::vector<uint8_t> m_Memory;
+		std::vector<uint32_t> m_Erases;	//!< Erases count of each sector
+		uint32_t m_SectorSize;
+		uint64_t m_EraseTime;			//!< Sector erase time, uS
+		uint64_t m_ProgramTime;			//!< Program time of 1 KB, uS
+		uint64_t m_BytesProgrammed;
+		uint64_t m_BytesRead;
+		uint64_t m_SectorsErased;
+		uint32_t m_Errors;				//!< Program of non-erased bits, out of device
+
+		inline bool inside(uint32_t address, unsigned int len) const { return address <= m_Memory.size() && len <= m_Memory.size() - address; }
+
+		inline bool error()
+		{
+			m_Errors++;
+			return false;
+		}
+
+	public:
+
+		//! @param simulation	Simulation to take time of operations; NULL - no time
+		//! @param size			Device size, bytes
+		//! @param sectorSize	Erase sector size, bytes
+		//! @param eraseTime	Sector erase time, uS
+		//! @param programTime	Program time of 1 KB, uS
+		FlashClass(SimulationClass *simulation, uint32_t size, uint32_t sectorSize, uint64_t eraseTime = 20 * Millisecond, uint64_t programTime = 2 * Millisecond) :
+			m_Simulation(simulation), m_Memory(size, 0xFF), m_Erases(size / sectorSize, 0), m_SectorSize(sectorSize),
+			m_EraseTime(eraseTime), m_ProgramTime(programTime), m_BytesProgrammed(0), m_BytesRead(0), m_SectorsErased(0), m_Errors(0) {}
+
+		//! Erases sector
+		//! @param address	Any address of the sector
+		bool Erase(uint32_t address)
+		{
+			if(address >= m_Memory.size())
+				return error();
+			auto sector = address / m_SectorSize;
+			memset(&m_Memory[sector * m_SectorSize], 0xFF, m_SectorSize);
+			m_Erases[sector]++;
+			m_SectorsErased++;
+			if(m_Simulation != NULL)
+				m_Simulation->Busy(m_EraseTime);
+			return true;
+		}
+
+		//! Programs data: clears bits
+		//! @return True - success; false - out of device or bits are not erased
+		bool Program(uint32_t address, const void *data, unsigned int len)
+		{
+			if(!inside(address, len))
+				return error();
+			auto bytes = (const uint8_t*)data;
+			for(unsigned int i = 0; i < len; i++)
+				if((m_Memory[address + i] & bytes[i]) != bytes[i])
+					return error();
+			for(unsigned int i = 0; i < len; i++)
+				m_Memory[address + i] &= bytes[i];
+			m_BytesProgrammed += len;
+			if(m_Simulation != NULL)
+				m_Simulation->Busy(m_ProgramTime * len / 1024);
+			return true;
+		}
+
+		bool Read(uint32_t address, void *data, unsigned int len)
+		{
+			if(!inside(address, len))
+				return error();
+			memcpy(data, &m_Memory[address], len);
+			m_BytesRead += len;
+			return true;
+		}
+
+		//! @return True - all the bytes are 0xFF
+		bool isErased(uint32_t address, unsigned int len) const
+		{
+			if(!inside(address, len))
+				return false;
+			for(unsigned int i = 0; i < len; i++)
+				if(m_Memory[address + i] != 0xFF)
+					return false;
+			return true;
+		}
+
+		//! Direct access to memory: check of stored data
+		inline const uint8_t *getData(uint32_t address = 0) const { return &m_Memory[address]; }
+
+		inline uint32_t getSize() const { return m_Memory.size(); }
+		inline uint32_t getSectorSize() const { return m_SectorSize; }
+		inline uint64_t getBytesProgrammed() const { return m_BytesProgrammed; }
+		inline uint64_t getBytesRead() const { return m_BytesRead; }
+		inline uint64_t getSectorsErased() const { return m_SectorsErased; }
+		inline uint32_t getErrors() const { return m_Errors; }
+
+		//! @return Maximum erases of one sector
+		inline uint32_t getWear() const
+		{
+			uint32_t wear = 0;
+			for(auto erases : m_Erases)
+				if(erases > wear)
+					wear = erases;
+			return wear;
+		}
+	};
+}
+
+#endif /* SRC_SIMULATION_FLASH_HPP_ */
@@ -0,0 +1,72 @@
+/**
+ * Simulation: GPIO of the host port memory
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Peripherals of host port are plain memory (Port/Host/stm32l0xx.h): BSRR/BRR stores of pin.h are not applied by hardware.
+ * @c Sync applies them to ODR & mirrors output pins (MODER) to IDR; simulation calls it after each interrupt & message loop iteration.
+ * So outputs are sampled: pulse within one callback is not seen. Inputs are set by scripted interrupts.
+ */
+
+#ifndef SRC_SIMULATION_GPIO_HPP_
+#define SRC_SIMULATION_GPIO_HPP_
+
+#include <stdint.h>
+#include "stm32l0xx.h"
+
+namespace Simulation
+{
+	namespace Gpio
+	{
+		static const char Ports[] = { 'A', 'B', 'C', 'D', 'E', 'H' };
+
+		//! Port registers
+		//! @param port		Port letter: 'A'..'H'
+		inline GPIO_TypeDef *Port(char port) { return (GPIO_TypeDef*)(GPIOA_BASE + (port - 'A') * 0x400UL); }
+
+		//! Mask of output pins (MODER: general purpose output)
+		inline uint32_t outputs(GPIO_TypeDef *gpio)
+		{
+			uint32_t mask = 0;
+			for(unsigned int pin = 0; pin < 16; pin++)
+				if(((gpio->MODER >> (pin * 2)) & 3) == 1)
+					mask |= 1u << pin;
+			return mask;
+		}
+
+		//! Applies BSRR/BRR stores to ODR, output pins to IDR
+		//! @return Count of output changes
+		inline unsigned int Sync()
+		{
+			unsigned int edges = 0;
+			for(auto port : Ports)
+			{
+				auto gpio = Port(port);
+				uint32_t bsrr = gpio->BSRR, brr = gpio->BRR;
+				if(bsrr == 0 && brr == 0)
+					continue;
+				gpio->BSRR = gpio->BRR = 0;
+				uint32_t odr = gpio->ODR;
+				uint32_t changed = ((odr & ~((bsrr >> 16) | brr)) | (bsrr & 0xFFFF)) & 0xFFFF; // set has priority
+				gpio->ODR = changed;
+				auto mask = outputs(gpio);
+				gpio->IDR = (gpio->IDR & ~mask) | (changed & mask);
+				edges += __builtin_popcount(odr ^ changed);
+			}
+			return edges;
+		}
+
+		//! Sets input pin level
+		inline void Input(char port, unsigned int pin, bool level)
+		{
+			auto gpio = Port(port);
+			gpio->IDR = level ? gpio->IDR | (1u << pin) : gpio->IDR & ~(1u << pin);
+		}
+
+		//! @return Output pin level (ODR)
+		inline bool Output(char port, unsigned int pin) { return (Port(port)->ODR & (1u << pin)) != 0; }
+	}
+}
+
+#endif /* SRC_SIMULATION_GPIO_HPP_ */
@@ -0,0 +1,130 @@
+/**
+ * Simulation of sampling device: callback latency of deferred timers & of ISR class timers under message loop load
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Two timers sample every 10 mS: deferred timer (callback from Timer::Tick of the message loop) & ISR class timer
+ * (callback from SysTick interrupt). Message loop processes packets of radio interrupt (every 7 mS): work of load
+ * percent of the packet period. Latency: callback time minus time stamp of callback, uS. ISR class callback defers
+ * processing of the sample to the message loop timer (defers of busy loop are coalesced).
+ * Expected behaviour is checked after the runs: exit code 1 - regression.
+ * Usage: CortexM_IsrTimerExample [minutes]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+#include "Services/Timer.h"
+#include "Simulation/Simulation.hpp"
+
+static const uint32_t SampleInterval = 10;							//!< mS
+static const uint64_t PacketPeriod = 7 * Simulation::Millisecond;
+static const unsigned int Loads[] = { 0, 25, 50, 75 };				//!< Message loop load, percent
+
+static Simulation::SimulationClass Sim;
+static unsigned int Packets, Load;
+static uint32_t Random = 1;
+static uint32_t Processed;
+
+//! Latencies of timer callbacks
+struct LatencyStruct
+{
+	std::vector<uint64_t> Values;	//!< uS
+	uint64_t Due;					//!< Time of the next callback, uS
+
+	void Add(uint32_t timeStamp)
+	{
+		auto now = Sim.getTime();
+		if(Due != 0)
+			Values.push_back(now - Due);
+		Due = (uint64_t)timeStamp * Simulation::Millisecond;
+	}
+
+	uint64_t Percentile(unsigned int percent)
+	{
+		if(Values.empty())
+			return 0;
+		std::sort(Values.begin(), Values.end());
+		return Values[(Values.size() - 1) * percent / 100];
+	}
+};
+
+static LatencyStruct Deferred, Isr;
+
+TIMER_DECLARE(Sample)
+TIMER_DECLARE(Process)
+TIMER_ISR_DECLARE(IsrSample)
+
+TIMER_CALLBACK(Sample)
+{
+	Deferred.Add((TIMER_STATE(Sample))->TimeStamp);
+	Sim.Work(20); // message loop: interrupts preempt
+}
+
+TIMER_CALLBACK(Process)
+{
+	Processed++;
+}
+
+TIMER_ISR_CALLBACK(IsrSample)
+{
+	Isr.Add((TIMER_ISR_STATE(IsrSample))->TimeStamp);
+	Sim.Busy(20); // interrupt: not preempted by the message loop
+	context.Defer(TIMER_STATE(Process));
+}
+
+//! Runs the timers at loop load
+static void run(uint64_t duration, unsigned int load)
+{
+	Sim.Reset();
+	Timer::Init();
+	Deferred = LatencyStruct();
+	Isr = LatencyStruct();
+	Packets = 0;
+	Load = load;
+	Processed = 0;
+	Timer::Start(SampleInterval, TIMER_STATE(Sample));
+	Timer::Start(SampleInterval, TIMER_ISR_STATE(IsrSample));
+	Sim.Every(PacketPeriod, []() { Packets++; });
+	Sim.Loop([]()
+	{
+		for(; Packets > 0; Packets--)
+		{
+			// work of 1/2..3/2 of load
+			Random = Random * 1664525u + 1013904223u;
+			auto work = PacketPeriod * Load / 100;
+			Sim.Work(work / 2 + (Random >> 8) % (work + 1));
+		}
+	});
+	Sim.Run(duration);
+	Sim.Loop(Simulation::HandlerType());
+}
+
+int main(int argc, char *argv[])
+{
+	const uint64_t minutes = argc > 1 ? strtoul(argv[1], NULL, 10) : 10;
+
+	bool ok = true;
+	auto check = [&ok](bool condition, const char *message) { if(!condition) { printf("FAILED: %s\n", message); ok = false; } };
+	uint64_t isrMax = 0, deferredMax = 0, deferredMin = UINT64_MAX;
+	printf("load    deferred p50/p99/max, uS    ISR class p50/p99/max, uS\n");
+	for(auto load : Loads)
+	{
+		run(minutes * Simulation::Minute, load);
+		printf("%3u%%  %8llu %8llu %8llu     %8llu %8llu %8llu\n", load,
+			(unsigned long long)Deferred.Percentile(50), (unsigned long long)Deferred.Percentile(99), (unsigned long long)Deferred.Percentile(100),
+			(unsigned long long)Isr.Percentile(50), (unsigned long long)Isr.Percentile(99), (unsigned long long)Isr.Percentile(100));
+		check(Isr.Values.size() + 1 >= minutes * 60000 / SampleInterval, "ISR class timer runs every interval");
+		auto isrCallbacks = Isr.Values.size() + 1; // the first callback has no latency
+		check(Processed != 0 && Processed <= isrCallbacks && (load != 0 || Processed + 1 >= isrCallbacks), "deferred processing: one callback per ISR class callback (busy loop merges them)");
+		if(load == 0)
+			isrMax = Isr.Percentile(100);
+		check(Isr.Percentile(100) == isrMax, "ISR class latency doesn't depend on loop load");
+		deferredMax = std::max(deferredMax, Deferred.Percentile(99));
+		deferredMin = std::min(deferredMin, Deferred.Percentile(99));
+	}
+	check(minutes == 0 || deferredMax > deferredMin, "deferred timer latency depends on loop load");
+	return ok ? 0 : 1;
+}
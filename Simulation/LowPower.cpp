@@ -0,0 +1,125 @@
+/**
+ * Simulation of low-power sensor: current draw of mS timers in SLEEP mode & of low-power timers in STOP mode
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Device: sensor is sampled every 10 S (2 mS conversion), housekeeping mS timer runs every minute, button
+ * interrupt every 7 minutes. The same workload runs twice: sample timer of Services/Timer.h with SLEEP idle (SysTick
+ * wakes the device every mS) & sample timer of Services/LpTimer.h with STOP idle (LPTIM compare wakes the device for
+ * due deadlines only). Average current is estimated by board currents of Services/Energy.h.
+ * Expected behaviour is checked after the runs: exit code 1 - regression.
+ * Usage: CortexM_LowPowerExample [hours]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "stm32l0xx.h"
+#include "Services/Timer.h"
+#include "Services/LpTimer.h"
+#include "Services/Energy.h"
+#include "Simulation/Simulation.hpp"
+
+static const uint32_t SampleInterval = 10000;		//!< mS
+static const uint32_t HousekeepingInterval = 60000;	//!< mS
+static const uint64_t ConversionTime = 2 * Simulation::Millisecond;
+static const uint64_t SysTickTime = 5;			//!< SysTick interrupt in SLEEP mode: wakeup & handler, uS
+static const uint64_t StopWakeupTime = 10;		//!< Wakeup from STOP mode: regulator & clock start, uS
+
+static Simulation::SimulationClass Sim;
+static uint32_t Samples, Housekeeping, Presses;
+
+TIMER_DECLARE(Sample)
+TIMER_DECLARE(Housekeeping)
+LPTIMER_DECLARE(LpSample)
+
+static void sample()
+{
+	Sim.Busy(ConversionTime);
+	Samples++;
+}
+
+TIMER_CALLBACK(Sample)
+{
+	sample();
+}
+
+TIMER_CALLBACK(LpSample)
+{
+	sample();
+}
+
+TIMER_CALLBACK(Housekeeping)
+{
+	Housekeeping++;
+}
+
+//! Result of run
+struct RunStruct
+{
+	uint32_t Samples, Housekeeping, Presses;
+	uint64_t Wakeups;
+	double Current;		//!< Average, uA
+	int64_t Drift;		//!< SystemTime minus clock at the end, mS
+};
+
+//! Runs the workload
+//! @param stop		True - LP sample timer & STOP idle; false - mS sample timer & SLEEP idle
+static RunStruct run(uint64_t duration, bool stop)
+{
+	Sim.Reset();
+	Samples = Housekeeping = Presses = 0;
+	Timer::Init();
+	Timer::Start(HousekeepingInterval, TIMER_STATE(Housekeeping));
+	if(stop)
+	{
+		LpTimer::Init();
+		LpTimer::Start(SampleInterval, TIMER_STATE(LpSample));
+	}
+	else
+		Timer::Start(SampleInterval, TIMER_STATE(Sample));
+	Sim.setStopMode(stop);
+	Sim.Every(7 * Simulation::Minute, []() { Presses++; });
+	Sim.Run(duration);
+	if(stop)
+	{
+		LpTimer::Stop(TIMER_STATE(LpSample));
+		LPTIM1->CR = 0; // next run: SLEEP only
+	}
+
+	// charge, uA * uS: SysTick interrupts of SLEEP mode & wakeups from STOP mode run at run mode current
+	auto &metrics = Sim.getMetrics();
+	uint64_t sleep = metrics.SleepTime - metrics.StopTime;
+	uint64_t ticks = sleep / Simulation::Millisecond;
+	uint64_t wakeups = metrics.StopTime != 0 ? metrics.Wakeups : 0;
+	uint64_t run = metrics.Time - metrics.SleepTime + ticks * SysTickTime + wakeups * StopWakeupTime;
+	double charge = (double)run * ENERGY_RUN_CURRENT + (double)(sleep - ticks * SysTickTime) * ENERGY_SLEEP_CURRENT
+		+ (double)(metrics.StopTime - wakeups * StopWakeupTime) * ENERGY_STOP_CURRENT;
+	RunStruct result = { Samples, Housekeeping, Presses, metrics.Wakeups + ticks, charge / metrics.Time,
+		(int64_t)(int32_t)(SystemTime - (uint32_t)(metrics.Time / Simulation::Millisecond)) };
+	printf("%s: samples %u, housekeeping %u, presses %u, wakeups %llu, stop %.1f%%, SystemTime error %llu mS, drift %lld mS, average current %.2f uA\n",
+		stop ? "STOP, LP timer" : "SLEEP, mS timer", result.Samples, result.Housekeeping, result.Presses, (unsigned long long)result.Wakeups,
+		100.0 * metrics.StopTime / metrics.Time, (unsigned long long)metrics.TimeError, (long long)result.Drift, result.Current);
+	return result;
+}
+
+int main(int argc, char *argv[])
+{
+	const uint64_t hours = argc > 1 ? strtoul(argv[1], NULL, 10) : 24;
+
+	auto sleep = run(hours * Simulation::Hour, false);
+	auto stop = run(hours * Simulation::Hour, true);
+	printf("STOP mode saves %.1f%% of charge: %.2f -> %.2f uA\n", 100.0 * (1 - stop.Current / sleep.Current), sleep.Current, stop.Current);
+
+	// expected behaviour
+	const uint64_t seconds = hours * 3600;
+	bool ok = true;
+	auto check = [&ok](bool condition, const char *message) { if(!condition) { printf("FAILED: %s\n", message); ok = false; } };
+	check(sleep.Samples == seconds * 1000 / SampleInterval && stop.Samples == sleep.Samples, "samples count");
+	check(sleep.Housekeeping == seconds * 1000 / HousekeepingInterval && stop.Housekeeping == sleep.Housekeeping, "mS timer in STOP mode");
+	check(stop.Presses == sleep.Presses, "interrupts in STOP mode");
+	check(Sim.getMetrics().TimeError <= 1 && stop.Drift >= -1 && stop.Drift <= 1, "SystemTime correction");
+	check(hours == 0 || stop.Wakeups * 10 < sleep.Wakeups, "wakeups for due deadlines only");
+	check(hours == 0 || stop.Current * 10 < sleep.Current, "average current of STOP mode");
+	return ok ? 0 : 1;
+}
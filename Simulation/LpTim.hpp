@@ -0,0 +1,87 @@
+/**
+ * Simulation: LPTIM1 counter of the host port memory on the virtual clock
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Counter follows the virtual clock since time 0 (LpTimer::Init at the simulation start): @c LpTimer::Frequency ticks
+ * per second. Counter (ARR) & compare matches set ISR flags & call LPTIM1_IRQHandler like hardware does, ICR writes
+ * of the handler clear the flags. Simulation syncs the counter on each clock change & sleeps until @c Due in STOP mode.
+ */
+
+#ifndef SRC_SIMULATION_LPTIM_HPP_
+#define SRC_SIMULATION_LPTIM_HPP_
+
+#include <stdint.h>
+#include "stm32l0xx.h"
+#include "Services/LpTimer.h"
+#include "Simulation/Simulation.hpp"
+
+namespace Simulation
+{
+	namespace LpTim
+	{
+		//! Counter is started
+		inline bool isRunning() { return (LPTIM1->CR & LPTIM_CR_ENABLE) != 0; }
+
+		//! Ticks at virtual time
+		inline uint64_t Ticks(uint64_t time) { return time * LpTimer::Frequency / Second; }
+
+		//! Virtual time of tick
+		inline uint64_t Time(uint64_t ticks) { return (ticks * Second + LpTimer::Frequency - 1) / LpTimer::Frequency; }
+
+		//! Next match tick after tick: ARR match (the last tick of period) & compare match
+		inline uint64_t nextMatch(uint64_t tick, uint32_t value)
+		{
+			auto match = (tick & ~(uint64_t)0xFFFF) | (value & 0xFFFF);
+			return match > tick ? match : match + 0x10000;
+		}
+
+		//! Virtual time of the next interrupt: ARR or compare match
+		inline uint64_t Due(uint64_t time)
+		{
+			auto tick = Ticks(time);
+			uint64_t due = UINT64_MAX;
+			if(LPTIM1->IER & LPTIM_IER_ARRMIE)
+				due = nextMatch(tick, LPTIM1->ARR);
+			if(LPTIM1->IER & LPTIM_IER_CMPMIE)
+			{
+				auto compare = nextMatch(tick, LPTIM1->CMP);
+				if(compare < due)
+					due = compare;
+			}
+			return due == UINT64_MAX ? UINT64_MAX : Time(due);
+		}
+
+		//! Advances counter from time to time: interrupts of matches in order
+		//! @return Interrupts count
+		inline unsigned int Sync(uint64_t from, uint64_t to)
+		{
+			unsigned int interrupts = 0;
+			auto tick = Ticks(from), end = Ticks(to);
+			for(;;)
+			{
+				auto arr = nextMatch(tick, LPTIM1->ARR), compare = nextMatch(tick, LPTIM1->CMP);
+				tick = arr < compare ? arr : compare;
+				if(tick > end)
+					break;
+				LPTIM1->CNT = (uint32_t)tick & 0xFFFF;
+				if(tick == arr)
+					LPTIM1->ISR |= LPTIM_ISR_ARRM;
+				if(tick == compare)
+					LPTIM1->ISR |= LPTIM_ISR_CMPM;
+				if(LPTIM1->ISR & LPTIM1->IER & (LPTIM_ISR_ARRM | LPTIM_ISR_CMPM))
+				{
+					LPTIM1_IRQHandler();
+					interrupts++;
+				}
+				LPTIM1->ISR &= ~LPTIM1->ICR;
+				LPTIM1->ICR = 0;
+			}
+			LPTIM1->CNT = (uint32_t)end & 0xFFFF;
+			return interrupts;
+		}
+	}
+}
+
+#endif /* SRC_SIMULATION_LPTIM_HPP_ */
@@ -0,0 +1,17 @@
+/**
+ * Simulation: probe config of the framework (PROBE_CONFIG)
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Callbacks counters of simulation metrics (@see Simulation::MetricsStruct).
+ */
+
+#ifndef SRC_SIMULATION_PROBES_H_
+#define SRC_SIMULATION_PROBES_H_
+
+PROBE_COUNT(Probe::TimerCallback)
+PROBE_COUNT(Probe::ServicesCallback)
+PROBE_COUNT(Probe::UsbSetupRequest)
+
+#endif /* SRC_SIMULATION_PROBES_H_ */
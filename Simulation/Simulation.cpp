@@ -0,0 +1,242 @@
+/**
+ * Deterministic simulation of the device on host: virtual clock, scripted interrupts & message loop
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include "Simulation/Simulation.hpp"
+#include "Simulation/Gpio.hpp"
+#include "Simulation/LpTim.hpp"
+#include "Services/Timer.h"
+#include "Services/IService.h"
+#include "Services/LpTimer.h"
+#include "Libs/Probe.hpp"
+#include <string.h>
+
+namespace Simulation
+{
+	typedef Probe::CounterProbe<Probe::TimerCallback> TimerCallbacks;
+	typedef Probe::CounterProbe<Probe::ServicesCallback> ServiceCallbacks;
+
+	SimulationClass::SimulationClass(uint64_t loopTime) : m_Time(0), m_LoopTime(loopTime == 0 ? 1 : loopTime), m_StopMode(false)
+	{
+		Reset();
+	}
+
+	void SimulationClass::Reset()
+	{
+		m_Events = decltype(m_Events)();
+		m_Order = 0;
+		memset(&m_Metrics, 0, sizeof(m_Metrics));
+		m_TimerCallbacks = TimerCallbacks::Counter();
+		m_ServiceCallbacks = ServiceCallbacks::Counter();
+		m_SystemTimeOffset = 0;
+		m_Time = 0;
+		setTime(0);
+	}
+
+	void SimulationClass::setTime(uint64_t time, bool systick)
+	{
+		if(LpTim::isRunning() && time > m_Time)
+			m_Metrics.Interrupts += LpTim::Sync(m_Time, time);
+		m_Time = m_Metrics.Time = time;
+		if(systick)
+			SystemTime = (uint32_t)(time / Millisecond + m_SystemTimeOffset);
+	}
+
+	void SimulationClass::At(uint64_t time, HandlerType handler)
+	{
+		m_Events.push(EventStruct { time, m_Order++, 0, handler });
+	}
+
+	void SimulationClass::Every(uint64_t period, HandlerType handler, uint64_t start)
+	{
+		if(period == 0)
+			period = 1;
+		m_Events.push(EventStruct { m_Time + (start == 0 ? period : start), m_Order++, period, handler });
+	}
+
+	void SimulationClass::Busy(uint64_t duration)
+	{
+		setTime(m_Time + duration);
+	}
+
+	void SimulationClass::Work(uint64_t duration)
+	{
+		auto end = m_Time + duration;
+		for(auto due = interruptsDue(); due < end; due = interruptsDue())
+		{
+			if(due > m_Time)
+				setTime(due);
+			auto start = m_Time;
+			interrupts();
+			end += m_Time - start;
+		}
+		setTime(end);
+	}
+
+	void SimulationClass::interrupts()
+	{
+		for(;;)
+		{
+			auto tick = isrTimersDue(), due = eventsDue();
+			if(tick <= m_Time && tick <= due)
+			{
+				// SysTick interrupt: ISR class timers
+				m_Metrics.Interrupts++;
+				Timer::IsrTick();
+				m_Metrics.GpioEdges += Gpio::Sync();
+				continue;
+			}
+			if(due > m_Time)
+				break;
+			auto event = m_Events.top();
+			m_Events.pop();
+			m_Metrics.Interrupts++;
+			event.Handler();
+			m_Metrics.GpioEdges += Gpio::Sync();
+			if(event.Period != 0)
+			{
+				event.Time += event.Period;
+				event.Order = m_Order++;
+				m_Events.push(event);
+			}
+		}
+	}
+
+	void SimulationClass::loop()
+	{
+		Timer::Tick();
+		LpTimer::Tick();
+		Services::ProcessStates();
+		if(m_Loop)
+			m_Loop();
+		m_Metrics.Iterations++;
+		m_Metrics.GpioEdges += Gpio::Sync();
+		// counters wrap: accumulate differences
+		auto timerCallbacks = TimerCallbacks::Counter(), serviceCallbacks = ServiceCallbacks::Counter();
+		m_Metrics.TimerCallbacks += (uint32_t)(timerCallbacks - m_TimerCallbacks);
+		m_Metrics.ServiceCallbacks += (uint32_t)(serviceCallbacks - m_ServiceCallbacks);
+		m_TimerCallbacks = timerCallbacks;
+		m_ServiceCallbacks = serviceCallbacks;
+	}
+
+	bool SimulationClass::pending() const
+	{
+		auto i = 0;
+		for(auto table = Services::ServicesTable::begin(); table < Services::ServicesTable::end(); table++, i++)
+		{
+			auto &state = Services::StatesTable::At(i);
+			if(state.Enabled && (state.ChangedState != 0 || (table->LocalStateChanged != NULL && state.LocalChangedState != 0)))
+				return true;
+		}
+		return false;
+	}
+
+	//! Time of the nearest timer callback of states table, uS
+	template<typename TableType>
+	static uint64_t nearest(uint64_t time)
+	{
+		uint64_t due = UINT64_MAX;
+		auto now = time / Millisecond;
+		for(auto &state : TableType())
+		{
+			if(!state.Enabled)
+				continue;
+			auto delta = (int32_t)(state.TimeStamp - SystemTime);
+			auto callback = (delta <= 0 ? now : now + delta) * Millisecond;
+			if(callback < due)
+				due = callback;
+		}
+		return due;
+	}
+
+	uint64_t SimulationClass::timersDue() const
+	{
+		return nearest<Timer::StatesTable>(m_Time);
+	}
+
+	uint64_t SimulationClass::isrTimersDue() const
+	{
+		auto due = nearest<Timer::IsrStatesTable>(m_Time);
+		return due < m_Time ? m_Time : due;
+	}
+
+	uint64_t SimulationClass::interruptsDue() const
+	{
+		auto tick = isrTimersDue(), due = eventsDue();
+		return tick < due ? tick : due;
+	}
+
+	uint64_t SimulationClass::loopEnd() const
+	{
+		auto due = interruptsDue();
+		if(due < m_Time)
+			due = m_Time;
+		return due < m_Time + m_LoopTime ? due : m_Time + m_LoopTime;
+	}
+
+	void SimulationClass::Run(uint64_t duration)
+	{
+		RunUntil(std::function<bool()>(), duration);
+	}
+
+	bool SimulationClass::RunUntil(std::function<bool()> condition, uint64_t timeout)
+	{
+		auto end = m_Time + timeout;
+		for(;;)
+		{
+			interrupts();
+			loop();
+			if(condition && condition())
+				return true;
+			if(m_Time >= end)
+				return false;
+			// next event: busy loop iteration or sleep until timer or interrupt
+			uint64_t next;
+			bool stop = false;
+			if(pending())
+				next = loopEnd();
+			else
+			{
+				auto lp = LpTim::isRunning();
+				stop = m_StopMode && lp;
+				next = stop ? eventsDue() : interruptsDue();
+				if(!stop && timersDue() < next)
+					next = timersDue();
+				if(lp)
+				{
+					// LPTIM compare of the nearest deadline: wakes from STOP mode, LP timers due in SLEEP mode
+					if(!LpTimer::Suspend())
+						next = m_Time;
+					else if(LpTim::Due(m_Time) < next)
+						next = LpTim::Due(m_Time);
+				}
+				if(next <= m_Time)
+				{
+					next = loopEnd(); // timer of zero interval: busy loop
+					stop = false;
+				}
+				else
+				{
+					auto sleep = (next < end ? next : end) - m_Time;
+					m_Metrics.SleepTime += sleep;
+					m_Metrics.Wakeups++;
+					if(stop)
+						m_Metrics.StopTime += sleep;
+				}
+			}
+			setTime(next < end ? next : end, !stop);
+			if(stop)
+			{
+				// wakeup: firmware corrects SystemTime, SysTick runs from the corrected time
+				LpTimer::Resume();
+				m_SystemTimeOffset = (int64_t)(int32_t)(SystemTime - (uint32_t)(m_Time / Millisecond));
+				auto error = (uint64_t)(m_SystemTimeOffset < 0 ? -m_SystemTimeOffset : m_SystemTimeOffset);
+				if(error > m_Metrics.TimeError)
+					m_Metrics.TimeError = error;
+			}
+		}
+	}
+}
@@ -0,0 +1,186 @@
+/**
+ * Deterministic simulation of the device on host: virtual clock, scripted interrupts & message loop
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Real framework code runs on the virtual clock: message loop (Timer::Tick, Services::ProcessStates) is called
+ * while there is work to do, idle loop jumps the clock to the next event (timer due or scripted interrupt) like WFI.
+ * So hours of device operation take a fraction of second & every run gives the same result: no wall clock, no threads.
+ * Clock is 64-bit, uS; @c SystemTime (mS) follows the clock: SysTick interrupts are not simulated one by one.
+ * Interrupt is the handler called at scripted time between message loop iterations: in order of time, then in order of scheduling.
+ * SysTick interrupt is simulated at times of ISR class timers callbacks (@c Timer::IsrTick), in order with scripted interrupts.
+ * Busy loop iteration (state changes are pending or timer with zero interval) takes @c LoopTime of virtual time
+ * or lasts until interrupt.
+ * Callbacks counts are taken from probe points (Libs/Probe.hpp): simulation build maps them by Simulation/Probes.h.
+ * Low-power timers (Services/LpTimer.h): LPTIM1 counter follows the clock (Simulation/LpTim.hpp). STOP mode (@c setStopMode):
+ * idle loop calls @c LpTimer::Suspend, jumps the clock to LPTIM interrupt or scripted interrupt with @c SystemTime stopped
+ * & calls @c LpTimer::Resume: time of firmware is the corrected one since. SLEEP mode: SysTick runs, mS timers wake the device.
+ * Host only: uses STL.
+ */
+
+/**
+ * @page Simulation
+ * @par Config
+ * CMake: link @c CortexM_Simulation instead of @c CortexM_Timer, @c CortexM_IService, @c CortexM_LpTimer, @c CortexM_Acquisition & @c CortexM_Usb
+ * (framework is compiled with counting probes, @c PROBE_CONFIG is set for all the sources of executable).
+ * @par Usage
+ * @code
+#include "Simulation/Simulation.hpp"
+#include "Simulation/Gpio.hpp"
+
+Simulation::SimulationClass Sim;
+Timer::Init();
+Services::Init();
+Services::Enable(NULL);
+Sim.Every(7 * Simulation::Second, []() { Services::SetLocalState(Services::Button::ServiceName, 1); }); // button ISR
+Sim.At(2 * Simulation::Second, []() { Simulation::Gpio::Input('C', 13, true); });
+Sim.Run(24 * Simulation::Hour);
+auto &metrics = Sim.getMetrics(); // iterations, interrupts, callbacks, GPIO edges
+ * @endcode
+ */
+
+#ifndef SRC_SIMULATION_SIMULATION_HPP_
+#define SRC_SIMULATION_SIMULATION_HPP_
+
+#include <stdint.h>
+#include <functional>
+#include <queue>
+#include <vector>
+
+extern "C"
+{
+	extern volatile uint32_t SystemTime; //!< System time, mS: follows the virtual clock
+}
+
+namespace Simulation
+{
+	static const uint64_t Microsecond = 1;
+	static const uint64_t Millisecond = 1000;
+	static const uint64_t Second = 1000000;
+	static const uint64_t Minute = 60 * Second;
+	static const uint64_t Hour = 60 * Minute;
+
+	typedef std::function<void()> HandlerType;
+
+	//! Metrics of simulated operation
+	struct MetricsStruct
+	{
+		uint64_t Time;				//!< Simulated time, uS
+		uint64_t SleepTime;			//!< Idle time (clock jumps to the next event), uS
+		uint64_t Iterations;		//!< Message loop iterations
+		uint64_t Interrupts;		//!< Interrupts handled: scripted, LPTIM, SysTick of ISR class timers
+		uint64_t TimerCallbacks;	//!< Timer callbacks (Probe::TimerCallback)
+		uint64_t ServiceCallbacks;	//!< Services callbacks (Probe::ServicesCallback)
+		uint64_t GpioEdges;			//!< Output pins changes
+		uint64_t StopTime;			//!< Idle time in STOP mode (part of SleepTime), uS
+		uint64_t Wakeups;			//!< Idle periods: wakeups by timer or interrupt
+		uint64_t TimeError;			//!< Maximum error of SystemTime after STOP mode, mS
+	};
+
+	//! Simulation of the device: virtual clock, interrupts queue & message loop
+	class SimulationClass
+	{
+	protected:
+		//! Scripted interrupt
+		struct EventStruct
+		{
+			uint64_t Time;		//!< Time of handler call, uS
+			uint64_t Order;		//!< Order of scheduling: events of the same time
+			uint64_t Period;	//!< Period, uS; 0 - one shot
+			HandlerType Handler;
+
+			inline bool operator>(const EventStruct &event) const { return Time != event.Time ? Time > event.Time : Order > event.Order; }
+		};
+
+		std::priority_queue<EventStruct, std::vector<EventStruct>, std::greater<EventStruct>> m_Events;
+		uint64_t m_Time;		//!< Virtual clock, uS
+		uint64_t m_Order;		//!< Events scheduled
+		uint64_t m_LoopTime;	//!< Busy loop iteration time, uS
+		HandlerType m_Loop;		//!< Application part of the message loop
+		MetricsStruct m_Metrics;
+		uint32_t m_TimerCallbacks;		//!< Last value of timer callbacks counter
+		uint32_t m_ServiceCallbacks;	//!< Last value of services callbacks counter
+		bool m_StopMode;				//!< Idle loop enters STOP mode: LPTIM is running
+		int64_t m_SystemTimeOffset;		//!< SystemTime minus clock, mS: corrections of LpTimer::Resume
+
+		//! Sets the clock: LPTIM counter & its interrupts follow
+		//! @param systick	True - SystemTime follows the clock; false - SysTick is stopped (STOP mode)
+		void setTime(uint64_t time, bool systick = true);
+
+		//! Calls handlers of due interrupts
+		void interrupts();
+
+		//! Message loop iteration
+		void loop();
+
+		//! @return True - message loop has work to do: states changes are pending
+		bool pending() const;
+
+		//! @return Time of the nearest timer callback, uS; UINT64_MAX - no timers are running
+		uint64_t timersDue() const;
+
+		//! @return Time of the nearest SysTick interrupt of ISR class timers, uS; UINT64_MAX - no timers are running
+		uint64_t isrTimersDue() const;
+
+		//! @return Time of the nearest scripted interrupt, uS; UINT64_MAX - none
+		inline uint64_t eventsDue() const { return m_Events.empty() ? UINT64_MAX : m_Events.top().Time; }
+
+		//! @return Time of the nearest interrupt: scripted or SysTick of ISR class timers, uS
+		uint64_t interruptsDue() const;
+
+		//! @return End of busy loop iteration: interrupt preempts it
+		uint64_t loopEnd() const;
+
+	public:
+
+		//! @param loopTime		Busy loop iteration time, uS: 1..
+		SimulationClass(uint64_t loopTime = 10);
+
+		//! Resets clock, interrupts & metrics
+		void Reset();
+
+		//! Schedules interrupt
+		//! @param time		Simulated time, uS; past time - at next message loop iteration
+		void At(uint64_t time, HandlerType handler);
+
+		//! Schedules interrupt after delay from now
+		inline void After(uint64_t delay, HandlerType handler) { At(m_Time + delay, handler); }
+
+		//! Schedules periodic interrupt
+		//! @param period	Period, uS: 1..
+		//! @param start	Delay of the first interrupt, uS; 0 - one period from now
+		void Every(uint64_t period, HandlerType handler, uint64_t start = 0);
+
+		//! Sets application part of the message loop: called after framework processing of each iteration
+		inline void Loop(HandlerType loop) { m_Loop = loop; }
+
+		//! Sets low-power mode of idle loop
+		//! @param stop		True - STOP mode (when LPTIM is running): SysTick is stopped, LPTIM compare wakes the device;
+		//! false - SLEEP mode
+		inline void setStopMode(bool stop) { m_StopMode = stop; }
+
+		//! Virtual time of blocking operation (FLASH programming e.t.c.): interrupts due are handled after it
+		//! @param duration		Duration, uS
+		void Busy(uint64_t duration);
+
+		//! Virtual time of message loop work: interrupts due are handled at their time (preempt the work),
+		//! time of handlers (@c Busy of handler) extends the work
+		//! @param duration		Duration of work without interrupts, uS
+		void Work(uint64_t duration);
+
+		//! Runs the device
+		//! @param duration		Simulated time, uS
+		void Run(uint64_t duration);
+
+		//! Runs the device until condition is true or time is out
+		//! @param timeout		Simulated time limit, uS
+		//! @return True - condition is true; false - timeout
+		bool RunUntil(std::function<bool()> condition, uint64_t timeout);
+
+		inline uint64_t getTime() const { return m_Time; }
+		inline const MetricsStruct &getMetrics() const { return m_Metrics; }
+	};
+}
+
+#endif /* SRC_SIMULATION_SIMULATION_HPP_ */
@@ -0,0 +1,132 @@
+/**
+ * Simulation: USB host of control endpoint
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Host drives the device (Usb::UsbBase) like USB interrupt does: SETUP packet to @c setupRequest, then IN packets
+ * of control endpoint until answer is sent. Transfers are scripted interrupts of simulation: enumeration after attach
+ * (one request per frame, 1 mS) & requests at scripted time. OUT data of request follows SETUP packet (non-standard requests).
+ */
+
+/**
+ * @page SimulationUsbHost
+ * @par Usage
+ * @code
+#include "Simulation/UsbHost.hpp"
+
+static MyUsbClass Usb; // device: Usb::UsbBase
+static Simulation::UsbHostClass Host(&Sim, &Usb);
+Host.Attach(2 * Simulation::Second); // reset, descriptors, address, configuration
+Sim.Every(Simulation::Minute, []() { Host.Control(0xC0, 0x01, 0, 0, 4); }); // vendor request
+Sim.Run(Simulation::Hour);
+auto configured = Host.getState() == Usb::StateEnum::CONFIGURED;
+ * @endcode
+ */
+
+#ifndef SRC_SIMULATION_USBHOST_HPP_
+#define SRC_SIMULATION_USBHOST_HPP_
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "Libs/UsbBase.hpp"
+#include "Simulation/Simulation.hpp"
+
+namespace Simulation
+{
+	//! USB host of control endpoint
+	class UsbHostClass
+	{
+	protected:
+		//! Protected members of the device: member pointers of base class
+		struct access : Usb::UsbBase
+		{
+			typedef bool (Usb::UsbBase::*OutgoingDataType)(Usb::EndpointStatusStruct*, Usb::DataPointerStruct*);
+			static OutgoingDataType OutgoingData() { return &access::controlEPOutgoingData; }
+			static Usb::StateEnum Usb::UsbBase::*State() { return &access::_state; }
+		};
+
+		SimulationClass *m_Simulation;
+		Usb::UsbBase *m_Device;
+		std::vector<uint8_t> m_Answer;	//!< Answer of last request
+		uint64_t m_Requests;
+		uint64_t m_Stalls;				//!< Requests not supported by device
+		uint64_t m_Packets;				//!< IN packets
+		uint64_t m_BytesIn;
+
+	public:
+		UsbHostClass(SimulationClass *simulation, Usb::UsbBase *device) :
+			m_Simulation(simulation), m_Device(device), m_Requests(0), m_Stalls(0), m_Packets(0), m_BytesIn(0) {}
+
+		//! Control transfer: call from scripted interrupt
+		//! @param out		OUT data of request
+		//! @return Answer length, bytes (@see getAnswer); -1 - request is stalled
+		int Control(uint8_t bmRequestType, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint16_t wLength, const void *out = NULL, unsigned int outLen = 0)
+		{
+			m_Requests++;
+			m_Answer.clear();
+			std::vector<uint8_t> setup(sizeof(Usb::DeviceRequestStruct) + outLen);
+			auto request = (Usb::DeviceRequestStruct*)setup.data();
+			request->bmRequestType = bmRequestType;
+			request->bRequest = bRequest;
+			request->wValue = wValue;
+			request->wIndex = wIndex;
+			request->wLength = wLength;
+			if(outLen != 0)
+				memcpy(&setup[sizeof(Usb::DeviceRequestStruct)], out, outLen);
+			Usb::EndpointStatusStruct ep = { 0, Usb::EndpointStateEnum::WAIT_SETUP };
+			Usb::DataPointerStruct data(setup.data(), setup.size());
+			if(!m_Device->setupRequest(&ep, &data))
+			{
+				m_Stalls++;
+				return -1;
+			}
+			Usb::DataPointerStruct packet;
+			while(m_Answer.size() < wLength && (m_Device->*access::OutgoingData())(&ep, &packet))
+			{
+				m_Answer.insert(m_Answer.end(), packet.Data, packet.Data + packet.Len);
+				m_Packets++;
+				m_BytesIn += packet.Len;
+			}
+			return m_Answer.size();
+		}
+
+		//! Schedules enumeration: bus reset, device descriptor, address, configuration descriptor, configuration
+		//! @param time		Attach time, uS
+		void Attach(uint64_t time, uint8_t address = 1, uint8_t configuration = 1)
+		{
+			const uint8_t in = (uint8_t)Usb::RequestTypeEnum::DIRECTION_DEVICE_TO_HOST;
+			const uint8_t getDescriptor = (uint8_t)Usb::StandardRequestsEnum::GET_DESCRIPTOR;
+			const uint16_t device = (uint16_t)Usb::DescriptorTypesEnum::DEVICE << 8, config = (uint16_t)Usb::DescriptorTypesEnum::CONFIG << 8;
+			m_Simulation->At(time, [this]() { m_Device->reset(); });
+			m_Simulation->At(time + 1 * Millisecond, [this, in, getDescriptor, device]() { Control(in, getDescriptor, device, 0, 64); });
+			m_Simulation->At(time + 2 * Millisecond, [this, address]() { Control(0, (uint8_t)Usb::StandardRequestsEnum::SET_ADDRESS, address, 0, 0); });
+			m_Simulation->At(time + 3 * Millisecond, [this, in, getDescriptor, device]() { Control(in, getDescriptor, device, 0, 18); });
+			m_Simulation->At(time + 4 * Millisecond, [this, in, getDescriptor, config]() { Control(in, getDescriptor, config, 0, 9); });
+			m_Simulation->At(time + 5 * Millisecond, [this, in, getDescriptor, config]()
+			{
+				// wTotalLength of configuration descriptor header
+				uint16_t length = m_Answer.size() >= 4 ? m_Answer[2] | m_Answer[3] << 8 : 9;
+				Control(in, getDescriptor, config, 0, length);
+			});
+			m_Simulation->At(time + 6 * Millisecond, [this, configuration]() { Control(0, (uint8_t)Usb::StandardRequestsEnum::SET_CONFIGURATION, configuration, 0, 0); });
+		}
+
+		//! Schedules control transfer
+		//! @param time		Transfer time, uS
+		void Request(uint64_t time, uint8_t bmRequestType, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint16_t wLength)
+		{
+			m_Simulation->At(time, [=]() { Control(bmRequestType, bRequest, wValue, wIndex, wLength); });
+		}
+
+		inline const std::vector<uint8_t> &getAnswer() const { return m_Answer; }
+		inline Usb::StateEnum getState() const { return m_Device->*access::State(); }
+		inline uint64_t getRequests() const { return m_Requests; }
+		inline uint64_t getStalls() const { return m_Stalls; }
+		inline uint64_t getPackets() const { return m_Packets; }
+		inline uint64_t getBytesIn() const { return m_BytesIn; }
+	};
+}
+
+#endif /* SRC_SIMULATION_USBHOST_HPP_ */
@@ -0,0 +1,54 @@
+/**
+ * Checks of unit tests: failed check is printed with its location, test continues
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Test executable returns @c CHECK_RESULT() from main: exit code 1 - some check failed (ctest regression).
+ * No test framework: tests build with the libraries only.
+ */
+
+/**
+ * @page Check
+ * @par Usage
+ * @code
+#include "Tests/Check.hpp"
+
+int main()
+{
+	CHECK(Sum(2, 2) == 4);
+	return CHECK_RESULT();
+}
+ * @endcode
+ */
+
+#ifndef TESTS_CHECK_HPP_
+#define TESTS_CHECK_HPP_
+
+#include <stdio.h>
+
+namespace CheckDetail
+{
+	//! Count of failed checks of the executable
+	inline unsigned int &Failures()
+	{
+		static unsigned int failures;
+		return failures;
+	}
+
+	inline void check(bool condition, const char *expression, const char *file, int line)
+	{
+		if(condition)
+			return;
+		printf("FAILED: %s:%d: %s\n", file, line, expression);
+		Failures()++;
+	}
+}
+
+//! Checks the condition: failure is printed & counted
+#define CHECK(condition) CheckDetail::check((condition), #condition, __FILE__, __LINE__)
+
+//! Exit code of test: 0 - all the checks passed; 1 - some check failed
+#define CHECK_RESULT() (CheckDetail::Failures() == 0 ? 0 : 1)
+
+#endif /* TESTS_CHECK_HPP_ */
@@ -0,0 +1,113 @@
+/**
+ * Tests of time series codec: round-trip of each order, packing & zigzag combination
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <algorithm>
+#include <vector>
+#include "Tests/Check.hpp"
+#include "Libs/TimeSeriesCodec.hpp"
+
+using namespace System::Codec;
+
+//! Series of values: constant period, random walk (negative deltas), full range & the block boundaries
+static std::vector<std::vector<uint32_t>> series()
+{
+	std::vector<std::vector<uint32_t>> result(5);
+	for(uint32_t i = 0; i < 100; i++)
+		result[0].push_back(1000000 + i * 10);
+	uint32_t value = 500, random = 12345;
+	for(unsigned int i = 0; i < 200; i++)
+	{
+		random = random * 1103515245 + 12345;
+		value += (int32_t)(random >> 16) % 64 - 32;
+		result[1].push_back(value);
+	}
+	result[2] = { 0, 0xFFFFFFFF, 0, 0x80000000, 0x7FFFFFFF, 1, 0xFFFFFFFE };
+	for(uint32_t i = 0; i < BlockLength * 2 + 1; i++)
+		result[3].push_back(i * i * 7);
+	result[4] = { 42 };
+	return result;
+}
+
+static void roundTrip(const std::vector<uint32_t> &values, OptionsStruct options)
+{
+	std::vector<uint8_t> buffer(values.size() * 5 + 16);
+	TimeSeriesEncoderClass encoder(buffer.data(), buffer.size(), options);
+	auto put = true;
+	for(auto value : values)
+		put = encoder.Put(value) && put;
+	CHECK(put);
+	CHECK(encoder.Flush());
+	CHECK(encoder.getCount() == values.size());
+
+	TimeSeriesDecoderClass decoder(buffer.data(), encoder.getLength());
+	CHECK(decoder.getOptions().toByte() == options.toByte());
+	std::vector<uint32_t> decoded(values.size() + 1);
+	CHECK(decoder.Get(decoded.data(), decoded.size()) == values.size());
+	decoded.resize(values.size());
+	CHECK(decoded == values);
+}
+
+//! Buffer is full: accepted values are decoded, rejected value doesn't break the stream
+static void bufferFull(const std::vector<uint32_t> &values, OptionsStruct options)
+{
+	for(size_t size = 1; size < 24; size++)
+	{
+		std::vector<uint8_t> buffer(size);
+		TimeSeriesEncoderClass encoder(buffer.data(), buffer.size(), options);
+		size_t count = 0;
+		while(count < values.size() && encoder.Put(values[count]))
+			count++;
+		CHECK(encoder.Flush());
+		CHECK(encoder.getCount() == count);
+		CHECK(encoder.getLength() <= size);
+
+		TimeSeriesDecoderClass decoder(buffer.data(), encoder.getLength());
+		std::vector<uint32_t> decoded(values.size());
+		CHECK(decoder.Get(decoded.data(), decoded.size()) == count);
+		CHECK(std::equal(decoded.begin(), decoded.begin() + count, values.begin()));
+	}
+}
+
+static void varInt()
+{
+	uint8_t buffer[5];
+	for(uint32_t value : { 0u, 0x7Fu, 0x80u, 0x3FFFu, 0x4000u, 0xFFFFFFFFu })
+	{
+		auto len = VarIntWrite(buffer, sizeof(buffer), value);
+		uint32_t read = 0;
+		CHECK(len >= 1 && len <= 5);
+		CHECK(VarIntRead(buffer, len, read) == len && read == value);
+		CHECK(VarIntRead(buffer, len - 1, read) == 0); // truncated
+	}
+	CHECK(VarIntWrite(buffer, 1, 0x80) == 0);
+	for(uint32_t value : { 0u, 1u, 0xFFFFFFFFu, 0x7FFFFFFFu, 0x80000000u })
+		CHECK(ZigZagDecode(ZigZagEncode(value)) == value);
+	CHECK(ZigZagEncode((uint32_t)-1) == 1 && ZigZagEncode(1) == 2);
+}
+
+int main()
+{
+	varInt();
+	auto values = series();
+	for(uint8_t order = 0; order <= 2; order++)
+		for(auto zigZag : { false, true })
+			for(auto packed : { false, true })
+			{
+				OptionsStruct options(order, zigZag, packed);
+				for(auto &v : values)
+					roundTrip(v, options);
+				bufferFull(values[1], options);
+			}
+	// empty stream: options byte only
+	uint8_t buffer[4];
+	TimeSeriesEncoderClass encoder(buffer, sizeof(buffer), OptionsStruct(2, true, true));
+	CHECK(encoder.Flush() && encoder.getLength() == 1);
+	TimeSeriesDecoderClass decoder(buffer, encoder.getLength());
+	uint32_t value;
+	CHECK(!decoder.Get(value));
+	return CHECK_RESULT();
+}
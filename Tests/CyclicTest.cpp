@@ -0,0 +1,119 @@
+/**
+ * Tests of cyclic executive: frames of the compile-time schedule, release offsets, dispatch order & overruns
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <vector>
+#include "Tests/Check.hpp"
+#include "Services/Cyclic.h"
+
+//! Tasks called by dispatch: index of task per call
+static std::vector<uint32_t> Calls;
+
+CYCLIC_TASK(Current, 1000, 150) { Calls.push_back(0); }
+CYCLIC_TASK(Speed, 5000, 300) { Calls.push_back(1); }
+CYCLIC_TASK(Position, 20000, 400) { Calls.push_back(2); }
+typedef Cyclic::ScheduleClass<Current, Speed, Position> Schedule;
+
+static_assert(Schedule::Count == 3 && Schedule::Minor == 1000 && Schedule::Major == 20000 && Schedule::FramesCount == 20, "frames of harmonic periods");
+static_assert(Schedule::PeakLoad == 550, "Position is released out of Speed frames: peak is not the sum of all WCETs");
+
+// not harmonic periods: releases of both tasks meet in some frame whatever the offsets
+CYCLIC_TASK(Third, 3000, 500) { Calls.push_back(0); }
+CYCLIC_TASK(Quarter, 4000, 500) { Calls.push_back(1); }
+typedef Cyclic::ScheduleClass<Third, Quarter> MixedSchedule;
+
+static_assert(MixedSchedule::Minor == 1000 && MixedSchedule::Major == 12000 && MixedSchedule::FramesCount == 12, "frames of not harmonic periods");
+static_assert(MixedSchedule::PeakLoad == 1000, "peak load fits the minor frame exactly");
+
+//! Busy task: longer than the minor frame
+static uint32_t BusyTime;
+
+CYCLIC_TASK(Busy, 1000, 50)
+{
+	auto start = Profile::Cycles();
+	while(Profile::ToMicroseconds(Profile::Cycles() - start) < BusyTime) {}
+}
+typedef Cyclic::ScheduleClass<Busy> BusySchedule;
+
+//! Frame table: each task is in the frames of its period at its offset; load of frame fits the minor frame
+template<typename SCHEDULE>
+static bool isTable(const uint32_t *periods, const uint32_t *wcets)
+{
+	for(uint32_t frame = 0; frame < SCHEDULE::FramesCount; frame++)
+	{
+		uint32_t load = 0;
+		for(uint32_t task = 0; task < SCHEDULE::Count; task++)
+		{
+			auto period = periods[task] / SCHEDULE::Minor;
+			auto released = (SCHEDULE::Frame(frame) >> task) & 1;
+			if(SCHEDULE::Offset(task) >= period || released != (frame % period == SCHEDULE::Offset(task)))
+				return false;
+			load += released ? wcets[task] : 0;
+		}
+		if(load > SCHEDULE::PeakLoad || SCHEDULE::Frame(frame) >> SCHEDULE::Count != 0)
+			return false;
+	}
+	return true;
+}
+
+static void table()
+{
+	const uint32_t periods[] = { 1000, 5000, 20000 }, wcets[] = { 150, 300, 400 };
+	CHECK(isTable<Schedule>(periods, wcets));
+	CHECK(Schedule::Offset(0) == 0 && Schedule::Offset(1) == 0 && Schedule::Offset(2) == 1);
+	CHECK(Schedule::Frame(0) == 3 && Schedule::Frame(1) == 5 && Schedule::Frame(2) == 1 && Schedule::Frame(5) == 3);
+
+	const uint32_t mixedPeriods[] = { 3000, 4000 }, mixedWcets[] = { 500, 500 };
+	CHECK(isTable<MixedSchedule>(mixedPeriods, mixedWcets));
+}
+
+//! Two major frames: tasks of each frame in declaration order, frame counter wraps
+static void dispatch()
+{
+	Schedule::Init();
+	unsigned int counts[3] = { 0 };
+	bool ordered = true;
+	for(uint32_t i = 0; i < 2 * Schedule::FramesCount; i++)
+	{
+		auto frame = i % Schedule::FramesCount;
+		CHECK(Schedule::getFrame() == frame);
+		Calls.clear();
+		Schedule::Dispatch();
+		uint32_t mask = 0;
+		for(unsigned int c = 0; c < Calls.size(); c++)
+		{
+			ordered = ordered && (c == 0 || Calls[c - 1] < Calls[c]);
+			mask |= 1u << Calls[c];
+			counts[Calls[c]]++;
+		}
+		CHECK(mask == Schedule::Frame(frame));
+	}
+	CHECK(ordered && Schedule::getFrame() == 0);
+	CHECK(counts[0] == 40 && counts[1] == 8 && counts[2] == 2);
+}
+
+static void overrun()
+{
+	BusySchedule::Init();
+	BusyTime = 0;
+	BusySchedule::Dispatch();
+	CHECK(BusySchedule::getOverruns() == 0);
+	BusyTime = 2000;
+	BusySchedule::Dispatch();
+	BusySchedule::Dispatch();
+	CHECK(BusySchedule::getOverruns() == 2);
+	BusySchedule::Init();
+	CHECK(BusySchedule::getOverruns() == 0);
+}
+
+int main()
+{
+	Profile::Init();
+	table();
+	dispatch();
+	overrun();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,90 @@
+/**
+ * Tests of signal processing kernels: SIMD decimation against the scalar reference
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note SIMD kernel is used from 32 samples of output frame: factors below & above it are checked for each channels count.
+ * Full-scale samples of long groups overflow a 16-bit lane unless the sum is split by @c Dsp::LaneAdditions chunks.
+ */
+
+#include <initializer_list>
+#include <vector>
+#include "Tests/Check.hpp"
+#include "Libs/Dsp.hpp"
+
+static const uint16_t FullScale = (1u << DSP_SAMPLE_BITS) - 1;
+static const uint16_t Sentinel = 0xA5A5;
+
+//! Samples of block: random or constant
+static std::vector<uint16_t> blockOf(uint32_t count, bool random, uint16_t value = FullScale)
+{
+	std::vector<uint16_t> block(count);
+	uint32_t seed = count;
+	for(auto &sample : block)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		sample = random ? (uint16_t)((seed >> 16) & FullScale) : value;
+	}
+	return block;
+}
+
+//! Decimate & DecimateScalar give the same frames; nothing is written after the output frames
+static bool isSame(const std::vector<uint16_t> &block, uint32_t channels, uint32_t factor)
+{
+	auto frames = (uint32_t)(block.size() / channels);
+	std::vector<uint16_t> simd(frames * channels + channels, Sentinel), scalar(simd);
+	auto count = Dsp::Decimate(block.data(), frames, channels, factor, simd.data());
+	if(count != frames / factor || Dsp::DecimateScalar(block.data(), frames, channels, factor, scalar.data()) != count)
+		return false;
+	for(auto i = count * channels; i < simd.size(); i++)
+		if(simd[i] != Sentinel)
+			return false;
+	return simd == scalar;
+}
+
+static void decimate()
+{
+	// threshold: factor * channels >= 32; lane overflow: factor * channels > 8 lanes * LaneAdditions
+	const uint32_t factors[] = { 1, 2, 3, 5, 7, 8, 15, 16, 31, 32, 33, 64, 100, 129, 257, 1000 };
+	for(uint32_t channels : { 1, 2, 3, 4, 8 })
+		for(auto factor : factors)
+		{
+			auto samples = (factor * 3 + 1) * channels; // the last frame is not a whole output frame
+			CHECK(isSame(blockOf(samples, true), channels, factor));
+			CHECK(isSame(blockOf(samples, false), channels, factor));
+			CHECK(isSame(blockOf(samples, false, 0), channels, factor));
+		}
+}
+
+//! Full-scale samples: mean is exact whatever the lanes chunks
+static void overflow()
+{
+	const uint32_t factor = 8 * Dsp::LaneAdditions * 4 + 3; // chunks of every lane & the tail
+	for(uint32_t channels : { 1, 2, 4, 8 })
+	{
+		auto block = blockOf(factor * channels * 2, false);
+		std::vector<uint16_t> out(channels * 2, 0);
+		CHECK(Dsp::Decimate(block.data(), factor * 2, channels, factor, out.data()) == 2);
+		CHECK(out == std::vector<uint16_t>(channels * 2, FullScale));
+
+		uint16_t mean[8] = { 0 };
+		Dsp::Average(block.data(), factor * 2, channels, mean);
+		for(uint32_t c = 0; c < channels; c++)
+			CHECK(mean[c] == FullScale);
+	}
+
+	// rounded mean: x.5 rounds up
+	const uint16_t samples[] = { 1, 2, 2, 2 };
+	uint16_t out[2];
+	CHECK(Dsp::Decimate(samples, 2, 2, 2, out) == 1 && out[0] == 2 && out[1] == 2);
+	CHECK(Dsp::Decimate(samples, 4, 1, 2, out) == 2 && out[0] == 2 && out[1] == 2);
+	CHECK(Dsp::Decimate(samples, 4, 0, 2, out) == 0 && Dsp::Decimate(samples, 4, 1, 0, out) == 0);
+}
+
+int main()
+{
+	decimate();
+	overflow();
+	return CHECK_RESULT();
+}
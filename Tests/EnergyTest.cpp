@@ -0,0 +1,152 @@
+/**
+ * Tests of energy accounting: power modes time & charge, peripherals on-time, attribution of callbacks
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Sleep & stop time is given to @c Energy::Exit, on-time of peripherals follows @c SystemTime: both are exact.
+ * Run time is measured by the host clock: checked by bounds. Callbacks attribution is built with @c ENERGY_CONSUMERS
+ * (CMake: -DCORTEXM_ENERGY_CONSUMERS=32) only.
+ */
+
+#include "Tests/Check.hpp"
+#include "Services/Energy.h"
+#include "Services/Timer.h"
+#include "Services/IService.h"
+
+namespace Services
+{
+	namespace Radio
+	{
+		extern const char *ServiceName;
+		SERVICE_DEPENDS(Radio)
+		SERVICE_DECLARE(Radio, NULL, NULL, NULL, NULL)
+	}
+}
+
+ENERGY_PERIPHERAL_DECLARE(Radio, 12000, &Services::Radio::ServiceName)
+ENERGY_PERIPHERAL_DECLARE(Led, 2000, NULL)
+
+TIMER_DECLARE(Busy)
+TIMER_DECLARE(Idle)
+
+//! Busy callback: host clock time, uS
+static const uint32_t BusyTime = 2000;
+
+TIMER_CALLBACK(Busy)
+{
+	auto start = Profile::Cycles();
+	while(Profile::ToMicroseconds(Profile::Cycles() - start) < BusyTime) {}
+}
+
+TIMER_CALLBACK(Idle) {}
+
+static const uint64_t Second = 1000000;
+
+static void modes()
+{
+	SystemTime = 0;
+	Energy::Reset();
+	Energy::Enter(Energy::ModeEnum::Sleep);
+	Energy::Exit(2 * Second);
+	Energy::Enter(Energy::ModeEnum::Stop);
+	Energy::Exit(10 * Second);
+	Energy::ReportStruct report;
+	Energy::Report(report);
+	CHECK(report.Time[(unsigned int)Energy::ModeEnum::Sleep] == 2 * Second && report.Time[(unsigned int)Energy::ModeEnum::Stop] == 10 * Second);
+	auto run = report.Time[(unsigned int)Energy::ModeEnum::Run];
+	CHECK(run < Second && report.Window == run + 12 * Second);
+	CHECK(report.Charge == run * ENERGY_RUN_CURRENT + 2 * Second * ENERGY_SLEEP_CURRENT + 10 * Second * ENERGY_STOP_CURRENT);
+	CHECK(report.AverageCurrent == report.Charge / report.Window && report.BaseCharge <= report.Charge);
+
+	// reset: new window
+	Energy::Reset();
+	Energy::Report(report);
+	CHECK(report.Time[(unsigned int)Energy::ModeEnum::Sleep] == 0 && report.Time[(unsigned int)Energy::ModeEnum::Stop] == 0 && report.Window < Second);
+}
+
+static void peripherals()
+{
+	SystemTime = 1000;
+	Energy::Reset();
+	ENERGY_PERIPHERAL(Radio)->On();
+	ENERGY_PERIPHERAL(Led)->On();
+	SystemTime += 300;
+	ENERGY_PERIPHERAL(Radio)->Off();
+	ENERGY_PERIPHERAL(Radio)->Off(); // already off
+	SystemTime += 200;
+	ENERGY_PERIPHERAL(Radio)->On();
+	ENERGY_PERIPHERAL(Radio)->On(); // already on: on-time continues
+	SystemTime += 100;
+	CHECK(ENERGY_PERIPHERAL(Radio)->getOnTime() == 400 && ENERGY_PERIPHERAL(Led)->getOnTime() == 600);
+
+	// board peripheral: base charge; service peripheral: charge of owner
+	Energy::ReportStruct report;
+	Energy::Report(report);
+	const uint64_t radio = 400 * 1000ull * 12000, led = 600 * 1000ull * 2000;
+	CHECK(report.Charge >= radio + led && report.Charge - report.BaseCharge - radio == report.ActiveTime * ENERGY_RUN_CURRENT);
+	Energy::ConsumerReportStruct consumer;
+	bool found = false;
+	for(unsigned int i = 0; Energy::GetConsumer(i, consumer); i++)
+		if(consumer.Service && consumer.Name == Services::Radio::ServiceName)
+		{
+			found = true;
+			CHECK(consumer.Charge == consumer.ActiveTime * ENERGY_RUN_CURRENT + radio);
+		}
+	CHECK(found);
+
+	// window start: on-time since reset
+	Energy::Reset();
+	SystemTime += 50;
+	CHECK(ENERGY_PERIPHERAL(Radio)->getOnTime() == 50 && ENERGY_PERIPHERAL(Led)->getOnTime() == 50);
+	ENERGY_PERIPHERAL(Radio)->Off();
+	ENERGY_PERIPHERAL(Led)->Off();
+}
+
+//! Callbacks of timers: calls & active time of each timer
+static void consumers()
+{
+	Timer::Init();
+	SystemTime = 0;
+	Energy::Reset();
+	Timer::Start(10, TIMER_STATE(Busy));
+	Timer::Start(10, TIMER_STATE(Idle));
+	for(int i = 0; i < 3; i++)
+	{
+		SystemTime += 10;
+		Timer::Tick();
+	}
+	Energy::ReportStruct report;
+	Energy::Report(report);
+	Energy::ConsumerReportStruct busy = {}, idle = {};
+	Energy::ConsumerReportStruct consumer;
+	unsigned int count = 0;
+	for(; Energy::GetConsumer(count, consumer); count++)
+	{
+		if(consumer.Service)
+			continue;
+		auto state = Timer::TimersTable::At(consumer.Index).State;
+		if(state == TIMER_STATE(Busy))
+			busy = consumer;
+		else if(state == TIMER_STATE(Idle))
+			idle = consumer;
+	}
+	CHECK(count == Timer::TimersTable::size() + Services::ServicesTable::size() && !report.Overflow);
+#ifdef ENERGY_CONSUMERS
+	CHECK(busy.Calls == 3 && idle.Calls == 3);
+	CHECK(busy.ActiveTime >= 3 * BusyTime && idle.ActiveTime < busy.ActiveTime);
+	CHECK(busy.Charge == busy.ActiveTime * ENERGY_RUN_CURRENT && busy.Name == NULL);
+	CHECK(report.ActiveTime >= busy.ActiveTime + idle.ActiveTime && report.ActiveTime <= report.Window);
+#else
+	CHECK(busy.Calls == 0 && idle.Calls == 0 && busy.ActiveTime == 0 && report.ActiveTime == 0);
+#endif
+}
+
+int main()
+{
+	Profile::Init();
+	modes();
+	peripherals();
+	consumers();
+	return CHECK_RESULT();
+}
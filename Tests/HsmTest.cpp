@@ -0,0 +1,140 @@
+/**
+ * Tests of hierarchical state machine: exit & entry order of flat dispatch tables, inherited & guarded transitions, events of state bits
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Actions log: entry of state appends its upper case letter, exit - the lower case letter, transition actions - digits.
+ */
+
+#include <string>
+#include "Tests/Check.hpp"
+#include "Services/Hsm.h"
+
+enum StateEnum : Hsm::StateId { Top, Off, On, Idle, Running, Slow, Fast, Error, StatesCount };
+enum EventEnum : Hsm::EventId { Power, Start, Stop, Speed, Fault, Reset, Restart, EventsCount };
+
+static std::string Log;
+static bool Primed, Recoverable;
+
+template<Hsm::StateId S> static void entry() { Log += (char)('A' + S); }
+template<Hsm::StateId S> static void exit() { Log += (char)('a' + S); }
+static void recover() { Log += '1'; }
+static void report() { Log += '2'; }
+static bool isPrimed() { return Primed; }
+static bool isRecoverable() { return Recoverable; }
+
+static constexpr Hsm::StateStruct States[StatesCount] = {
+	{ Hsm::None, Off, &entry<Top>, &exit<Top> },				// Top
+	{ Top, Hsm::None, &entry<Off>, &exit<Off> },				// Off
+	{ Top, Idle, &entry<On>, &exit<On> },						// On
+	{ On, Hsm::None, &entry<Idle>, &exit<Idle> },				// Idle
+	{ On, Slow, &entry<Running>, &exit<Running> },				// Running
+	{ Running, Hsm::None, &entry<Slow>, &exit<Slow> },			// Slow
+	{ Running, Hsm::None, &entry<Fast>, &exit<Fast> },			// Fast
+	{ Top, Hsm::None, &entry<Error>, NULL },					// Error
+};
+static constexpr Hsm::TransitionStruct Transitions[] = {
+	{ Off, Power, On, NULL, NULL },
+	{ On, Power, Off, NULL, NULL },
+	{ Idle, Start, Running, &isPrimed, NULL },
+	{ Running, Stop, Idle, NULL, NULL },
+	{ Slow, Speed, Fast, NULL, NULL },
+	{ Fast, Speed, Slow, NULL, NULL },
+	{ Running, Fault, Hsm::None, &isRecoverable, &recover },
+	{ On, Fault, Error, NULL, &report },
+	{ Error, Reset, Off, NULL, NULL },
+	{ Running, Restart, Running, NULL, NULL },
+};
+HSM_MACHINE(Machine, States, Transitions, EventsCount)
+
+static const char *SourceName = "Source";
+static const char *OtherName = "Other";
+static constexpr Hsm::BitEventStruct LocalBits[] = { { 0, true, Power }, { 1, true, Start }, { 2, true, Stop }, { 3, true, Speed } };
+static constexpr Hsm::BitEventStruct SourceBits[] = { { 0, true, Fault }, { 0, false, Reset } };
+HSM_BITS(LocalEvents, LocalBits)
+HSM_BITS(SourceEvents, SourceBits)
+
+//! Dispatches event: actions log of the event
+static std::string dispatch(Hsm::EventId event, bool handled = true)
+{
+	Log.clear();
+	if(Machine::Dispatch(event) != handled)
+		return "handled?";
+	return Log;
+}
+
+static void transitions()
+{
+	// not initialized: no events
+	CHECK(Machine::getState() == Hsm::None && dispatch(Power, false) == "");
+
+	Log.clear();
+	Machine::Init();
+	CHECK(Log == "AB" && Machine::getState() == Off);
+
+	// target with initial child: down to the leaf; boundary is Top
+	CHECK(dispatch(Power) == "bCD" && Machine::getState() == Idle);
+	CHECK(dispatch(Stop, false) == "" && dispatch(EventsCount, false) == "" && Machine::getState() == Idle);
+
+	// guard is false: not handled
+	Primed = false;
+	CHECK(dispatch(Start, false) == "" && Machine::getState() == Idle);
+	Primed = true;
+	CHECK(dispatch(Start) == "dEF" && Machine::getState() == Slow);
+
+	// siblings: parent is not exited
+	CHECK(dispatch(Speed) == "fG" && Machine::getState() == Fast);
+	CHECK(Machine::isIn(Fast) && Machine::isIn(Running) && Machine::isIn(On) && Machine::isIn(Top));
+	CHECK(!Machine::isIn(Slow) && !Machine::isIn(Idle) && !Machine::isIn(Off));
+
+	// self transition is external: source is exited & entered again, then its initial child
+	CHECK(dispatch(Restart) == "geEF" && Machine::getState() == Slow);
+
+	// inherited transition of ancestor: exits from the leaf up to Running
+	CHECK(dispatch(Stop) == "feD" && Machine::getState() == Idle);
+	CHECK(dispatch(Start) == "dEF" && dispatch(Speed) == "fG");
+
+	// internal transition: action only; guard is false - the next candidate of ancestor
+	Recoverable = true;
+	CHECK(dispatch(Fault) == "1" && Machine::getState() == Fast);
+	Recoverable = false;
+	CHECK(dispatch(Fault) == "gec2H" && Machine::getState() == Error);
+	CHECK(dispatch(Power, false) == "" && dispatch(Reset) == "B" && Machine::getState() == Off);
+
+	// ancestor's event from the deep leaf
+	CHECK(dispatch(Power) == "bCD" && dispatch(Start) == "dEF");
+	CHECK(dispatch(Power) == "fecB" && Machine::getState() == Off);
+}
+
+//! Events of service state bits: in order of bit index, bits without events are ignored
+static void bits()
+{
+	Log.clear();
+	Machine::Init();
+	Primed = true;
+	Services::StateType local = 0x3 | 0x100;
+	Log.clear();
+	Hsm::LocalStateChanged<Machine, LocalEvents>(NULL, local);
+	CHECK(local == 0 && Log == "bCDdEF" && Machine::getState() == Slow);
+
+	// the other service: ignored; set & cleared bit of the source service - Fault & Reset
+	Recoverable = false;
+	Log.clear();
+	Hsm::StateChanged<Machine, &SourceName, SourceEvents>(OtherName, 1, 1);
+	CHECK(Log == "" && Machine::getState() == Slow);
+	Hsm::StateChanged<Machine, &SourceName, SourceEvents>(SourceName, 1, 1);
+	CHECK(Log == "fec2H" && Machine::getState() == Error);
+	Log.clear();
+	Hsm::StateChanged<Machine, &SourceName, SourceEvents>(SourceName, 0, 1 | 2);
+	CHECK(Log == "B" && Machine::getState() == Off);
+}
+
+int main()
+{
+	CHECK(Machine::StatesCount == StatesCount && Machine::EventsCount == EventsCount);
+	CHECK(Machine::TablesSize >= StatesCount * EventsCount + sizeof(Transitions) / sizeof(*Transitions) * sizeof(Hsm::RouteStruct));
+	transitions();
+	bits();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,98 @@
+/**
+ * Tests of deferred binary logging: message records & trace_decode.py formatting by ELF dictionary
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Dictionary is the test executable itself: decoder reads @c .logstr sections of argv[0].
+ */
+
+#include <string.h>
+#include <string>
+#include "Tests/Check.hpp"
+#include "Tests/Tool.hpp"
+#include "Libs/Log.hpp"
+
+static_assert(LOG_LEVEL == Log::Info, "default log level");
+
+using Trace::Buffer;
+
+//! Message ID & source line of the log call
+struct MessageStruct
+{
+	uint32_t Id;
+	unsigned int Line;
+};
+
+#define LOG_MESSAGE(level, format, ...) LOG(level, format, ##__VA_ARGS__); message = { Log::Hash(_LOG_ENTRY(level, format)), __LINE__ }
+
+static MessageStruct configured, level;
+
+static void records()
+{
+	MessageStruct message;
+	Trace::Init();
+	LOG_MESSAGE(Info, "USB configured: %u mA", 500u);
+	configured = message;
+	LOG_DEBUG("Compiled out: %d", 1);
+	LOG_MESSAGE(Warning, "Level %d, time %lld uS, ratio %.2f", -5, (1LL << 40) + 3, 0.25);
+	level = message;
+	CHECK(Buffer.Header.Head == 4);
+
+	// ID & first argument, then two arguments per data record
+	auto &info = Buffer.Records[0];
+	CHECK(info.getEvent() == Trace::Log + 1 && info.getKind() == Trace::KindEnum::Instant);
+	CHECK(info.Arg0 == configured.Id && info.Arg1 == 500);
+	CHECK(Buffer.Records[1].getEvent() == Trace::Log + 4 && Buffer.Records[1].getKind() == Trace::KindEnum::Instant);
+	CHECK(Buffer.Records[1].Arg0 == level.Id && Buffer.Records[1].Arg1 == (uint32_t)-5);
+	float ratio;
+	memcpy(&ratio, &Buffer.Records[3].Arg0, sizeof(ratio));
+	for(uint32_t i = 2; i < 4; i++)
+		CHECK(Buffer.Records[i].getEvent() == Trace::Log + 4 && Buffer.Records[i].getKind() == Trace::KindEnum::Data);
+	CHECK(Buffer.Records[2].Arg0 == 3 && Buffer.Records[2].Arg1 == 0x100 && ratio == 0.25f && Buffer.Records[3].Arg1 == 0);
+	CHECK(configured.Id != level.Id);
+}
+
+//! Decoder text of message: "<level> <file>:<line>: <text>"
+static bool isDecoded(const std::string &text, const char *levelName, const MessageStruct &message, const char *formatted)
+{
+	auto location = std::string("LogTest.cpp:") + std::to_string(message.Line) + ": " + formatted + "\n";
+	auto found = text.find(location);
+	if(found == std::string::npos)
+		return false;
+	auto line = text.rfind('\n', found);
+	line = line == std::string::npos ? 0 : line + 1;
+	return text.compare(line + 15, strlen(levelName), levelName) == 0;
+}
+
+static void decode(const char *elf)
+{
+	// message torn by dump: data records are not committed
+	auto index = Trace::Reserve(2);
+	Trace::Write(index, Trace::Log + 3, (uint8_t)Trace::KindEnum::Instant, 0, level.Id, 1);
+	CHECK(Tool::Write("log.bin", &Buffer, sizeof(Buffer)));
+	if(!Tool::isAvailable())
+		return;
+
+	std::string text;
+	CHECK(Tool::Run(std::string("trace_decode.py log.bin --text --elf ") + elf, text));
+	CHECK(isDecoded(text, "Info", configured, "USB configured: 500 mA"));
+	CHECK(isDecoded(text, "Warning", level, "Level -5, time 1099511627779 uS, ratio 0.25"));
+	size_t count = 0;
+	for(auto c : text)
+		count += c == '\n';
+	CHECK(count == 2);
+
+	// without dictionary: message ID & words
+	CHECK(Tool::Run("trace_decode.py log.bin --text", text));
+	char words[64];
+	snprintf(words, sizeof(words), "message 0x%X: 0x000001F4", configured.Id);
+	CHECK(text.find(words) != std::string::npos);
+}
+
+int main(int, char *argv[])
+{
+	records();
+	decode(argv[0]);
+	return CHECK_RESULT();
+}
@@ -0,0 +1,121 @@
+/**
+ * Tests of low-power timer domain: extended counter over LPTIM overflows, timers across the counter wrap
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note LPTIM registers are the host peripheral memory: test steps the counter, raises the overflow flag at ARR match
+ * & calls the interrupt handler (or not: masked interrupts, higher priority caller). Handler clears the flag by ICR
+ * on target, so the test clears ISR after the handler.
+ */
+
+#include "Tests/Check.hpp"
+#include "stm32l0xx.h"
+#include "Services/LpTimer.h"
+
+LPTIMER_DECLARE(Sample)
+
+static unsigned int SampleCalls;
+
+TIMER_CALLBACK(Sample) { SampleCalls++; }
+
+//! Ticks of the counter since Init
+static uint64_t Elapsed;
+
+//! Pending interrupt is served
+static void serve()
+{
+	if(LPTIM1->ISR & LPTIM_ISR_ARRM)
+	{
+		LPTIM1_IRQHandler();
+		LPTIM1->ISR &= ~LPTIM_ISR_ARRM;
+	}
+}
+
+//! Counter steps: ARR match sets the overflow flag; interrupt is served at once if it is not masked
+static void advance(uint32_t ticks, bool masked = false)
+{
+	for(; ticks > 0; ticks--)
+	{
+		Elapsed++;
+		LPTIM1->CNT = (LPTIM1->CNT + 1) & 0xFFFF;
+		if(LPTIM1->CNT == 0xFFFF)
+			LPTIM1->ISR |= LPTIM_ISR_ARRM;
+		if(!masked)
+			serve();
+	}
+}
+
+static void init()
+{
+	LpTimer::Init();
+	LPTIM1->ISR = 0;
+	Elapsed = 0;
+}
+
+static void overflow()
+{
+	init();
+	CHECK(LpTimer::Ticks() == 0);
+	advance(0xFFFE);
+	CHECK(LpTimer::Ticks() == 0xFFFE);
+
+	// ARR match: flag is pending, then the overflow is counted by interrupt; the same tick both ways
+	advance(1, true);
+	CHECK(LPTIM1->CNT == 0xFFFF && LpTimer::Ticks() == 0xFFFF);
+	serve();
+	CHECK(LpTimer::Ticks() == 0xFFFF);
+	advance(1);
+	CHECK(LpTimer::Ticks() == 0x10000);
+
+	// interrupt is masked over the wrap: pending flag is the overflow
+	advance(0xFFFF - 10);
+	for(unsigned int i = 0; i < 20; i++)
+	{
+		advance(1, true);
+		CHECK(LpTimer::Ticks() == Elapsed);
+	}
+	serve();
+	CHECK(LpTimer::Ticks() == Elapsed && Elapsed == 0x20009);
+
+	// extended counter is monotonic & exact over many periods
+	bool exact = true;
+	for(unsigned int i = 0; i < 5 * 0x10000 / 997; i++)
+	{
+		advance(997, i % 3 == 0);
+		exact = exact && LpTimer::Ticks() == Elapsed;
+		serve();
+		exact = exact && LpTimer::Ticks() == Elapsed;
+	}
+	CHECK(exact && Elapsed > 6 * 0x10000);
+	CHECK(LpTimer::Now() == (uint32_t)(Elapsed * 1000 / LpTimer::Frequency));
+}
+
+//! Timer due after the counter wrap: called once at the deadline
+static void timers()
+{
+	init();
+	advance(0x10000 - LpTimer::Frequency / 10); // 100 mS before the wrap
+	SampleCalls = 0;
+	LpTimer::Start(200, TIMER_STATE(Sample));
+	auto deadline = LpTimer::Now() + 200;
+	while(LpTimer::Now() < deadline - 1)
+	{
+		advance(1);
+		LpTimer::Tick();
+	}
+	CHECK(SampleCalls == 0 && Elapsed > 0x10000);
+	while(LpTimer::Now() < deadline)
+		advance(1);
+	LpTimer::Tick();
+	LpTimer::Tick();
+	CHECK(SampleCalls == 1 && LpTimer::Next() == 200);
+	LpTimer::Stop(TIMER_STATE(Sample));
+}
+
+int main()
+{
+	overflow();
+	timers();
+	return CHECK_RESULT();
+}
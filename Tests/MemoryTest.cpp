@@ -0,0 +1,124 @@
+/**
+ * Tests of static memory: fixed-block pool & monotonic arena
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <stdint.h>
+#include "Tests/Check.hpp"
+#include "Libs/Pool.hpp"
+#include "Libs/Arena.hpp"
+
+static const unsigned int BlocksCount = 8;
+
+POOL_DECLARE(Blocks, 20, BlocksCount)
+POOL_DECLARE(Small, 1, 2)
+
+struct ObjectStruct
+{
+	static unsigned int Alive;
+	double Value;
+	ObjectStruct(double value) : Value(value) { Alive++; }
+	~ObjectStruct() { Alive--; }
+};
+unsigned int ObjectStruct::Alive;
+
+static void pool()
+{
+	auto pool = POOL(Blocks);
+	CHECK(pool->getBlockSize() == System::PoolClass::BlockSize(20) && pool->getBlockSize() % System::PoolClass::Alignment == 0);
+	CHECK(POOL(Small)->getBlockSize() == System::PoolClass::Alignment);
+
+	// all the blocks are distinct & aligned, then exhaustion
+	void *blocks[BlocksCount];
+	for(unsigned int i = 0; i < BlocksCount; i++)
+	{
+		blocks[i] = pool->Alloc();
+		CHECK(blocks[i] != NULL && pool->Contains(blocks[i]));
+		CHECK((uintptr_t)blocks[i] % System::PoolClass::Alignment == 0);
+		for(unsigned int j = 0; j < i; j++)
+			CHECK(blocks[i] != blocks[j]);
+	}
+	CHECK(pool->getUsed() == BlocksCount && pool->getFailures() == 0);
+	CHECK(pool->Alloc() == NULL);
+	CHECK(pool->getFailures() == 1 && pool->getHighWater() == BlocksCount);
+
+	// freed blocks are reused: the last freed is the first allocated
+	CHECK(pool->Free(blocks[2]) && pool->Free(blocks[5]));
+	CHECK(pool->getUsed() == BlocksCount - 2);
+	CHECK(pool->Alloc() == blocks[5] && pool->Alloc() == blocks[2]);
+	CHECK(pool->Alloc() == NULL && pool->getFailures() == 2);
+
+	// foreign & not block start pointers are rejected
+	int local;
+	CHECK(!pool->Free(&local) && !pool->Free((uint8_t*)blocks[0] + 1));
+	CHECK(!pool->Contains(POOL(Small)->Alloc()));
+	CHECK(pool->Free(NULL));
+
+	for(auto block : blocks)
+		CHECK(pool->Free(block));
+	CHECK(pool->getUsed() == 0 && pool->getHighWater() == BlocksCount);
+	pool->ResetHighWater();
+	CHECK(pool->getHighWater() == 0);
+
+	// objects: constructed in block, destructed by delete; type bigger than block is rejected
+	auto object = pool->New<ObjectStruct>(2.5);
+	CHECK(object != NULL && object->Value == 2.5 && ObjectStruct::Alive == 1);
+	pool->Delete(object);
+	CHECK(ObjectStruct::Alive == 0 && pool->getUsed() == 0);
+	struct BigStruct { uint8_t Data[64]; };
+	CHECK(pool->New<BigStruct>() == NULL);
+
+	// pools table: both pools are registered
+	unsigned int pools = 0;
+	for(auto &p : System::PoolsTable())
+		if(&p == POOL(Blocks) || &p == POOL(Small))
+			pools++;
+	CHECK(pools == 2);
+}
+
+static void arena()
+{
+	static System::ArenaBufferClass<128> arena;
+	CHECK(arena.getSize() == 128 && arena.getUsed() == 0);
+
+	auto a = (uint8_t*)arena.Allocate(3, 1);
+	auto b = arena.Allocate(8, 8);
+	CHECK(a != NULL && b != NULL && (uintptr_t)b % 8 == 0 && (uint8_t*)b >= a + 3);
+	CHECK(arena.getUsed() == 16);
+
+	// mark & reset: memory after the mark is allocated again
+	auto mark = arena.getMark();
+	auto c = arena.Allocate(32);
+	CHECK(c != NULL && arena.getUsed() == mark + 32);
+	arena.Reset(mark);
+	CHECK(arena.getUsed() == mark && arena.Allocate(32) == c);
+	arena.Reset(arena.getUsed() + 10); // mark after the usage: nothing is changed
+	CHECK(arena.getUsed() == mark + 32);
+
+	// full arena: allocation fails, usage is not changed
+	CHECK(arena.Allocate(128) == NULL && arena.getFailures() == 1 && arena.getUsed() == mark + 32);
+	CHECK(arena.Allocate(128 - arena.getUsed()) != NULL && arena.getUsed() == 128);
+	CHECK(arena.Allocate(1, 1) == NULL && arena.getFailures() == 2);
+	CHECK(arena.getHighWater() == 128);
+
+	// scope: released at exit
+	arena.Reset();
+	CHECK(arena.getUsed() == 0);
+	{
+		System::ArenaClass::ScopeClass scope(arena);
+		auto object = arena.New<ObjectStruct>(1.5);
+		CHECK(object != NULL && object->Value == 1.5 && (uintptr_t)object % alignof(ObjectStruct) == 0);
+		CHECK(arena.getUsed() == sizeof(ObjectStruct));
+		object->~ObjectStruct();
+	}
+	CHECK(arena.getUsed() == 0 && arena.getHighWater() == 128);
+}
+
+int main()
+{
+	pool();
+	arena();
+	return CHECK_RESULT();
+}
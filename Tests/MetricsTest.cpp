@@ -0,0 +1,128 @@
+/**
+ * Tests of metrics: updates, binary export (schema, full & delta snapshots) & metrics_decode.py round-trip
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include "Tests/Check.hpp"
+#include "Tests/Tool.hpp"
+#include "Libs/Metrics.hpp"
+
+METRICS_COUNTER(test_requests_total)
+METRICS_GAUGE(test_queue_depth)
+METRICS_HISTOGRAM(test_duration_us, 100, 1000)
+
+using System::Codec::VarIntRead;
+using System::Codec::ZigZagDecode;
+
+//! Exported snapshot: header fields & values
+struct SnapshotStruct
+{
+	uint8_t Kind, Version;
+	uint16_t Sequence;
+	uint32_t Hash;
+	std::vector<uint32_t> Values;
+};
+
+static SnapshotStruct parse(const uint8_t *data, size_t len)
+{
+	SnapshotStruct snapshot = { data[0], data[1], (uint16_t)(data[2] | data[3] << 8), (uint32_t)(data[4] | data[5] << 8 | data[6] << 16 | (uint32_t)data[7] << 24), {} };
+	for(size_t offset = Metrics::HeaderSize; offset < len;)
+	{
+		uint32_t value;
+		auto read = VarIntRead(data + offset, len - offset, value);
+		if(read == 0)
+			break;
+		snapshot.Values.push_back(value);
+		offset += read;
+	}
+	return snapshot;
+}
+
+static void update()
+{
+	METRIC(test_requests_total)->Add();
+	METRIC(test_requests_total)->Add(4);
+	METRIC(test_queue_depth)->Set(-3);
+	for(auto value : { 50u, 100u, 500u, 5000u }) // bound is inclusive
+		METRIC(test_duration_us)->Observe(value);
+	CHECK(METRIC(test_requests_total)->Get() == 5 && (int32_t)METRIC(test_queue_depth)->Get() == -3);
+	CHECK(METRIC(test_duration_us)->size() == 4);
+	CHECK(METRIC(test_duration_us)->Get(0) == 2 && METRIC(test_duration_us)->Get(1) == 1 && METRIC(test_duration_us)->Get(2) == 1);
+	CHECK(METRIC(test_duration_us)->Get(3) == 5650);
+}
+
+static uint8_t Schema[128], Full[64], Delta[64], Gap[64];
+static size_t SchemaLen, FullLen, DeltaLen, GapLen;
+
+static void exports()
+{
+	// schema: type, buckets count, name length, name, bounds
+	SchemaLen = Metrics::Export(Metrics::ExportEnum::Schema, Schema, sizeof(Schema));
+	const uint8_t histogram[] = { 3, 2, 16, 't', 'e', 's', 't', '_', 'd', 'u', 'r', 'a', 't', 'i', 'o', 'n', '_', 'u', 's', 100, 0, 0, 0, 0xE8, 0x03, 0, 0 };
+	CHECK(SchemaLen == Metrics::HeaderSize + 3 + 19 + 3 + 16 + sizeof(histogram));
+	CHECK(Schema[0] == (uint8_t)Metrics::ExportEnum::Schema && Schema[8] == 1 && Schema[9] == 0 && Schema[10] == 19);
+	CHECK(memcmp(Schema + SchemaLen - sizeof(histogram), histogram, sizeof(histogram)) == 0);
+
+	// full: absolute values; sequence of snapshots, not of schema
+	FullLen = Metrics::Export(Metrics::ExportEnum::Full, Full, sizeof(Full));
+	auto full = parse(Full, FullLen);
+	CHECK(full.Kind == (uint8_t)Metrics::ExportEnum::Full && full.Version == Metrics::Version && full.Sequence == 1);
+	CHECK(full.Hash == Metrics::SchemaHash() && parse(Schema, Metrics::HeaderSize).Hash == full.Hash);
+	CHECK(full.Values == (std::vector<uint32_t>{ 5, 0xFFFFFFFD, 2, 1, 1, 5650 }));
+
+	// delta: zigzag of differences
+	METRIC(test_requests_total)->Add(1000);
+	METRIC(test_queue_depth)->Set(4);
+	METRIC(test_duration_us)->Observe(2000);
+	DeltaLen = Metrics::Export(Metrics::ExportEnum::Delta, Delta, sizeof(Delta));
+	auto delta = parse(Delta, DeltaLen);
+	CHECK(delta.Kind == (uint8_t)Metrics::ExportEnum::Delta && delta.Sequence == 2);
+	CHECK(delta.Values.size() == 6 && ZigZagDecode(delta.Values[0]) == 1000 && ZigZagDecode(delta.Values[1]) == 7);
+	CHECK(delta.Values[2] == 0 && delta.Values[3] == 0 && ZigZagDecode(delta.Values[4]) == 1 && ZigZagDecode(delta.Values[5]) == 2000);
+	CHECK(DeltaLen == Metrics::HeaderSize + 2 + 1 + 1 + 1 + 1 + 2); // about one byte per value
+
+	// buffer is too small: no export, sequence gap
+	CHECK(Metrics::Export(Metrics::ExportEnum::Full, Gap, Metrics::HeaderSize - 1) == 0);
+	CHECK(Metrics::Export(Metrics::ExportEnum::Delta, Gap, Metrics::HeaderSize + 1) == 0);
+	CHECK(Metrics::sequence() == 3);
+	METRIC(test_requests_total)->Add();
+	GapLen = Metrics::Export(Metrics::ExportEnum::Delta, Gap, sizeof(Gap));
+	CHECK(parse(Gap, GapLen).Sequence == 4);
+}
+
+static void decode()
+{
+	CHECK(Tool::Write("schema.bin", Schema, SchemaLen) && Tool::Write("full.bin", Full, FullLen));
+	CHECK(Tool::Write("delta.bin", Delta, DeltaLen) && Tool::Write("gap.bin", Gap, GapLen));
+	if(!Tool::isAvailable())
+		return;
+
+	std::string text;
+	CHECK(Tool::Run("metrics_decode.py schema.bin full.bin delta.bin", text));
+	CHECK(text ==
+		"# TYPE test_requests_total counter\n"
+		"test_requests_total 1005\n"
+		"# TYPE test_queue_depth gauge\n"
+		"test_queue_depth 4\n"
+		"# TYPE test_duration_us histogram\n"
+		"test_duration_us_bucket{le=\"100\"} 2\n"
+		"test_duration_us_bucket{le=\"1000\"} 3\n"
+		"test_duration_us_bucket{le=\"+Inf\"} 5\n"
+		"test_duration_us_sum 7650\n"
+		"test_duration_us_count 5\n");
+	// sequence gap: exit code 2, values of the last applied snapshot
+	CHECK(!Tool::Run("metrics_decode.py schema.bin full.bin delta.bin gap.bin", text) && text.find("test_requests_total 1005\n") != std::string::npos);
+}
+
+int main()
+{
+	update();
+	exports();
+	decode();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,123 @@
+/**
+ * Tests of probe points: pin, pins code, cycles statistics & counter mappings
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note GPIO ports are the host peripheral memory: the last BSRR/BRR store of probe is read back.
+ */
+
+#include <string.h>
+#include "Tests/Check.hpp"
+#include "stm32l0xx.h"
+#include "pin.h"
+#include "Libs/Probe.hpp"
+
+enum
+{
+	PinPoint = Probe::User,
+	LowPinPoint,
+	CodePoint,
+	OtherCodePoint,
+	ProfilePoint,
+	CountPoint,
+	NotMappedPoint,
+};
+
+typedef PinList<Pin<'B', 4>, Pin<'B', 5>, Pin<'B', 6>, Pin<'B', 7>> CodePins;
+
+PROBE_PIN(PinPoint, Pin<'A', 5>)
+PROBE_PIN(LowPinPoint, Pin<'A', 6, 'L'>)
+PROBE_CODE(CodePoint, CodePins)
+PROBE_CODE(OtherCodePoint, CodePins)
+PROBE_PROFILE(ProfilePoint)
+PROBE_COUNT(CountPoint)
+
+//! Clears the registers of the last stores
+static void clear()
+{
+	GPIOA->BSRR = GPIOA->BRR = 0;
+	GPIOB->BSRR = GPIOB->BRR = 0;
+}
+
+static void pin()
+{
+	clear();
+	PROBE_ENTER(PinPoint);
+	CHECK(GPIOA->BSRR == 1UL << 5);
+	PROBE_EXIT(PinPoint);
+	CHECK(GPIOA->BRR == 1UL << 5);
+
+	// active low: entry resets the pin
+	clear();
+	{
+		PROBE_SCOPE(LowPinPoint);
+		CHECK(GPIOA->BRR == 1UL << 6 && GPIOA->BSRR == 0);
+	}
+	CHECK(GPIOA->BSRR == 1UL << 6);
+}
+
+static void code()
+{
+	// code of point is point + 1 on pins PB4..PB7: one store sets & resets the pins
+	const uint32_t mask = 0xFUL << 4;
+	auto codeOf = [mask](uint32_t code) { return (code << 4 & mask) | (~(code << 4) & mask) << 16; };
+	clear();
+	{
+		PROBE_SCOPE(CodePoint);
+		CHECK(GPIOB->BSRR == codeOf(CodePoint + 1));
+	}
+	CHECK(GPIOB->BSRR == mask << 16);
+	PROBE_ENTER(OtherCodePoint);
+	CHECK(GPIOB->BSRR == codeOf(OtherCodePoint + 1) && GPIOB->BSRR != codeOf(CodePoint + 1));
+	PROBE_EXIT(OtherCodePoint);
+	CHECK(GPIOB->BSRR == mask << 16 && GPIOA->BSRR == 0);
+}
+
+static void profile()
+{
+	auto &site = Probe::ProfileProbe<ProfilePoint>::Site();
+	CHECK(site.Count == 0 && strcmp(site.Name, "ProfilePoint") == 0);
+	for(int i = 0; i < 3; i++)
+	{
+		PROBE_SCOPE(ProfilePoint);
+		auto start = Profile::Cycles();
+		while(Profile::Cycles() - start < 1000) {}
+	}
+	CHECK(site.Count == 3 && site.Min >= 1000 && site.Min <= site.Max && site.Total >= 3000);
+
+	// the site is in the profile sites table
+	unsigned int found = 0;
+	for(auto &entry : Profile::SitesTable())
+		found += &entry == &site;
+	CHECK(found == 1);
+}
+
+static void count()
+{
+	auto &counter = Probe::CounterProbe<CountPoint>::Counter();
+	CHECK(counter == 0);
+	for(int i = 0; i < 5; i++)
+	{
+		PROBE_SCOPE(CountPoint);
+	}
+	PROBE_ENTER(CountPoint);
+	PROBE_EXIT(CountPoint);
+	CHECK(counter == 6);
+
+	// not mapped point: no stores
+	clear();
+	{
+		PROBE_SCOPE(NotMappedPoint);
+	}
+	CHECK(GPIOA->BSRR == 0 && GPIOA->BRR == 0 && GPIOB->BSRR == 0 && GPIOB->BRR == 0);
+}
+
+int main()
+{
+	pin();
+	code();
+	profile();
+	count();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,133 @@
+/**
+ * Tests of services dependencies: SERVICE_DEPENDS levels, enable & disable order
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Services are declared in reverse order of dependencies: enable order is made by levels, not by link order.
+ */
+
+#include <string.h>
+#include <mutex>
+#include <vector>
+#include "Tests/Check.hpp"
+#include "Services/IService.h"
+
+//! Enable & disable callbacks order: names of services
+static std::vector<const char*> Calls;
+static std::mutex CallsMutex;
+
+//! Enable callback of the service fails
+static const char *Failing;
+
+namespace Services
+{
+	namespace Test
+	{
+		static bool Enable(const char *name, bool)
+		{
+			std::lock_guard<std::mutex> lock(CallsMutex);
+			Calls.push_back(name);
+			return name != Failing;
+		}
+	}
+
+	// Base <- Middle <- Top, Base & Other <- Wide; Other: no dependencies
+	namespace Base { extern const char *ServiceName; SERVICE_DEPENDS(Base) }
+	namespace Other { extern const char *ServiceName; SERVICE_DEPENDS(Other) }
+	namespace Middle { extern const char *ServiceName; SERVICE_DEPENDS(Middle, Base) }
+	namespace Wide { extern const char *ServiceName; SERVICE_DEPENDS(Wide, Other, Base) }
+	namespace Top { extern const char *ServiceName; SERVICE_DEPENDS(Top, Middle) }
+
+	static_assert(Base::Level == 0 && Other::Level == 0 && Middle::Level == 1 && Wide::Level == 1 && Top::Level == 2, "levels of dependencies");
+
+	namespace Top { SERVICE_DECLARE(Top, &Test::Enable, NULL, NULL, NULL) }
+	namespace Wide { SERVICE_DECLARE(Wide, &Test::Enable, NULL, NULL, NULL) }
+	namespace Middle { SERVICE_DECLARE(Middle, &Test::Enable, NULL, NULL, NULL) }
+	namespace Other { SERVICE_DECLARE(Other, &Test::Enable, NULL, NULL, NULL) }
+	namespace Base { SERVICE_DECLARE(Base, &Test::Enable, NULL, NULL, NULL) }
+}
+
+using namespace Services;
+
+static unsigned int positionOf(const char *name)
+{
+	for(unsigned int i = 0; i < Calls.size(); i++)
+		if(Calls[i] == name)
+			return i;
+	return Calls.size();
+}
+
+//! Each dependency is called before (enable) or after (disable) its dependents
+static bool isOrdered(bool enable)
+{
+	auto before = [enable](const char *dependency, const char *dependent)
+	{
+		auto d = positionOf(dependency), s = positionOf(dependent);
+		return d < Calls.size() && s < Calls.size() && (enable ? d < s : d > s);
+	};
+	return Calls.size() == 5 && before(Base::ServiceName, Middle::ServiceName) && before(Middle::ServiceName, Top::ServiceName)
+		&& before(Base::ServiceName, Wide::ServiceName) && before(Other::ServiceName, Wide::ServiceName);
+}
+
+static bool isAll(bool enabled)
+{
+	for(auto name : { Base::ServiceName, Other::ServiceName, Middle::ServiceName, Wide::ServiceName, Top::ServiceName })
+		if(Services::isEnabled(name) != enabled)
+			return false;
+	return true;
+}
+
+//! All the services by @c enable callback: serial or parallel
+static void all(bool (*enable)(bool))
+{
+	Services::Init();
+	Calls.clear();
+	CHECK(enable(true) && isAll(true));
+	CHECK(isOrdered(true));
+	Calls.clear();
+	CHECK(enable(true) && Calls.empty()); // enabled services are not enabled again
+	CHECK(enable(false) && isAll(false));
+	CHECK(isOrdered(false));
+}
+
+static void single()
+{
+	Services::Init();
+	Calls.clear();
+	// dependencies are not enabled
+	CHECK(!Services::Enable(Top::ServiceName) && !Services::isEnabled(Top::ServiceName));
+	CHECK(Services::Enable(Base::ServiceName) && Services::Enable(Middle::ServiceName) && Services::Enable(Top::ServiceName));
+	CHECK(Services::isEnabled(Top::ServiceName) && !Services::isEnabled(Wide::ServiceName));
+	CHECK(!Services::Enable(Wide::ServiceName)); // Other is not enabled
+
+	// dependents are not disabled
+	CHECK(!Services::Enable(Base::ServiceName, false) && Services::isEnabled(Base::ServiceName));
+	CHECK(Services::Enable(Top::ServiceName, false) && Services::Enable(Middle::ServiceName, false) && Services::Enable(Base::ServiceName, false));
+	CHECK(isAll(false));
+	CHECK(!Services::Enable("Unknown"));
+}
+
+static void failure()
+{
+	// failed service: its dependents are not enabled, the other services are
+	Services::Init();
+	Failing = Middle::ServiceName;
+	Calls.clear();
+	CHECK(!Services::Enable(NULL));
+	CHECK(!Services::isEnabled(Middle::ServiceName) && !Services::isEnabled(Top::ServiceName));
+	CHECK(Services::isEnabled(Base::ServiceName) && Services::isEnabled(Other::ServiceName) && Services::isEnabled(Wide::ServiceName));
+	CHECK(positionOf(Top::ServiceName) == Calls.size());
+	Failing = NULL;
+	CHECK(Services::Enable(NULL) && isAll(true));
+	CHECK(Services::Enable(NULL, false) && isAll(false));
+}
+
+int main()
+{
+	all([](bool enable) { return Services::Enable(NULL, enable); });
+	all([](bool enable) { return Services::EnableParallel(enable); });
+	single();
+	failure();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,163 @@
+/**
+ * Tests of software PWM: schedule of edges, merged port stores, glitch-free duty commit, 0% & 100% duty
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note GPIO ports are the host peripheral memory: test applies each BSRR store to the simulated output after interrupt.
+ * Two stores to one port in one interrupt would lose the first one: merged stores are checked by the outputs too.
+ */
+
+#include <initializer_list>
+#include "Tests/Check.hpp"
+#include "stm32l0xx.h"
+#include "pin.h"
+#include "Libs/SoftPwm.hpp"
+
+static const unsigned int Channels = 6;
+static const uint16_t Period = 1000;
+
+//! Schedule access of the test
+class TestPwmClass : public System::Pwm::SoftPwmClass<Channels>
+{
+public:
+	using SoftPwmClass::SoftPwmClass;
+	using SoftPwmClass::ScheduleStruct;
+
+	inline const ScheduleStruct &front() const { return *m_Front; }
+};
+
+static TestPwmClass Pwm(Period);
+
+//! Channels: pins of two ports, active-high & active-low
+typedef Pin<'A', 0> Channel0;
+typedef Pin<'A', 1> Channel1;
+typedef Pin<'B', 3, 'L'> Channel2;
+typedef Pin<'A', 2> Channel3;
+typedef Pin<'B', 4> Channel4;
+typedef Pin<'A', 3> Channel5;
+
+static const GPIO_TypeDef *Ports[] = { GPIOA, GPIOB };
+static const struct { unsigned int Port, Bit; bool ActiveLow; } Outputs[Channels] = { { 0, 0, false }, { 0, 1, false }, { 1, 3, true }, { 0, 2, false }, { 1, 4, false }, { 0, 3, false } };
+
+//! Simulated output of ports: BSRR stores applied
+static uint32_t Odr[2];
+
+//! Runs one period of interrupts
+//! @param onTime	Active time of channels, timer ticks
+//! @param atHalf	Called at the first interrupt after half of period
+template<typename CALLBACK>
+static bool period(uint32_t (&onTime)[Channels], CALLBACK atHalf)
+{
+	uint32_t time = 0;
+	bool called = false;
+	for(auto &value : onTime)
+		value = 0;
+	while(time < Period)
+	{
+		if(!called && time >= Period / 2)
+		{
+			atHalf();
+			called = true;
+		}
+		for(auto port : Ports)
+			const_cast<GPIO_TypeDef*>(port)->BSRR = 0;
+		auto next = Pwm.Interrupt();
+		for(unsigned int p = 0; p < 2; p++)
+		{
+			auto bsrr = Ports[p]->BSRR;
+			Odr[p] = (Odr[p] & ~(bsrr >> 16)) | (bsrr & 0xFFFF);
+		}
+		if(next == 0)
+			return false;
+		for(unsigned int i = 0; i < Channels; i++)
+			if(((Odr[Outputs[i].Port] >> Outputs[i].Bit) & 1) != Outputs[i].ActiveLow)
+				onTime[i] += next;
+		time += next;
+	}
+	return time == Period;
+}
+
+static bool period(uint32_t (&onTime)[Channels])
+{
+	return period(onTime, [] {});
+}
+
+static bool isOnTime(const uint32_t (&onTime)[Channels], const uint16_t (&duty)[Channels])
+{
+	for(unsigned int i = 0; i < Channels; i++)
+		if(onTime[i] != (duty[i] < Period ? duty[i] : Period))
+			return false;
+	return true;
+}
+
+static void schedule()
+{
+	CHECK(Pwm.SetChannel<Channel0>(0) && Pwm.SetChannel<Channel1>(1) && Pwm.SetChannel<Channel2>(2));
+	CHECK(Pwm.SetChannel<Channel3>(3) && Pwm.SetChannel<Channel4>(4) && Pwm.SetChannel<Channel5>(5));
+	CHECK(!Pwm.SetChannel<Channel0>(Channels) && !Pwm.SetDuty(Channels, 1));
+	const uint16_t duty[Channels] = { 250, 500, 250, 250, 0, Period }; // 0% & 100%: no edge in the period
+	for(unsigned int i = 0; i < Channels; i++)
+		Pwm.SetDuty(i, duty[i]);
+	CHECK(Pwm.Commit() && Pwm.isPending());
+	uint32_t onTime[Channels];
+	CHECK(period(onTime) && !Pwm.isPending());
+	CHECK(isOnTime(onTime, duty));
+
+	// edges sorted by duty, channels of the same edge time in one step, one store per port
+	auto &front = Pwm.front();
+	CHECK(front.StepsCount == 3);
+	CHECK(front.Steps[0].Time == 0 && front.Steps[1].Time == 250 && front.Steps[2].Time == 500);
+	const struct { const GPIO_TypeDef *Port; uint32_t Bits; } writes[] =
+	{
+		{ GPIOA, 0x0F },						// on: channels 0, 1, 3, 5
+		{ GPIOB, (1UL << 3 | 1UL << 4) << 16 },	// on: channel 2 (active low), off: channel 4
+		{ GPIOA, (1UL << 0 | 1UL << 2) << 16 },	// off: channels 0, 3
+		{ GPIOB, 1UL << 3 },					// off: channel 2
+		{ GPIOA, 1UL << 1 << 16 },				// off: channel 1
+	};
+	const uint8_t counts[] = { 2, 2, 1 };
+	for(unsigned int s = 0, w = 0; s < front.StepsCount; w += counts[s], s++)
+	{
+		CHECK(front.Steps[s].First == w && front.Steps[s].Count == counts[s]);
+		for(unsigned int i = w; i < w + counts[s]; i++)
+			CHECK(front.Writes[i].Bsrr == &writes[i].Port->BSRR && front.Writes[i].Bits == writes[i].Bits);
+	}
+}
+
+//! New duties are applied since the next period start only
+static void commit()
+{
+	const uint16_t before[Channels] = { 250, 500, 250, 250, 0, Period };
+	const uint16_t after[Channels] = { 750, 1, Period - 1, 250, 0xFFFF, 0 };
+	uint32_t onTime[Channels];
+	auto set = [&]
+	{
+		for(unsigned int i = 0; i < Channels; i++)
+			Pwm.SetDuty(i, after[i]);
+		CHECK(Pwm.Commit() && Pwm.isPending());
+		CHECK(!Pwm.Commit()); // previous commit is not applied yet
+	};
+	CHECK(period(onTime, set) && isOnTime(onTime, before));
+	CHECK(Pwm.isPending());
+	CHECK(period(onTime) && isOnTime(onTime, after) && !Pwm.isPending());
+	CHECK(period(onTime) && isOnTime(onTime, after));
+
+	// all the channels off & on: one step, no edges
+	for(auto duty : { (uint16_t)0, Period })
+	{
+		for(unsigned int i = 0; i < Channels; i++)
+			Pwm.SetDuty(i, duty);
+		CHECK(Pwm.Commit());
+		CHECK(period(onTime) && Pwm.front().StepsCount == 1);
+		const uint16_t all[Channels] = { duty, duty, duty, duty, duty, duty };
+		CHECK(isOnTime(onTime, all));
+	}
+}
+
+int main()
+{
+	schedule();
+	commit();
+	return CHECK_RESULT();
+}
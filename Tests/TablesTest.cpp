@@ -0,0 +1,58 @@
+/**
+ * Tests of linker tables: entries of PORT_TABLE_ENTRY_PRIORITY are ordered by priority at link time
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Timers are declared in reverse order of priorities: table order is made by linker (Port/Host/Tables.ld),
+ * not by declaration order. Timers without priority follow the prioritized ones.
+ */
+
+#include "Tests/Check.hpp"
+#include "Services/Timer.h"
+
+//! Callbacks order of the tick
+static const unsigned int TimersCount = 5;
+static unsigned int Order[TimersCount];
+static unsigned int Calls;
+
+TIMER_DECLARE(Last)
+TIMER_DECLARE_PRIORITY(Priority50, 50)
+TIMER_DECLARE_PRIORITY(Priority10, 10)
+TIMER_DECLARE(AlsoLast)
+TIMER_DECLARE_PRIORITY(Priority00, 00)
+
+TIMER_CALLBACK(Last) { Order[Calls++ % TimersCount] = 3; }
+TIMER_CALLBACK(Priority50) { Order[Calls++ % TimersCount] = 2; }
+TIMER_CALLBACK(Priority10) { Order[Calls++ % TimersCount] = 1; }
+TIMER_CALLBACK(AlsoLast) { Order[Calls++ % TimersCount] = 3; }
+TIMER_CALLBACK(Priority00) { Order[Calls++ % TimersCount] = 0; }
+
+int main()
+{
+	CHECK(Timer::TimersTable::size() == TimersCount);
+	auto table = Timer::TimersTable::begin();
+	CHECK(table[0].State == TIMER_STATE(Priority00) && table[1].State == TIMER_STATE(Priority10) && table[2].State == TIMER_STATE(Priority50));
+	CHECK((table[3].State == TIMER_STATE(Last) && table[4].State == TIMER_STATE(AlsoLast))
+		|| (table[3].State == TIMER_STATE(AlsoLast) && table[4].State == TIMER_STATE(Last)));
+	for(auto &timer : Timer::TimersTable())
+		CHECK(Timer::TimersTable::IndexOf(&timer) < TimersCount);
+
+	// callbacks of the same tick: priority order
+	Timer::Init();
+	SystemTime = 0;
+	Timer::Start(10, TIMER_STATE(Last));
+	Timer::Start(10, TIMER_STATE(Priority50));
+	Timer::Start(10, TIMER_STATE(Priority10));
+	Timer::Start(10, TIMER_STATE(AlsoLast));
+	Timer::Start(10, TIMER_STATE(Priority00));
+	for(unsigned int round = 0; round < 3; round++)
+	{
+		Calls = 0;
+		SystemTime += 10;
+		Timer::Tick();
+		CHECK(Calls == TimersCount);
+		CHECK(Order[0] == 0 && Order[1] == 1 && Order[2] == 2 && Order[3] == 3 && Order[4] == 3);
+	}
+	return CHECK_RESULT();
+}
@@ -0,0 +1,79 @@
+/**
+ * Host tools of tests: decoder round-trip by Tools scripts
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ *
+ * @note Test writes the export of the module (dump, snapshot) to file & checks the text of the host decoder.
+ * Python interpreter & Tools directory are given by the build (@c cortexm_test_tools): without Python 3
+ * the round-trip is skipped, checks of the device side still run.
+ */
+
+/**
+ * @page Tool
+ * @par Usage
+ * @code
+#include "Tests/Tool.hpp"
+
+if(Tool::Write("dump.bin", &Trace::Buffer, sizeof(Trace::Buffer)))
+{
+	std::string text;
+	CHECK(Tool::Run("trace_decode.py dump.bin --text", text) && text.find("TimerCallback") != std::string::npos);
+}
+ * @endcode
+ */
+
+#ifndef TESTS_TOOL_HPP_
+#define TESTS_TOOL_HPP_
+
+#include <stdio.h>
+#include <stddef.h>
+#include <string>
+
+namespace Tool
+{
+	//! Checks are host tools available
+	inline bool isAvailable()
+	{
+#ifdef TESTS_PYTHON
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	//! Writes file of the current directory
+	//! @return True - success
+	inline bool Write(const char *path, const void *data, size_t size)
+	{
+		auto file = fopen(path, "wb");
+		if(file == NULL)
+			return false;
+		auto written = fwrite(data, 1, size, file);
+		return fclose(file) == 0 && written == size;
+	}
+
+	//! Runs tool of Tools directory
+	//! @param command	Script name & arguments
+	//! @param output	Standard output of tool
+	//! @return True - exit code 0; false - tool failed or tools are not available
+	inline bool Run(const std::string &command, std::string &output)
+	{
+		output.clear();
+#ifdef TESTS_PYTHON
+		auto pipe = popen((std::string(TESTS_PYTHON " " TESTS_TOOLS "/") + command + " 2>/dev/null").c_str(), "r");
+		if(pipe == NULL)
+			return false;
+		char buffer[256];
+		for(size_t len; (len = fread(buffer, 1, sizeof(buffer), pipe)) != 0;)
+			output.append(buffer, len);
+		return pclose(pipe) == 0;
+#else
+		(void)command;
+		printf("Python 3 is not found: round-trip of %s is skipped\n", command.c_str());
+		return false;
+#endif
+	}
+}
+
+#endif /* TESTS_TOOL_HPP_ */
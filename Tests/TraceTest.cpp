@@ -0,0 +1,122 @@
+/**
+ * Tests of binary trace: records of events, ring wrap, filter & decoder round-trip
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <string>
+#include "Tests/Check.hpp"
+#include "Tests/Tool.hpp"
+#include "Libs/Trace.hpp"
+
+enum
+{
+	TestEvent = Trace::User,
+	TestScope = Trace::User + 1,
+	TestLevel = Trace::User + 2,
+	TestFiltered = Trace::User + 3,
+};
+
+TRACE_FILTER(TestFiltered)
+
+using Trace::Buffer;
+
+static const Trace::RecordStruct &recordOf(uint32_t index)
+{
+	return Buffer.Records[index & (TRACE_BUFFER_SIZE - 1)];
+}
+
+static void records()
+{
+	Trace::Init();
+	CHECK(Buffer.Header.Magic == Trace::HeaderMagic && Buffer.Header.Version == 1);
+	CHECK(Buffer.Header.RecordSize == sizeof(Trace::RecordStruct) && Buffer.Header.Capacity == TRACE_BUFFER_SIZE);
+	CHECK(Buffer.Header.Frequency != 0 && Buffer.Header.Head == 0);
+
+	TRACE_EVENT(TestEvent, 1, 2);
+	{
+		TRACE_SCOPE(TestScope, 7);
+		TRACE_COUNTER(TestLevel, 42);
+	}
+	TRACE_EVENT(TestFiltered, 3, 4); // compiled out
+	TRACE_EVENT(Trace::TimerCallback, 5);
+	CHECK(Buffer.Header.Head == 5);
+
+	const struct { uint16_t Event; Trace::KindEnum Kind; uint32_t Arg0, Arg1; } expected[] =
+	{
+		{ TestEvent, Trace::KindEnum::Instant, 1, 2 },
+		{ TestScope, Trace::KindEnum::Begin, 7, 0 },
+		{ TestLevel, Trace::KindEnum::Counter, 42, 0 },
+		{ TestScope, Trace::KindEnum::End, 7, 0 },
+		{ Trace::TimerCallback, Trace::KindEnum::Instant, 5, 0 },
+	};
+	for(uint32_t i = 0; i < 5; i++)
+	{
+		auto &record = recordOf(i);
+		CHECK(record.getEvent() == expected[i].Event && record.getKind() == expected[i].Kind && record.getLap() == 1);
+		CHECK(record.Arg0 == expected[i].Arg0 && record.Arg1 == expected[i].Arg1);
+		CHECK((record.Tag & ((uint32_t)Trace::IsrFlag << 16)) == 0);
+		CHECK(i == 0 || (int32_t)(record.Timestamp - recordOf(i - 1).Timestamp) >= 0);
+	}
+}
+
+//! Ring overwrites the oldest records: lap of record is its commit
+static void wrap()
+{
+	Trace::Init();
+	const uint32_t count = TRACE_BUFFER_SIZE * 5 / 2;
+	for(uint32_t i = 0; i < count; i++)
+		TRACE_EVENT(TestEvent, i);
+	CHECK(Buffer.Header.Head == count);
+	for(uint32_t i = count - TRACE_BUFFER_SIZE; i < count; i++)
+	{
+		auto &record = recordOf(i);
+		CHECK(record.Arg0 == i && record.getLap() == i / TRACE_BUFFER_SIZE + 1);
+	}
+}
+
+//! Decoder text: one line per committed record, the oldest record first; user event names of file
+static void decode()
+{
+	Trace::Init();
+	TRACE_EVENT(Trace::TimerCallback, 3);
+	{
+		TRACE_SCOPE(TestScope, 0x1234);
+	}
+	TRACE_COUNTER(TestLevel, 0xABCD);
+	Trace::Reserve(1); // record torn by dump: reserved, not committed
+	const char events[] = "0x101 TestScope\n0x102 TestLevel # counter\n";
+	CHECK(Tool::Write("trace.bin", &Buffer, sizeof(Buffer)) && Tool::Write("trace_events.txt", events, sizeof(events) - 1));
+	if(!Tool::isAvailable())
+		return;
+
+	std::string text;
+	CHECK(Tool::Run("trace_decode.py trace.bin --events trace_events.txt --text", text));
+	const char *lines[] =
+	{
+		"Instant TimerCallback            0x00000003 0x00000000\n",
+		"Begin   TestScope                0x00001234 0x00000000\n",
+		"End     TestScope                0x00001234 0x00000000\n",
+		"Counter TestLevel                0x0000ABCD 0x00000000\n",
+	};
+	size_t position = 0, count = 0;
+	for(auto line : lines)
+	{
+		position = text.find(line, position);
+		CHECK(position != std::string::npos);
+		if(position == std::string::npos)
+			return;
+	}
+	for(auto c : text)
+		count += c == '\n';
+	CHECK(count == 4);
+}
+
+int main()
+{
+	records();
+	wrap();
+	decode();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,197 @@
+/**
+ * Tests of UUID: parse, compare, hash, UUID-keyed map & generator
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "Tests/Check.hpp"
+#include "Libs/UUID.hpp"
+#include "Libs/UuidMap.hpp"
+#include "Libs/UuidGenerator.hpp"
+
+using System::UUID;
+
+static constexpr UUID Device = UUID::Parse("b024f2dc-72ea-11e8-858e-2cfda1e1cef5");
+static_assert(Device.Bytes[0] == 0xB0 && Device.Bytes[4] == 0x72 && Device.Bytes[15] == 0xF5, "UUID is parsed at compile time");
+
+//! UUID of index: V7 of the same millisecond differ by the counter & random bits only
+static UUID uuidOf(uint32_t index)
+{
+	const uint32_t random[2] = { index * 2654435761u, ~index };
+	return UUID::V7(1700000000000ull, (uint16_t)index, random);
+}
+
+static void parse()
+{
+	UUID uuid;
+	CHECK(UUID::Parse("B024F2DC-72EA-11E8-858E-2CFDA1E1CEF5", uuid) && uuid == Device);
+	char str[UUID::StringLength + 1];
+	Device.ToString(str);
+	CHECK(strcmp(str, "b024f2dc-72ea-11e8-858e-2cfda1e1cef5") == 0);
+	CHECK(UUID::Parse(str, uuid) && uuid == Device);
+
+	// wrong strings: length, dashes, hex digits
+	CHECK(!UUID::Parse(NULL, uuid));
+	CHECK(!UUID::Parse("", uuid));
+	CHECK(!UUID::Parse("b024f2dc-72ea-11e8-858e-2cfda1e1cef", uuid));
+	CHECK(!UUID::Parse("b024f2dc-72ea-11e8-858e-2cfda1e1cef55", uuid));
+	CHECK(!UUID::Parse("b024f2dc+72ea-11e8-858e-2cfda1e1cef5", uuid));
+	CHECK(!UUID::Parse("b024f2dc-72ea-11e8-858e-2cfda1e1cefg", uuid));
+	CHECK(!UUID::Parse("x024f2dc-72ea-11e8-858e-2cfda1e1cef5", uuid));
+
+	// wrong string of template parse at run time: nil UUID
+	char wrong[] = "b024f2dc-72ea-11e8-858e-2cfda1e1cefz";
+	static const UUID nil = {{ 0 }};
+	CHECK(UUID::Parse(wrong) == nil);
+	wrong[35] = '5';
+	CHECK(UUID::Parse(wrong) == Device);
+}
+
+static void compare()
+{
+	auto a = uuidOf(1), b = uuidOf(1), c = uuidOf(2);
+	CHECK(a == b && !(a != b));
+	CHECK(a != c && !(a == c));
+	CHECK(a.getVersion() == 7 && (a.Bytes[8] & 0xC0) == 0x80);
+	for(unsigned int i = 0; i < sizeof(a.Bytes); i++)
+	{
+		auto d = a;
+		d.Bytes[i] ^= 0x10;
+		CHECK(d != a);
+	}
+	CHECK(UUID::IsEqual(&a, &b) && !UUID::IsEqual(&a, &c) && !UUID::IsEqual(&a, NULL) && !UUID::IsEqual(NULL, NULL));
+
+	// compare of unaligned copy
+	uint8_t buffer[sizeof(UUID) + 1];
+	memcpy(buffer + 1, &a, sizeof(UUID));
+	CHECK(*(const UUID*)(buffer + 1) == a);
+}
+
+static void hash()
+{
+	CHECK(uuidOf(5).Hash() == uuidOf(5).Hash());
+	// close V7 UUIDs spread over the buckets
+	const unsigned int buckets = 16, count = 1024;
+	unsigned int used[buckets] = {};
+	for(uint32_t i = 0; i < count; i++)
+		used[uuidOf(i).Hash() % buckets]++;
+	for(unsigned int i = 0; i < buckets; i++)
+		CHECK(used[i] > count / buckets / 2 && used[i] < count / buckets * 2);
+}
+
+static void map()
+{
+	static System::UuidMapClass<uint32_t, 16> map;
+	CHECK(map.getCount() == 0 && map.Find(uuidOf(0)) == NULL);
+
+	for(uint32_t i = 0; i < map.getCapacity(); i++)
+		CHECK(map.Insert(uuidOf(i), i * 10));
+	CHECK(map.getCount() == map.getCapacity());
+	CHECK(!map.Insert(uuidOf(100), 1)); // full
+	CHECK(map.Insert(uuidOf(3), 33)); // replace of existing key
+	CHECK(map.getCount() == map.getCapacity());
+	for(uint32_t i = 0; i < map.getCapacity(); i++)
+	{
+		auto value = map.Find(uuidOf(i));
+		CHECK(value != NULL && *value == (i == 3 ? 33 : i * 10));
+	}
+
+	// removed slots: probing passes them, insertion reuses them
+	for(uint32_t i = 0; i < map.getCapacity(); i += 2)
+		CHECK(map.Remove(uuidOf(i)));
+	CHECK(!map.Remove(uuidOf(0)));
+	CHECK(map.getCount() == map.getCapacity() / 2);
+	for(uint32_t i = 0; i < map.getCapacity(); i++)
+		CHECK((map.Find(uuidOf(i)) != NULL) == (i % 2 != 0));
+	for(uint32_t i = 100; i < 100 + map.getCapacity() / 2; i++)
+		CHECK(map.Insert(uuidOf(i), i));
+	CHECK(map.getCount() == map.getCapacity());
+	for(uint32_t i = 100; i < 100 + map.getCapacity() / 2; i++)
+	{
+		auto value = map.Find(uuidOf(i));
+		CHECK(value != NULL && *value == i);
+	}
+
+	const auto &constMap = map;
+	CHECK(constMap.Find(uuidOf(1)) != NULL && *constMap.Find(uuidOf(1)) == 10);
+	map.Clear();
+	CHECK(map.getCount() == 0 && map.Find(uuidOf(1)) == NULL);
+}
+
+//! Random source of the maximum counter start: the shortest way to the counter overflow
+static uint32_t maxRandom() { return 0xFFFFFFFF; }
+
+//! UUIDs of the generator are strictly increasing as bytes
+template<typename GENERATOR>
+static bool generate(GENERATOR &generator, uint32_t systemTime, unsigned int count, std::vector<UUID> &uuids)
+{
+	auto increasing = true;
+	for(unsigned int i = 0; i < count; i++)
+	{
+		auto uuid = generator.V7(systemTime);
+		increasing = increasing && uuid.getVersion() == 7 && (uuids.empty() || memcmp(uuids.back().Bytes, uuid.Bytes, sizeof(uuid.Bytes)) < 0);
+		uuids.push_back(uuid);
+	}
+	return increasing;
+}
+
+static bool isUnique(std::vector<UUID> uuids)
+{
+	auto less = [](const UUID &a, const UUID &b) { return memcmp(a.Bytes, b.Bytes, sizeof(a.Bytes)) < 0; };
+	std::sort(uuids.begin(), uuids.end(), less);
+	return std::adjacent_find(uuids.begin(), uuids.end()) == uuids.end();
+}
+
+static void generator()
+{
+	System::Random::Seed(7);
+	static System::UuidGeneratorClass<> generator;
+	static System::UuidGeneratorClass<maxRandom> overflow;
+	const uint64_t epoch = 1700000000000ull;
+	const unsigned int burst = 100000; // 24 milliseconds of counter: overflows borrow next milliseconds
+	for(auto g : { 0, 1 })
+	{
+		std::vector<UUID> uuids;
+		auto v7 = [&](uint32_t systemTime, unsigned int count)
+		{
+			return g == 0 ? generate(generator, systemTime, count, uuids) : generate(overflow, systemTime, count, uuids);
+		};
+		if(g == 0)
+			generator.SetEpoch(epoch, 1000);
+		else
+			overflow.SetEpoch(epoch, 1000);
+
+		CHECK(v7(1000, burst)); // one millisecond
+		CHECK(v7(1001, 1000)); // time step behind borrowed milliseconds
+		CHECK(v7(1000 + burst, 1000)); // time step ahead of them
+		CHECK(v7(0xFFFFFFF0, 1000));
+		CHECK(v7(5, 1000)); // system time wrap
+		CHECK(v7(6, 1));
+		CHECK(isUnique(uuids));
+		CHECK(uuids.size() == burst + 4001);
+	}
+	CHECK(generator.UnixTime(7) == epoch - 1000 + 0x100000000ull + 7);
+
+	// RTC time step back: UUIDs continue from the last time
+	std::vector<UUID> uuids;
+	CHECK(generate(generator, 10, 10, uuids));
+	generator.SetEpoch(epoch - 60000, 10);
+	CHECK(generate(generator, 11, 1000, uuids) && isUnique(uuids));
+
+	auto v4 = generator.V4();
+	CHECK(v4.getVersion() == 4 && (v4.Bytes[8] & 0xC0) == 0x80 && v4 != generator.V4());
+}
+
+int main()
+{
+	parse();
+	compare();
+	hash();
+	map();
+	generator();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,159 @@
+/**
+ * Tests of wire format: little/big-endian load & store, fields layout
+ * @version 1
+ * @author Victoria Danchenko
+ * @date 18/10/2026
+ */
+
+#include <string.h>
+#include "Tests/Check.hpp"
+#include "Libs/BytesOrder.h"
+#include "Libs/WireLayout.hpp"
+
+static constexpr BytesOrder::be<uint32_t> Magic(0xB024F2DC);
+static_assert(Magic.Bytes[0] == 0xB0 && Magic.Bytes[3] == 0xDC && Magic.get() == 0xB024F2DC, "compile time conversion");
+
+static void bytesOrder()
+{
+	uint8_t buffer[1 + 8];
+	// unaligned values
+	auto le16 = (BytesOrder::le<uint16_t>*)(buffer + 1);
+	*le16 = 0x1234;
+	CHECK(buffer[1] == 0x34 && buffer[2] == 0x12 && *le16 == 0x1234);
+	auto be16 = (BytesOrder::be<uint16_t>*)(buffer + 1);
+	CHECK(*be16 == 0x3412);
+
+	auto le32 = (BytesOrder::le<uint32_t>*)(buffer + 1);
+	*le32 = 0x12345678;
+	CHECK(buffer[1] == 0x78 && buffer[4] == 0x12 && *le32 == 0x12345678);
+	*le32 += 0x10;
+	*le32 |= 0x80000000;
+	CHECK(*le32 == 0x92345688);
+	auto be32 = (BytesOrder::be<uint32_t>*)(buffer + 1);
+	*be32 = 0x12345678;
+	CHECK(buffer[1] == 0x12 && buffer[4] == 0x78 && *be32 == 0x12345678);
+	--*be32;
+	CHECK(*be32 == 0x12345677);
+
+	auto le64 = (BytesOrder::le<uint64_t>*)(buffer + 1);
+	*le64 = 0x0102030405060708ull;
+	CHECK(buffer[1] == 0x08 && buffer[8] == 0x01 && *le64 == 0x0102030405060708ull);
+	auto be64 = (BytesOrder::be<uint64_t>*)(buffer + 1);
+	*be64 = 0x0102030405060708ull;
+	CHECK(buffer[1] == 0x01 && buffer[8] == 0x08 && *be64 == 0x0102030405060708ull);
+
+	// signed values
+	auto beS16 = (BytesOrder::be<int16_t>*)(buffer + 1);
+	*beS16 = -2;
+	CHECK(buffer[1] == 0xFF && buffer[2] == 0xFE && *beS16 == -2);
+
+	// C functions of the same layout
+	uint32_be_t c32;
+	uint32_be_set(&c32, 0xA1B2C3D4);
+	CHECK(c32.Bytes[0] == 0xA1 && uint32_be_get(&c32) == 0xA1B2C3D4);
+	CHECK(((BytesOrder::be<uint32_t>*)&c32)->get() == 0xA1B2C3D4);
+	uint64_le_t c64;
+	uint64_le_set(&c64, 0x1122334455667788ull);
+	CHECK(c64.Bytes[0] == 0x88 && uint64_le_get(&c64) == 0x1122334455667788ull);
+	uint16_le_t c16;
+	uint16_le_set(&c16, 0xBEEF);
+	CHECK(c16.Bytes[0] == 0xEF && uint16_le_get(&c16) == 0xBEEF);
+}
+
+static void bulk()
+{
+	const unsigned int count = 13;
+	uint32_t values[count], loaded[count];
+	for(unsigned int i = 0; i < count; i++)
+		values[i] = 0x01020304 * (i + 1);
+	BytesOrder::be<uint32_t> be[count];
+	BytesOrder::le<uint32_t> le[count];
+	BytesOrder::Store(be, values, count);
+	BytesOrder::Store(le, values, count);
+	for(unsigned int i = 0; i < count; i++)
+		CHECK(be[i] == values[i] && le[i] == values[i] && be[i].Bytes[0] == (uint8_t)(values[i] >> 24));
+	BytesOrder::Load(loaded, be, count);
+	CHECK(memcmp(loaded, values, sizeof(values)) == 0);
+	memset(loaded, 0, sizeof(loaded));
+	BytesOrder::Load(loaded, le, count);
+	CHECK(memcmp(loaded, values, sizeof(values)) == 0);
+
+	// in place conversion
+	uint16_t words[count];
+	for(unsigned int i = 0; i < count; i++)
+		words[i] = (uint16_t)(0x0102 * (i + 1));
+	BytesOrder::Store((BytesOrder::be<uint16_t>*)words, words, count);
+	for(unsigned int i = 0; i < count; i++)
+		CHECK(((uint8_t*)&words[i])[0] == (uint8_t)((0x0102 * (i + 1)) >> 8));
+	BytesOrder::Load(words, (const BytesOrder::be<uint16_t>*)words, count);
+	for(unsigned int i = 0; i < count; i++)
+		CHECK(words[i] == (uint16_t)(0x0102 * (i + 1)));
+}
+
+struct MessageStruct
+{
+	uint32_t Id;
+	uint16_t Len;
+	uint8_t Flags;
+	int16_t Offset;
+};
+
+typedef WIRE_FIELD_BE(MessageStruct, Id) MessageIdField;
+typedef WIRE_FIELD(MessageStruct, Len) MessageLenField;
+typedef WIRE_FIELD(MessageStruct, Flags) MessageFlagsField;
+typedef WIRE_FIELD_BE(MessageStruct, Offset) MessageOffsetField;
+typedef System::Wire::Bytes<3> MessageMagicField;
+typedef System::Wire::Layout<MessageStruct,
+	MessageMagicField,
+	MessageIdField,
+	MessageLenField,
+	MessageFlagsField,
+	MessageOffsetField
+> MessageLayout;
+
+static_assert(MessageLayout::Size == 3 + 4 + 2 + 1 + 2, "packed size of fields");
+static_assert(MessageLayout::OffsetOf<MessageIdField>() == 3 && MessageLayout::OffsetOf<MessageLenField>() == 7
+	&& MessageLayout::OffsetOf<MessageFlagsField>() == 9 && MessageLayout::OffsetOf<MessageOffsetField>() == 10, "field offsets");
+
+static void layout()
+{
+	uint8_t buffer[MessageLayout::Size];
+	memset(buffer, 0xEE, sizeof(buffer));
+	MessageStruct message = { 0x11223344, 0x5566, 0x77, -3 };
+	MessageLayout::Encode(buffer, message);
+	static const uint8_t wire[MessageLayout::Size] = { 0xEE, 0xEE, 0xEE, 0x11, 0x22, 0x33, 0x44, 0x66, 0x55, 0x77, 0xFF, 0xFD };
+	CHECK(memcmp(buffer, wire, sizeof(wire)) == 0); // magic bytes are untouched
+
+	MessageStruct decoded = {};
+	MessageLayout::Decode(decoded, buffer);
+	CHECK(decoded.Id == message.Id && decoded.Len == message.Len && decoded.Flags == message.Flags && decoded.Offset == message.Offset);
+
+	CHECK(MessageLayout::Get<MessageLenField>(buffer) == 0x5566);
+	MessageLayout::Set<MessageLenField>(buffer, 0x0102);
+	CHECK(buffer[7] == 0x02 && buffer[8] == 0x01 && MessageLayout::Get<MessageLenField>(buffer) == 0x0102);
+	MessageLayout::Set<MessageIdField>(buffer, 0xCAFE);
+	CHECK(MessageLayout::Get<MessageIdField>(buffer) == 0xCAFE && buffer[5] == 0xCA && buffer[6] == 0xFE);
+	CHECK(MessageLayout::Get<MessageOffsetField>(buffer) == -3);
+
+	static const uint8_t magic[3] = { 'M', 'S', 'G' };
+	MessageMagicField::Set(buffer + MessageLayout::OffsetOf<MessageMagicField>(), magic);
+	uint8_t read[3];
+	MessageMagicField::Get(read, buffer);
+	CHECK(memcmp(read, magic, sizeof(magic)) == 0);
+	MessageLayout::Decode(decoded, buffer);
+	CHECK(decoded.Id == 0xCAFE && decoded.Len == 0x0102);
+
+	// unaligned wire data
+	uint8_t unaligned[MessageLayout::Size + 1];
+	MessageLayout::Encode(unaligned + 1, message);
+	MessageLayout::Decode(decoded, unaligned + 1);
+	CHECK(decoded.Id == message.Id && decoded.Offset == message.Offset);
+}
+
+int main()
+{
+	bytesOrder();
+	bulk();
+	layout();
+	return CHECK_RESULT();
+}
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""
+Static memory footprint of firmware image: FLASH & RAM totals, linker tables of the framework & largest RAM objects.
+
+Tables (timers, services, pools, metrics e.t.c.) are listed with entries count, entry size & the per-entry cost
+of registry: table entry & its state or storage (timer: .timers & .timers_states entries; pool: .pools entry & blocks).
+Build step (CMake cortexm_footprint): report file near the image; --ram-limit/--flash-limit fail the build (exit code 1).
+
+Usage:
+	footprint.py firmware.elf --objdump arm-none-eabi-objdump
+	footprint.py app --ram-limit 20480 --top 20 -o app.footprint.txt
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+
+#: Registries: table section, RAM sections of entry state & prefix of storage symbols
+REGISTRIES = [
+	('timer', 'timers', ['timers_states'], None),
+	('low-power timer', 'lptimers', ['lptimers_states'], None),
+	('ISR timer', 'timers_isr', ['timers_isr_states'], None),
+	('service', 'services', ['services_states'], None),
+	('pool', 'pools', [], '_PoolStorage_'),
+	('metric', 'metrics', [], '_MetricValues_'),
+	('profile site', 'profile_sites', [], None),
+	('energy peripheral', 'energy_peripherals', [], None),
+	('stack', 'footprint_stacks', [], None),
+]
+
+SECTION_RE = re.compile(r'^\s*\d+\s+(\S+)\s+([0-9a-fA-F]+)\s+[0-9a-fA-F]+\s+[0-9a-fA-F]+\s+[0-9a-fA-F]+\s+\S+\s+(.*)$')
+SYMBOL_RE = re.compile(r'^[0-9a-fA-F]+\s.{7}\s(\S+)\s+([0-9a-fA-F]+)\s+(.*)$')
+
+
+def table_name(section):
+	"""Table of section: .timers, timers, .timers.10 -> timers"""
+	return section.lstrip('.').split('.')[0]
+
+
+def sections(objdump, elf):
+	"""List of (name, size, flags)"""
+	output = subprocess.run([objdump, '-h', '-w', elf], check=True, stdout=subprocess.PIPE, universal_newlines=True).stdout
+	result = []
+	for line in output.splitlines():
+		match = SECTION_RE.match(line)
+		if match:
+			result.append((match.group(1), int(match.group(2), 16), match.group(3)))
+	return result
+
+
+def symbols(objdump, elf):
+	"""List of objects (section, size, name)"""
+	output = subprocess.run([objdump, '-t', '-w', '-C', elf], check=True, stdout=subprocess.PIPE, universal_newlines=True).stdout
+	result = []
+	for line in output.splitlines():
+		match = SYMBOL_RE.match(line)
+		if match and ' O ' in line and int(match.group(2), 16) != 0:
+			result.append((match.group(1), int(match.group(2), 16), re.sub(r'^\.(hidden|protected|internal)\s+', '', match.group(3).strip())))
+	return result
+
+
+def memory(flags):
+	"""FLASH & RAM bytes of section by flags: code & constants - FLASH, initialized data - both, zeroed data - RAM"""
+	if 'ALLOC' not in flags:
+		return False, False
+	if 'READONLY' in flags or 'CODE' in flags:
+		return True, False
+	return 'LOAD' in flags, True
+
+
+def report(elf, objdump, top):
+	lines = []
+	flash = ram = 0
+	section_sizes = {}
+	ram_sections = set()
+	for name, size, flags in sections(objdump, elf):
+		in_flash, in_ram = memory(flags)
+		flash += size if in_flash else 0
+		ram += size if in_ram else 0
+		if in_ram:
+			ram_sections.add(name)
+		table = table_name(name)
+		section_sizes[table] = section_sizes.get(table, 0) + size
+	lines.append('FLASH %d bytes, RAM %d bytes (static)' % (flash, ram))
+
+	objects = symbols(objdump, elf)
+	by_table = {}
+	for section, size, name in objects:
+		by_table.setdefault(table_name(section), []).append((size, name))
+
+	lines.append('')
+	lines.append('%-18s %7s %7s %7s %9s %9s' % ('registry', 'count', 'entry', 'bytes', 'storage', 'per entry'))
+	for registry, table, states, storage_prefix in REGISTRIES:
+		entries = by_table.get(table, [])
+		if not entries and section_sizes.get(table, 0) == 0:
+			continue
+		count = len(entries)
+		size = section_sizes.get(table, sum(size for size, _ in entries))
+		state = sum(section_sizes.get(name, 0) for name in states)
+		storage = state + sum(size for _, size, name in objects if storage_prefix and name.startswith(storage_prefix))
+		per_entry = (size + storage) // count if count else 0
+		lines.append('%-18s %7d %7d %7d %9d %9d' % (registry, count, size // count if count else 0, size, storage, per_entry))
+
+	if top:
+		lines.append('')
+		lines.append('largest RAM objects:')
+		ram_objects = sorted((item for item in objects if item[0] in ram_sections), key=lambda item: -item[1])
+		for section, size, name in ram_objects[:top]:
+			lines.append('%7d  %-16s %s' % (size, section, name))
+	return flash, ram, '\n'.join(lines) + '\n'
+
+
+def main():
+	parser = argparse.ArgumentParser(description='Static memory footprint of firmware image & linker tables')
+	parser.add_argument('elf', help='image (ELF)')
+	parser.add_argument('--objdump', default='objdump', help='objdump of toolchain (default: objdump)')
+	parser.add_argument('--top', type=int, default=10, help='largest RAM objects count (default: 10)')
+	parser.add_argument('--ram-limit', type=int, help='RAM bytes limit: exit code 1 when exceeded')
+	parser.add_argument('--flash-limit', type=int, help='FLASH bytes limit: exit code 1 when exceeded')
+	parser.add_argument('-o', '--output', help='output file (default: stdout)')
+	args = parser.parse_args()
+
+	flash, ram, text = report(args.elf, args.objdump, args.top)
+	if args.output:
+		open(args.output, 'w').write(text)
+	else:
+		sys.stdout.write(text)
+	code = 0
+	if args.ram_limit is not None and ram > args.ram_limit:
+		print('%s: RAM %d bytes exceeds limit %d' % (args.elf, ram, args.ram_limit), file=sys.stderr)
+		code = 1
+	if args.flash_limit is not None and flash > args.flash_limit:
+		print('%s: FLASH %d bytes exceeds limit %d' % (args.elf, flash, args.flash_limit), file=sys.stderr)
+		code = 1
+	return code
+
+
+if __name__ == '__main__':
+	sys.exit(main())
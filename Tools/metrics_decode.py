@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""
+Decoder of metrics export (Libs/Metrics.hpp) to Prometheus text format.
+
+Schema export gives names, types & bucket bounds; snapshots (full or delta) are applied in order.
+Counters, histogram buckets & sums are accumulated without 32-bit wrap. State file keeps accumulated values
+between runs (scrape loop: one snapshot per run). Sequence gap of delta: exit code 2 - request full snapshot.
+
+Usage:
+	metrics_decode.py schema.bin full.bin delta1.bin delta2.bin
+	metrics_decode.py schema.bin delta.bin --state metrics.json --prefix device_ -o metrics.prom
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+HEADER_FORMAT = '<BBHI'
+HEADER_SIZE = 8
+VERSION = 1
+EXPORT_DELTA, EXPORT_FULL, EXPORT_SCHEMA = 0, 1, 2
+COUNTER, GAUGE, HISTOGRAM = 1, 2, 3
+TYPE_NAMES = {COUNTER: 'counter', GAUGE: 'gauge', HISTOGRAM: 'histogram'}
+
+
+class SequenceGap(Exception):
+	pass
+
+
+def header(data):
+	if len(data) < HEADER_SIZE:
+		raise ValueError('export is too short')
+	kind, version, sequence, schema_hash = struct.unpack_from(HEADER_FORMAT, data)
+	if version != VERSION:
+		raise ValueError('unsupported export version %d' % version)
+	return kind, sequence, schema_hash
+
+
+def parse_schema(data):
+	"""List of (name, type, bounds)"""
+	kind, _, schema_hash = header(data)
+	if kind != EXPORT_SCHEMA:
+		raise ValueError('not a schema export')
+	metrics = []
+	offset = HEADER_SIZE
+	while offset < len(data):
+		metric_type, buckets, length = struct.unpack_from('<BBB', data, offset)
+		offset += 3
+		name = data[offset:offset + length].decode('ascii')
+		offset += length
+		bounds = list(struct.unpack_from('<%dI' % buckets, data, offset))
+		offset += 4 * buckets
+		metrics.append((name, metric_type, bounds))
+	return metrics, schema_hash
+
+
+def values_count(metric):
+	return len(metric[2]) + 2 if metric[1] == HISTOGRAM else 1
+
+
+def varints(data, offset):
+	while offset < len(data):
+		value = shift = 0
+		while True:
+			byte = data[offset]
+			offset += 1
+			value |= (byte & 0x7F) << shift
+			shift += 7
+			if not byte & 0x80:
+				break
+		yield value
+
+
+class MetricsState:
+	"""Accumulated values: raw 32-bit value of device & total of host"""
+
+	def __init__(self, metrics, schema_hash, state=None):
+		self.metrics = metrics
+		self.schema_hash = schema_hash
+		count = sum(values_count(metric) for metric in metrics)
+		self.raw = [0] * count
+		self.total = [0] * count
+		self.sequence = None
+		if state and state.get('schema') == schema_hash and len(state.get('raw', [])) == count:
+			self.raw, self.total, self.sequence = state['raw'], state['total'], state['sequence']
+
+	def apply(self, data):
+		kind, sequence, schema_hash = header(data)
+		if schema_hash != self.schema_hash:
+			raise ValueError('schema hash mismatch: firmware is changed, export schema again')
+		if kind == EXPORT_DELTA and (self.sequence is None or sequence != (self.sequence + 1) & 0xFFFF):
+			raise SequenceGap('sequence %d after %s: request full snapshot' % (sequence, self.sequence))
+		values = list(varints(data, HEADER_SIZE))
+		if len(values) != len(self.raw):
+			raise ValueError('snapshot has %d values, schema has %d' % (len(values), len(self.raw)))
+		for i, value in enumerate(values):
+			if kind == EXPORT_FULL:
+				raw = value
+				if self.sequence is None:
+					self.total[i] = value
+				else:
+					self.total[i] += (value - self.raw[i]) & 0xFFFFFFFF
+			else:
+				change = (value >> 1) ^ -(value & 1)  # zigzag
+				raw = (self.raw[i] + change) & 0xFFFFFFFF
+				self.total[i] += change
+			self.raw[i] = raw
+		self.sequence = sequence
+
+	def state(self):
+		return {'schema': self.schema_hash, 'sequence': self.sequence, 'raw': self.raw, 'total': self.total}
+
+	def prometheus(self, prefix=''):
+		lines = []
+		index = 0
+		for name, metric_type, bounds in self.metrics:
+			name = prefix + name
+			lines.append('# TYPE %s %s' % (name, TYPE_NAMES.get(metric_type, 'untyped')))
+			if metric_type == GAUGE:
+				raw = self.raw[index]
+				lines.append('%s %d' % (name, raw - (1 << 32) if raw & 0x80000000 else raw))
+			elif metric_type == HISTOGRAM:
+				cumulative = 0
+				for i, bound in enumerate(bounds + ['+Inf']):
+					cumulative += self.total[index + i]
+					lines.append('%s_bucket{le="%s"} %d' % (name, bound, cumulative))
+				lines.append('%s_sum %d' % (name, self.total[index + len(bounds) + 1]))
+				lines.append('%s_count %d' % (name, cumulative))
+			else:
+				lines.append('%s %d' % (name, self.total[index]))
+			index += values_count((name, metric_type, bounds))
+		return '\n'.join(lines) + '\n'
+
+
+def main():
+	parser = argparse.ArgumentParser(description='Metrics export (Libs/Metrics.hpp) to Prometheus text format')
+	parser.add_argument('schema', help='schema export')
+	parser.add_argument('snapshots', nargs='*', help='full & delta snapshots in order')
+	parser.add_argument('--state', help='JSON file of accumulated values: read & updated')
+	parser.add_argument('--prefix', default='', help='prefix of metric names')
+	parser.add_argument('-o', '--output', help='output file (default: stdout)')
+	args = parser.parse_args()
+
+	metrics, schema_hash = parse_schema(open(args.schema, 'rb').read())
+	state = None
+	if args.state:
+		try:
+			state = json.load(open(args.state))
+		except (OSError, ValueError):
+			pass
+	values = MetricsState(metrics, schema_hash, state)
+	code = 0
+	for path in args.snapshots:
+		try:
+			values.apply(open(path, 'rb').read())
+		except SequenceGap as error:
+			print('%s: %s' % (path, error), file=sys.stderr)
+			code = 2
+			break
+	if args.state:
+		json.dump(values.state(), open(args.state, 'w'))
+	text = values.prometheus(args.prefix)
+	if args.output:
+		open(args.output, 'w').write(text)
+	else:
+		sys.stdout.write(text)
+	return code
+
+
+if __name__ == '__main__':
+	sys.exit(main())
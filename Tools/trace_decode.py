@@ -0,0 +1,278 @@
+#!/usr/bin/env python3
+"""
+Decoder of binary trace dump (Libs/Trace.hpp) to Perfetto (Chrome JSON) trace or text.
+
+Dump is the memory of Trace::Buffer: header & records ring. Dump can be bigger (RAM region): header is found by magic.
+Log messages (Libs/Log.hpp) are formatted by dictionary: .logstr.<n> sections of ELF file.
+
+Usage:
+	trace_decode.py dump.bin -o trace.json		# open by https://ui.perfetto.dev
+	trace_decode.py dump.bin --text
+	trace_decode.py dump.bin --events MyEvents.txt	# user event names: "<id> <name>" lines
+	trace_decode.py dump.bin --elf firmware.elf --text	# log messages
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+HEADER_MAGIC = 0x31435254  # "TRC1"
+HEADER_FORMAT = '<IHHIII12x'
+RECORD_FORMAT = '<IIII'
+KINDS = ('Instant', 'Begin', 'End', 'Counter', 'Data')
+ISR_FLAG = 0x80
+LOG_EVENT = 0x8000
+LOG_FORMAT = re.compile(r'%([-+ #0]*)(\d+|\*)?(\.\d+|\.\*)?(hh|h|ll|l|j|z|t|L)?([diouxXcfFeEgGaAsp%])')
+
+TRACE_HPP = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'Libs', 'Trace.hpp')
+
+
+def load_event_names(path=TRACE_HPP):
+	"""Event names from EventEnum of Trace.hpp"""
+	names = {}
+	try:
+		text = open(path).read()
+	except OSError:
+		return names
+	enum = re.search(r'enum EventEnum[^{]*\{(.*?)\};', text, re.S)
+	if enum:
+		for name, value in re.findall(r'^\s*(\w+)\s*=\s*(0x[0-9A-Fa-f]+|\d+)', enum.group(1), re.M):
+			names[int(value, 0)] = name
+	return names
+
+
+def load_user_names(path):
+	names = {}
+	for line in open(path):
+		line = line.split('#')[0].strip()
+		if line:
+			event, name = line.split(None, 1)
+			names[int(event, 0)] = name
+	return names
+
+
+def log_hash(entry):
+	"""Message ID: FNV-1a hash of dictionary entry (Log::Hash)"""
+	value = 2166136261
+	for byte in entry:
+		value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+	return value
+
+
+def load_dictionary(elf):
+	"""Log dictionary: entries of .logstr.<n> sections & _LogEntry symbols of ELF file; returns {message ID: entry}"""
+	data = open(elf, 'rb').read()
+	if data[:4] != b'\x7fELF' or data[5] != 1:
+		raise ValueError('not little-endian ELF file: %s' % elf)
+	if data[4] == 1:
+		shoff, = struct.unpack_from('<I', data, 0x20)
+		shentsize, shnum, shstrndx = struct.unpack_from('<HHH', data, 0x2E)
+		sections = [struct.unpack_from('<IIIIIII', data, shoff + i * shentsize) for i in range(shnum)]  # name, type, flags, addr, offset, size, link
+		symbol = lambda offset: (lambda n, v, sz, i, o, shndx: (n, v, sz, shndx))(*struct.unpack_from('<IIIBBH', data, offset))
+		symbol_size = 16
+	else:
+		shoff, = struct.unpack_from('<Q', data, 0x28)
+		shentsize, shnum, shstrndx = struct.unpack_from('<HHH', data, 0x3A)
+		sections = [struct.unpack_from('<IIQQQQI', data, shoff + i * shentsize) for i in range(shnum)]
+		symbol = lambda offset: (lambda n, i, o, shndx, v, sz: (n, v, sz, shndx))(*struct.unpack_from('<IBBHQQ', data, offset))
+		symbol_size = 24
+
+	def string(table, offset):
+		start = sections[table][4] + offset
+		return data[start:data.index(b'\0', start)].decode('utf-8', 'replace')
+
+	entries = []
+	for name, type_, flags, addr, offset, size, link in sections:
+		if string(shstrndx, name).startswith('.logstr') and type_ != 8:  # not SHT_NOBITS
+			entries += data[offset:offset + size].split(b'\0')
+	# entries out of .logstr sections: section attribute is ignored for static of template function (GCC)
+	for name, type_, flags, addr, offset, size, link in sections:
+		if type_ != 2:  # SHT_SYMTAB
+			continue
+		for n in range(size // symbol_size):
+			sym_name, value, sym_size, shndx = symbol(offset + n * symbol_size)
+			if 0 < shndx < len(sections) and sections[shndx][1] != 8 and '_LogEntry' in string(link, sym_name):
+				start = sections[shndx][4] + value - sections[shndx][3]
+				entries.append(data[start:start + sym_size].rstrip(b'\0'))
+	return dict((log_hash(entry), entry.decode('utf-8', 'replace')) for entry in entries if entry)
+
+
+def format_message(entry, words):
+	"""Formats printf-style message by argument words; returns (level, location, text)"""
+	level, location, fmt = (entry.split('\x1f', 2) + ['', ''])[:3]
+	words = list(words)
+
+	def word():
+		return words.pop(0) if words else 0
+
+	def replace(m):
+		flags, width, precision, length, conversion = m.groups()
+		if conversion == '%':
+			return '%'
+		if width == '*':
+			width = str(struct.unpack('<i', struct.pack('<I', word()))[0])
+		if precision == '.*':
+			precision = '.%d' % struct.unpack('<i', struct.pack('<I', word()))[0]
+		spec = '%' + flags + (width or '') + (precision or '')
+		value = word()
+		if length == 'll' or (length == 'j'):
+			value |= word() << 32
+			bits = 64
+		else:
+			bits = 32
+		if conversion in 'di':
+			if value >> (bits - 1):
+				value -= 1 << bits
+			return (spec + 'd') % value
+		if conversion in 'ouxX':
+			return (spec + conversion) % value
+		if conversion == 'c':
+			return (spec + 'c') % chr(value & 0xFF)
+		if conversion in 'fFeEgGaA':
+			return (spec + (conversion if conversion not in 'aA' else 'e')) % struct.unpack('<f', struct.pack('<I', value & 0xFFFFFFFF))[0]
+		return (spec + 's') % ('0x%08X' % value)  # %s, %p: pointer only
+
+	return level, location, LOG_FORMAT.sub(replace, fmt)
+
+
+class Record:
+	__slots__ = ('index', 'timestamp', 'event', 'kind', 'isr', 'arg0', 'arg1', 'message')
+
+
+def decode(data):
+	"""Returns (header dict, committed records in order)"""
+	offset = 0
+	while True:
+		offset = data.find(struct.pack('<I', HEADER_MAGIC), offset)
+		if offset < 0:
+			raise ValueError('trace header is not found')
+		if offset % 4 == 0:
+			break
+		offset += 1
+	magic, version, record_size, capacity, frequency, head = struct.unpack_from(HEADER_FORMAT, data, offset)
+	if version != 1 or record_size != struct.calcsize(RECORD_FORMAT) or capacity == 0:
+		raise ValueError('unsupported trace format: version %d, record size %d' % (version, record_size))
+	header = dict(version=version, capacity=capacity, frequency=frequency, head=head)
+	records_offset = offset + struct.calcsize(HEADER_FORMAT)
+	if len(data) < records_offset + capacity * record_size:
+		raise ValueError('trace dump is truncated')
+	records = []
+	skipped = 0
+	timestamp64 = None
+	for index in range(max(0, head - capacity), head):
+		timestamp, tag, arg0, arg1 = struct.unpack_from(RECORD_FORMAT, data, records_offset + (index % capacity) * record_size)
+		if tag >> 24 != (index // capacity) % 255 + 1:
+			skipped += 1  # not committed: torn or lapped
+			continue
+		# unwrap 32-bit timestamps: records are in time order except short ISR preemption
+		timestamp64 = timestamp if timestamp64 is None else timestamp64 + ((timestamp - timestamp64 + 0x80000000) & 0xFFFFFFFF) - 0x80000000
+		r = Record()
+		r.index = index
+		r.timestamp = timestamp64
+		r.event = tag & 0xFFFF
+		kind = (tag >> 16) & 0xFF
+		r.kind = KINDS[kind & 0x0F] if (kind & 0x0F) < len(KINDS) else 'Instant'
+		r.isr = (kind & ISR_FLAG) != 0
+		r.arg0 = arg0
+		r.arg1 = arg1
+		r.message = None
+		records.append(r)
+	header['skipped'] = skipped
+	return header, records
+
+
+def decode_logs(records, dictionary):
+	"""Joins log records with their data records & formats messages; returns records without data records"""
+	result = []
+	i = 0
+	while i < len(records):
+		r = records[i]
+		i += 1
+		if r.event < LOG_EVENT or r.kind != 'Instant':
+			if r.kind != 'Data':
+				result.append(r)
+			continue
+		count = r.event - LOG_EVENT
+		words = [r.arg1]
+		for n in range(1, (count + 2) // 2):
+			if i < len(records) and records[i].index == r.index + n and records[i].kind == 'Data':
+				words += [records[i].arg0, records[i].arg1]
+				i += 1
+			else:
+				words = None  # torn message
+				break
+		if words is None:
+			continue
+		if dictionary is not None and r.arg0 in dictionary:
+			r.message = format_message(dictionary[r.arg0], words[:count])
+		else:
+			r.message = ('Log', '', 'message 0x%X: %s' % (r.arg0, ' '.join('0x%08X' % w for w in words[:count])))
+		result.append(r)
+	return result
+
+
+def event_name(names, event):
+	if event in names:
+		return names[event]
+	for base in sorted((e for e in names if e <= event), reverse=True):
+		return '%s+%d' % (names[base], event - base)
+	return 'Event%d' % event
+
+
+def to_chrome(header, records, names):
+	scale = 1e6 / (header['frequency'] or 1)  # to uS
+	base = records[0].timestamp if records else 0
+	events = [
+		dict(ph='M', pid=1, name='process_name', args=dict(name='Device')),
+		dict(ph='M', pid=1, tid=1, name='thread_name', args=dict(name='Main')),
+		dict(ph='M', pid=1, tid=2, name='thread_name', args=dict(name='ISR')),
+	]
+	for r in records:
+		if r.kind == 'Data':
+			continue
+		e = dict(pid=1, tid=2 if r.isr else 1, ts=(r.timestamp - base) * scale, name=event_name(names, r.event))
+		if r.message is not None:
+			level, location, text = r.message
+			e.update(ph='i', s='t', name=text, cat=level, args=dict(level=level, location=location))
+		elif r.kind == 'Counter':
+			e.update(ph='C', args={e['name']: r.arg0})
+		else:
+			e.update(ph={'Begin': 'B', 'End': 'E'}.get(r.kind, 'i'), args=dict(arg0=r.arg0, arg1=r.arg1))
+			if e['ph'] == 'i':
+				e['s'] = 't'
+		events.append(e)
+	return dict(traceEvents=events, displayTimeUnit='ns')
+
+
+def main():
+	parser = argparse.ArgumentParser(description='Trace dump decoder')
+	parser.add_argument('dump', help='binary dump of Trace::Buffer')
+	parser.add_argument('-o', '--output', help='Chrome JSON trace file; default: stdout')
+	parser.add_argument('--events', help='user event names file: "<id> <name>" lines')
+	parser.add_argument('--elf', help='ELF file: log messages dictionary')
+	parser.add_argument('--text', action='store_true', help='text output')
+	args = parser.parse_args()
+
+	names = load_event_names()
+	if args.events:
+		names.update(load_user_names(args.events))
+	header, records = decode(open(args.dump, 'rb').read())
+	records = decode_logs(records, load_dictionary(args.elf) if args.elf else None)
+	print('records: %d, skipped: %d, capacity: %d, frequency: %d Hz' % (len(records), header['skipped'], header['capacity'], header['frequency']), file=sys.stderr)
+
+	out = open(args.output, 'w') if args.output else sys.stdout
+	if args.text:
+		for r in records:
+			if r.message is not None:
+				out.write('%12.6f %s %-7s %s: %s\n' % (r.timestamp / (header['frequency'] or 1), 'I' if r.isr else ' ', r.message[0], r.message[1], r.message[2]))
+				continue
+			out.write('%12.6f %s %-7s %-24s 0x%08X 0x%08X\n' % (r.timestamp / (header['frequency'] or 1), 'I' if r.isr else ' ', r.kind, event_name(names, r.event), r.arg0, r.arg1))
+	else:
+		json.dump(to_chrome(header, records, names), out)
+
+
+if __name__ == '__main__':
+	main()
@@ -320,6 +320,60 @@ struct Pin
 
 };
 
+/**
+ * Group of pins of the same port. Used to output N-bit value by one BSRR store.
+ * @note First pin is bit 0 of value. Value bits are raw pin levels (active state of pin is ignored).
+ * @code
+ * typedef PinList<Pin<'B', 0>, Pin<'B', 1>, Pin<'B', 2>> Code; // 3-bit code on PB0..PB2
+ * Code::Config(GPIO::Output_PP_High);
+ * Code::Write(5); // PB0 = 1, PB1 = 0, PB2 = 1
+ * @endcode
+ */
+template<class... PINS> struct PinList;
+
+template<> struct PinList<>
+{
+	static const int port_no = -1;
+	static const uint32_t mask = 0;
+	static const unsigned width = 0;
+
+	static constexpr uint32_t SetBits(uint value __attribute__((unused))) { return 0; }
+	static void Config(GPIO::ConfigEnum config __attribute__((unused)), uint value __attribute__((unused)) = 0) {}
+};
+
+template<class PIN, class... PINS>
+struct PinList<PIN, PINS...>
+{
+	typedef PinList<PINS...> Tail;
+
+	enum { GPIOx_BASE = PIN::GPIOx_BASE };
+	static const int port_no = PIN::port_no;
+	static const uint32_t mask = PIN::mask | Tail::mask;
+	static const unsigned width = 1 + Tail::width;	//!< Bits of value
+
+	static_assert(sizeof...(PINS) == 0 || Tail::port_no == port_no, "PinList: all pins must be at the same port");
+
+	//! Returns pins mask to set according to value bits
+	static constexpr uint32_t SetBits(uint value)
+	{
+		return ((value & 1) ? PIN::mask : 0) | Tail::SetBits(value >> 1);
+	}
+
+	//! Writes value to pins
+	//! @note One BSRR store: set & reset at the same time
+	static void Write(uint value)
+	{
+		((GPIO_TypeDef*)GPIOx_BASE)->BSRR = SetBits(value) | ((mask & ~SetBits(value)) << 16);
+	}
+
+	//! Configures all the pins
+	static void Config(GPIO::ConfigEnum config, uint value = 0)
+	{
+		PIN::Config(config, value);
+		Tail::Config(config, value);
+	}
+};
+
 #undef GPIO_MAKE_PIN_CFG
 #undef GPIO_GET_PIN_CFG_MODE
 #undef GPIO_GET_PIN_CFG_OSPEED